@@ -1,50 +1,202 @@
 #include "Application.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
 #include <glad/glad.h>
 #include <glm/gtc/matrix_inverse.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <stb/stb_image.h>
 
+#include "Utils/Json.hpp"
+#include "Utils/Profiler.hpp"
+#include "Voxels/BlockRegistry.hpp"
+#include "Voxels/VoxelRaycast.hpp"
+#include "Voxels/WorldFile.hpp"
+
 namespace Applications
 {
-	Application::Application()
-		: lightPos(0.8f, 2.8f, 15.0f)
+	Application::Application(const bool headless)
+		: lightPos(0.8f, 2.8f, 15.0f), headless(headless)
 	{
-		window = std::make_unique<Utils::Window>("TU.CG.Lab", 1280, 720);
+		window = std::make_unique<Utils::Window>("TU.CG.Lab", 1280, 720, !headless);
 	}
 
 	void Application::Run()
 	{
-		auto lastFrame = 0.0f;
+		const auto runStart = std::chrono::steady_clock::now();
+		const auto millisecondsSinceStart = [runStart]
+		{
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - runStart).count();
+		};
 
 		LoadMap();
 		Initialize();
 		LoadContent();
 
+		Utils::FixedTimestep timestep(simulationTicksPerSecond, maxSimulationTicksPerFrame);
+		const auto tickSeconds = static_cast<float>(timestep.GetTickSeconds());
+
+		Utils::CameraPath playbackPath;
+
+		if (!cameraPathFilePath.empty()) {
+			playbackPath = Utils::CameraPath::Load(cameraPathFilePath);
+			camera->SetIsUserControlEnabled(false);
+		}
+
+		std::unique_ptr<Utils::CameraPathRecorder> pathRecorder;
+
+		if (!recordPathFilePath.empty())
+			pathRecorder = std::make_unique<Utils::CameraPathRecorder>(recordPathInterval);
+
+		// Started after loading, so load time is not simulated as one long frame.
+		auto lastFrame = window->GetElapsedTime();
+
 		while (!window->GetShouldClose())
 		{
+			Utils::Profiler::BeginFrame();
+			PROFILE_ZONE("Frame");
+
 			const auto currentFrame = window->GetElapsedTime();
-			const auto deltaTime = currentFrame - lastFrame;
+			const auto frameSeconds = currentFrame - lastFrame;
 			lastFrame = currentFrame;
 
-			Update(deltaTime);
+			UpdateFrame();
+
+			const auto tickCount = timestep.Advance(frameSeconds);
+
+			for (int tick = 0; tick < tickCount; ++tick)
+				Update(tickSeconds);
+
+			camera->Interpolate(timestep.GetAlpha());
+
+			// Playback follows simulation time, not the wall clock, and ends the run when the path does.
+			if (!playbackPath.IsEmpty()) {
+				const auto pathTime = timestep.GetSimulationTime() + timestep.GetAlpha() * timestep.GetTickSeconds();
+
+				camera->SetPose(playbackPath.Sample(playbackPath.GetStartTime() + pathTime));
+
+				if (playbackPath.GetStartTime() + pathTime >= playbackPath.GetEndTime())
+					window->SetShouldClose(true);
+			}
+
+			if (pathRecorder != nullptr)
+				pathRecorder->Record(timestep.GetSimulationTime(), camera->GetPose());
+
+			// Edge-triggered input is seen by exactly one frame, however many ticks it ran.
+			inputManager.ResetState();
+
+			RebuildDirtyChunks();
+			content.UploadPendingTextures(maxTextureUploadMillisecondsPerFrame);
 			Render();
 
 			window->SwapBuffers();
 			window->PollEvents();
+
+			if (startupStats.firstFrameMilliseconds < 0.0)
+				startupStats.firstFrameMilliseconds = millisecondsSinceStart();
+
+			if (startupStats.texturesResidentMilliseconds < 0.0 && content.GetTextureCache().GetPendingTextureCount() == 0)
+				startupStats.texturesResidentMilliseconds = millisecondsSinceStart();
+		}
+
+		if (pathRecorder != nullptr) {
+			pathRecorder->GetPath().Save(recordPathFilePath);
+
+			std::cout << "Recorded " << pathRecorder->GetPath().GetKeyframeCount() <<
+				" camera keyframes to " << recordPathFilePath << std::endl;
+		}
+
+		PrintFrameStats();
+		UnloadContent();
+	}
+
+	void Application::RunBenchmark(const int frameCount, const std::string& filePath)
+	{
+		if (frameCount <= 0)
+			throw std::exception("Benchmark frame count must be positive.");
+
+		gpuTimerHistorySize = static_cast<size_t>(frameCount);
+
+		LoadMap();
+		Initialize();
+		LoadContent();
+		content.FinishPendingTextures();
+
+		// Uncapped, so the numbers measure the renderer rather than the display.
+		window->SetVSyncMode(Utils::VSyncMode::OFF);
+		window->SetFrameCap(0.0);
+		camera->SetIsUserControlEnabled(false);
+
+		const auto path = cameraPathFilePath.empty() ?
+			MakeOrbitPath(GetTerrainBounds()) : Utils::CameraPath::Load(cameraPathFilePath);
+
+		Utils::RollingStatistics frameTimes(static_cast<size_t>(frameCount));
+
+		// Path time advances a fixed step per frame, so every run renders the same views.
+		constexpr double pathSecondsPerFrame = 1.0 / 60.0;
+
+		for (int frame = -benchmarkWarmupFrames; frame < frameCount && !window->GetShouldClose(); ++frame)
+		{
+			Utils::Profiler::BeginFrame();
+			PROFILE_ZONE("Frame");
+
+			const auto start = std::chrono::steady_clock::now();
+
+			camera->SetPose(path.Sample(path.GetStartTime() + std::max(frame, 0) * pathSecondsPerFrame));
+			RebuildDirtyChunks();
+			Render();
+
+			// Nothing is presented offscreen, so wait for the GPU to count its work in the frame.
+			if (headless)
+				glFinish();
+			else
+				window->SwapBuffers();
+
+			window->PollEvents();
+
+			if (frame >= 0)
+			{
+				frameTimes.Add(std::chrono::duration<double, std::milli>(
+					std::chrono::steady_clock::now() - start).count());
+			}
 		}
 
+		WriteBenchmarkReport(filePath, frameTimes);
+
+		std::cout << "Benchmark: " << frameTimes.GetCount() << " frames" <<
+			", average " << frameTimes.GetAverage() << " ms" <<
+			", 99th percentile " << frameTimes.GetPercentile(99.0) << " ms" <<
+			", report written to " << filePath << std::endl;
+
 		UnloadContent();
 	}
 
 	void Application::Initialize()
 	{
 		window->ActivateInputFor(this);
+		window->SetVSyncMode(vSyncMode);
+		window->SetFrameCap(frameCap);
 
 		camera = std::make_unique<Utils::Camera3D>(
-			glm::vec3(0.0f, 0.0f, 3.0f), glm::vec3(0.0f, 1.0f, 0.0f), 45.0f);
+			spawnPosition, glm::vec3(0.0f, 1.0f, 0.0f), 45.0f);
+
+		camera->SetWorld(&GetBlockVolume());
 
-		camera->SetMap(map);
+		if (headless) {
+			const auto size = window->GetSize();
+
+			offscreenTarget = std::make_unique<Graphics::Framebuffer>(
+				static_cast<int>(size.x), static_cast<int>(size.y));
+		}
+		jobSystem = std::make_unique<Utils::JobSystem>();
+		content.SetJobSystem(jobSystem.get());
+		content.SetTextureBakeDirectory(textureBakeDirectory);
+		content.SetModelCacheDirectory(modelCacheDirectory);
+		content.SetShaderBinaryDirectory(shaderBinaryDirectory);
 		stbi_set_flip_vertically_on_load(true);
 
 		glCullFace(GL_FRONT);
@@ -58,29 +210,7 @@ namespace Applications
 		// -- Textures
 		//
 
-		boxDiffuseMap = std::make_unique<Graphics::Texture>(
-			content.GetTexture("Content/Textures/stone.png"));
-
-		boxSpecularMap = std::make_unique<Graphics::Texture>(
-			content.GetTexture("Content/Textures/stone_specular.png"));
-
-		redstoneDiffuseMap = std::make_unique<Graphics::Texture>(
-			content.GetTexture("Content/Textures/redstone.png"));
-
-		redstoneSpecularMap = std::make_unique<Graphics::Texture>(
-			content.GetTexture("Content/Textures/redstone_specular.png"));
-
-		goldDiffuseMap = std::make_unique<Graphics::Texture>(
-			content.GetTexture("Content/Textures/gold.png"));
-
-		goldSpecularMap = std::make_unique<Graphics::Texture>(
-			content.GetTexture("Content/Textures/gold_specular.png"));
-
-		////
-		// -- Models
-		///
-
-		bed = content.GetModel("Content/Models/bed2/bed.obj");
+		LoadBlockMaterials();
 
 		//
 		// --- Buffers
@@ -200,8 +330,15 @@ namespace Applications
 			{"aTexCoords", Graphics::VertexAttributeType::VEC2F},
 		});
 
+		auto instancedCubeVb = std::make_unique<Graphics::VertexBuffer>(
+			vertices, sizeof vertices);
+
+		instancedCubeVb->SetAttributes(objectVb->GetAttributes());
+
 		objectVa->SetVertexBuffer(std::move(objectVb));
 
+		dynamicBlocks = std::make_unique<Graphics::InstancedBlockRenderer>(std::move(instancedCubeVb), 36);
+
 		//
 		// --- Shaders
 		//
@@ -210,22 +347,35 @@ namespace Applications
 			"Content/Shaders/light_box.vert",
 			"Content/Shaders/light_box.frag");
 
+		lightModelUniform = lightShader->GetUniformHandle("model");
+
 		objectShader = content.GetShader(
 			"Content/Shaders/lighting.vert",
 			"Content/Shaders/lighting.frag");
 
+		objectModelUniform = objectShader->GetUniformHandle("model");
+		objectNormalUniform = objectShader->GetUniformHandle("normal");
+
 		objectShader->Use();
 
 		objectShader->SetInt("material.diffuse", 0);
 		objectShader->SetInt("material.specular", 1);
 		objectShader->SetFloat("material.shininess", 128.0f);
-		objectShader->SetVec3f("light.position", lightPos);
-		objectShader->SetVec3f("light.ambient", glm::vec3(0.2f));
-		objectShader->SetVec3f("light.diffuse", glm::vec3(0.5f));
-		objectShader->SetVec3f("light.specular", glm::vec3(1.0f));
 
 		objectShader->Unuse();
 
+		instancedBlockShader = content.GetShader(
+			"Content/Shaders/block_instanced.vert",
+			"Content/Shaders/lighting.frag");
+
+		instancedBlockShader->Use();
+
+		instancedBlockShader->SetInt("material.diffuse", 0);
+		instancedBlockShader->SetInt("material.specular", 1);
+		instancedBlockShader->SetFloat("material.shininess", 128.0f);
+
+		instancedBlockShader->Unuse();
+
 
 		//
 		// ------ Shaders for Model
@@ -235,50 +385,194 @@ namespace Applications
 			"Content/Shaders/model_loading.vert",
 			"Content/Shaders/model_loading.frag");
 
-		lightShader = content.GetShader(
-			"Content/Shaders/light_box.vert",
-			"Content/Shaders/light_box.frag");
+		// Meshes name their samplers after texture files, which the shader may not declare.
+		modelShader->SetIgnoreMissingUniforms(true);
+
+		modelShaderModelUniform = modelShader->GetUniformHandle("model");
+		modelShaderNormalUniform = modelShader->GetUniformHandle("normal");
 
 		modelShader->Use();
 
 		modelShader->SetFloat("material.shininess", 128.0f);
-		modelShader->SetVec3f("light.position", lightPos);
-		modelShader->SetVec3f("light.ambient", glm::vec3(0.2f));
-		modelShader->SetVec3f("light.diffuse", glm::vec3(0.5f));
-		modelShader->SetVec3f("light.specular", glm::vec3(1.0f));
 
 		modelShader->Unuse();
 
+		//
+		// --- Frame uniforms
+		//
+
+		cameraUniforms = std::make_unique<Graphics::UniformBuffer>(
+			sizeof(Graphics::CameraUniforms), Graphics::CAMERA_UNIFORMS_BINDING);
+
+		lightUniforms = std::make_unique<Graphics::UniformBuffer>(
+			sizeof(Graphics::LightUniforms), Graphics::LIGHT_UNIFORMS_BINDING);
+
+		for (const auto shader : {
+			objectShader.get(), instancedBlockShader.get(), modelShader.get(), lightShader.get() })
+		{
+			shader->BindUniformBlock("Camera", Graphics::CAMERA_UNIFORMS_BINDING);
+		}
+
+		for (const auto shader : { objectShader.get(), instancedBlockShader.get(), modelShader.get() })
+			shader->BindUniformBlock("Light", Graphics::LIGHT_UNIFORMS_BINDING);
+
+		Graphics::LightUniforms light;
+		light.position = glm::vec4(lightPos, 1.0f);
+		light.ambient = glm::vec4(glm::vec3(0.2f), 0.0f);
+		light.diffuse = glm::vec4(glm::vec3(0.5f), 0.0f);
+		light.specular = glm::vec4(glm::vec3(1.0f), 0.0f);
 
+		lightUniforms->SetData(light);
+
+		gpuTimer = std::make_unique<Graphics::GpuTimer>(
+			std::vector<std::string>{ "terrain", "models", "light box" }, 4, gpuTimerHistorySize);
+
+		//
+		// --- Terrain
+		//
+
+		BuildChunkMeshes();
+
+		////
+		// -- Models
+		///
+
+		// After the terrain, whose wait for the workers would otherwise also wait
+		// for these textures to decode.
+		const auto bed = content.GetModel("Content/Models/bed2/bed.obj");
+
+		auto bedTransform = glm::scale(glm::mat4(1.0f), glm::vec3(0.015f));
+		bedTransform = glm::translate(bedTransform, glm::vec3(450.8f, 25.8f, 207.0f));
+
+		modelInstances.emplace_back(bed, bedTransform);
 	}
 
 	void Application::UnloadContent()
 	{
 		content.Clear();
-
+		content.SetJobSystem(nullptr);
+
+		jobSystem->WaitIdle();
+		chunkMeshes.clear();
+		gpuTimer = nullptr;
+		offscreenTarget = nullptr;
+		cameraUniforms = nullptr;
+		lightUniforms = nullptr;
+		dynamicBlocks = nullptr;
 		objectVa = nullptr;
 		objectShader = nullptr;
+		instancedBlockShader = nullptr;
 		lightVa = nullptr;
 		lightShader = nullptr;
 
-		bed = nullptr;
-		torch = nullptr;
+		modelInstances.clear();
 		content.Clear();
 
 	}
 
-	void Application::Update(const float deltaTime)
+	void Application::UpdateFrame()
 	{
 		if (inputManager.IsKeyDown(Input::Keys::ESCAPE))
 			window->SetShouldClose(true);
 
+		camera->UpdateLook(inputManager);
+
+		UpdateBlockInteraction();
+	}
+
+	void Application::Update(const float deltaTime)
+	{
+		PROFILE_ZONE("Application::Update");
+
 		camera->Update(deltaTime, inputManager);
+	}
+
+	void Application::UpdateBlockInteraction()
+	{
+		const auto breakBlock = inputManager.IsButtonPressed(Input::MouseButtons::LEFT);
+		const auto placeBlock = inputManager.IsButtonPressed(Input::MouseButtons::RIGHT);
+
+		if (!breakBlock && !placeBlock)
+			return;
+
+		Voxels::RaycastHit hit;
+
+		const Voxels::Ray ray{ camera->GetPosition(), camera->GetFront(), blockReach };
+		const auto found = octree != nullptr ?
+			Voxels::VoxelRaycast::Cast(*octree, ray, hit) : Voxels::VoxelRaycast::Cast(world, ray, hit);
+
+		if (!found)
+			return;
 
-		inputManager.ResetState();
+		if (breakBlock) {
+			EditBlock(hit.block, Voxels::Blocks::AIR);
+			return;
+		}
+
+		// A zero normal means the camera is inside the block; there is no face to build on.
+		if (hit.normal == glm::ivec3(0))
+			return;
+
+		const auto target = hit.block + hit.normal;
+
+		// Never place a block inside the player's body.
+		const auto& body = camera->GetBody();
+		const auto blockMin = glm::vec3(target) - 0.5f;
+		const auto blockMax = glm::vec3(target) + 0.5f;
+
+		if (glm::all(glm::lessThan(blockMin, body.GetMax())) && glm::all(glm::greaterThan(blockMax, body.GetMin())))
+			return;
+
+		EditBlock(target, placeBlockType);
 	}
 
-	void Application::Render() const
+	void Application::EditBlock(const glm::ivec3& position, const Voxels::BlockType type)
 	{
+		// The octree never grows, so nothing can be built past the map's extent.
+		if (octree != nullptr && !octree->Contains(position.x, position.y, position.z))
+			return;
+
+		const auto chunkCoord = Voxels::World::GetChunkCoord(position.x, position.y, position.z);
+
+		world.SetBlock(position.x, position.y, position.z, type);
+
+		if (octree != nullptr)
+			octree->SetBlock(position.x, position.y, position.z, type);
+
+		// An edited map chunk is not in the file; dropping it would lose the edit.
+		if (mapReader != nullptr)
+			mapReader->KeepChunk(chunkCoord);
+
+		std::erase_if(pendingBlocks, [&position](const PendingBlock& block) { return block.position == position; });
+
+		if (type != Voxels::Blocks::AIR)
+		{
+			pendingBlocks.push_back({ position, chunkCoord, type, lastChunkMeshVersion });
+		}
+
+		UpdateDynamicBlocks();
+	}
+
+	void Application::UpdateDynamicBlocks()
+	{
+		std::vector<Graphics::BlockInstance> instances;
+		instances.reserve(pendingBlocks.size());
+
+		for (const auto& block : pendingBlocks)
+			instances.push_back({ glm::vec3(block.position), block.type });
+
+		dynamicBlocks->SetInstances(instances);
+	}
+
+	void Application::Render()
+	{
+		PROFILE_ZONE("Application::Render");
+
+		gpuTimer->BeginFrame();
+
+		if (offscreenTarget != nullptr)
+			offscreenTarget->Bind();
+
 		glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -286,1713 +580,452 @@ namespace Applications
 
 		const auto view = camera->GetViewMatrix();
 
-		const auto windowSize = window->GetSize();
+		const auto renderSize = GetRenderSize();
 
 		const auto projection = glm::perspective(
-			glm::radians(camera->GetZoom()), windowSize.x / windowSize.y, 0.1f, 100.0f);
+			glm::radians(camera->GetZoom()), renderSize.x / renderSize.y, 0.1f, 100.0f);
 
 		const auto normalMatrix = glm::inverseTranspose(glm::mat3(model));
 
+		Graphics::CameraUniforms cameraData;
+		cameraData.view = view;
+		cameraData.projection = projection;
+		cameraData.viewPos = glm::vec4(camera->GetRenderPosition(), 1.0f);
+
+		cameraUniforms->SetData(cameraData);
+
+		const Utils::Frustum frustum(projection * view);
+		cullingStats = CullingStats();
+
 		objectShader->Use();
 		objectVa->Bind();
 
-		boxDiffuseMap->BindAndActivate(0);
-		boxSpecularMap->BindAndActivate(1);
-		redstoneDiffuseMap->BindAndActivate(0);
+		// Every block material lives in these two arrays, so they are bound once
+		// for the cube, the terrain and the instanced blocks. Model textures use
+		// the GL_TEXTURE_2D targets and leave these bindings alone.
+		blockDiffuseMaps->BindAndActivate(0);
+		blockSpecularMaps->BindAndActivate(1);
 
-		objectShader->SetMat4f("model", model);
-		objectShader->SetMat4f("view", view);
-		objectShader->SetMat4f("projection", projection);
-		objectShader->SetMat3f("normal", normalMatrix);
-		objectShader->SetVec3f("viewPos", camera->GetPosition());
+		Graphics::ShaderProgram::SetMat4f(objectModelUniform, model);
+		Graphics::ShaderProgram::SetMat3f(objectNormalUniform, normalMatrix);
+
+		// objectVa has no layer stream, so the cube reads the constant layer value.
+		glVertexAttribI1i(objectVa->GetNextAttributeLocation(), 0);
 
 		glDrawArrays(GL_TRIANGLES, 0, 36);
 
 
 		// Models
-		const auto normal = glm::inverseTranspose(glm::mat3(model));
-
 		modelShader->Use();
-		
-		model = glm::scale(model, glm::vec3(0.015f));
-		model = glm::translate(model, glm::vec3(450.8f, 25.8f, 207.0f));
 
-		modelShader->SetMat4f("model", model);
-		modelShader->SetMat4f("view", view);
-		modelShader->SetMat4f("projection", projection);
-		modelShader->SetMat3f("normal", normal);
-		modelShader->SetVec3f("viewPos", camera->GetPosition());
-		modelShader->SetVec3f("light.position", lightPos);
+		gpuTimer->BeginPass(MODELS_PASS);
 
-		bed->Draw(*modelShader);
-		
+		for (const auto& instance : modelInstances) {
+			if (frustum.Intersects(instance.GetBounds())) {
+				instance.Draw(*modelShader, modelShaderModelUniform, modelShaderNormalUniform);
+				++cullingStats.drawnModels;
+			}
+			else {
+				++cullingStats.culledModels;
+			}
+		}
 
-		//bed->Draw(*modelShader);
+		gpuTimer->EndPass();
 
 		modelShader->Unuse();
 
 
 
-		for (int x = 0; x < 32; x++) {
-			for (int y = 0; y < 32; y++) {
-				for (int z = 0; z < 32; z++) {
-					// prazen blok
-					if (map[x][y][z] == 0)
-						continue;
+		objectShader->Use();
 
-					// da ne pokazva vutreshnite blokove
-					if (x > 0 && x < sizeX - 1 && map[x - 1][y][z] != 0 && map[x + 1][y][z] != 0 &&
-						y > 0 && y < sizeY - 1 && map[x][y - 1][z] != 0 && map[x][y + 1][z] != 0 &&
-						z > 0 && z < sizeZ - 1 && map[x][y][z - 1] != 0 && map[x][y][z + 1] != 0) {
-						continue;
-					}
+		Graphics::ShaderProgram::SetMat3f(objectNormalUniform, normalMatrix);
 
-					if (map[x][y][z] == 1) {
-						boxDiffuseMap->BindAndActivate(0);
-						boxSpecularMap->BindAndActivate(1);
-					}
+		chunkBounds.Clear();
+		chunkDrawList.clear();
 
-					if (map[x][y][z] == 2) {
-						redstoneDiffuseMap->BindAndActivate(0);
-						redstoneSpecularMap->BindAndActivate(1);
-					}
-					if (map[x][y][z] == 3) {
-						goldDiffuseMap->BindAndActivate(0);
-						goldSpecularMap->BindAndActivate(1);
-					}
+		for (const auto& [chunkCoord, chunkMesh] : chunkMeshes) {
+			chunkBounds.Add(chunkMesh->GetBounds());
+			chunkDrawList.push_back(chunkMesh.get());
+		}
 
-					auto position = glm::vec3((float)x, (float)z, (float)y);
+		cullingStats.drawnChunks = frustum.CullBatch(chunkBounds, chunkVisibility);
+		cullingStats.culledChunks = chunkDrawList.size() - cullingStats.drawnChunks;
 
-					objectShader->Use();
-					objectVa->Bind();
+		gpuTimer->BeginPass(TERRAIN_PASS);
 
-					model = glm::mat4(1.0f);
-					model = glm::translate(model, position);
+		for (size_t i = 0; i < chunkDrawList.size(); ++i) {
+			if (!chunkVisibility[i])
+				continue;
 
-					objectShader->SetMat4f("model", model);
-					objectShader->SetMat4f("view", view);
-					objectShader->SetMat4f("projection", projection);
-					objectShader->SetMat3f("normal", normalMatrix);
-					objectShader->SetVec3f("viewPos", camera->GetPosition());
+			model = glm::translate(glm::mat4(1.0f), glm::vec3(chunkDrawList[i]->GetOrigin()));
 
-					glDrawArrays(GL_TRIANGLES, 0, 36);
+			Graphics::ShaderProgram::SetMat4f(objectModelUniform, model);
 
-					objectVa->Unbind();
-					objectShader->Unuse();
-				}
-			}
+			chunkDrawList[i]->Draw();
 		}
 
+		gpuTimer->EndPass();
+
 
 		objectVa->Unbind();
 		objectShader->Unuse();
 
+		if (dynamicBlocks->GetInstanceCount() > 0) {
+			instancedBlockShader->Use();
+			dynamicBlocks->Draw();
+			instancedBlockShader->Unuse();
+		}
+
 		model = glm::mat4(1.0f);
 		model = glm::translate(model, lightPos);
 		model = glm::scale(model, glm::vec3(0.2f));
 
+		gpuTimer->BeginPass(LIGHT_BOX_PASS);
+
 		lightShader->Use();
 		lightVa->Bind();
 
-		lightShader->SetMat4f("model", model);
-		lightShader->SetMat4f("view", view);
-		lightShader->SetMat4f("projection", projection);
+		Graphics::ShaderProgram::SetMat4f(lightModelUniform, model);
 
 		glDrawArrays(GL_TRIANGLES, 0, 36);
 		lightVa->Unbind();
 		lightShader->Unuse();
+
+		gpuTimer->EndPass();
 	}
 
-	void Application::LoadMap() {
+	void Application::BuildChunkMeshes()
+	{
+		chunkMeshes.clear();
+		pendingBlocks.clear();
+		UpdateDynamicBlocks();
 
-		for (int x = 0; x < sizeX; x++) {
-			for (int y = 0; y < sizeY; y++) {
-				for (int z = 0; z < sizeZ; z++) {
-					map[x][y][z] = 1;
-				}
-			}
+		for (const auto& [chunkCoord, chunk] : world)
+			ScheduleChunkMesh(chunkCoord);
+
+		world.ClearDirtyChunks();
+
+		jobSystem->WaitIdle();
+		UploadChunkMeshes(std::numeric_limits<double>::infinity());
+	}
+
+	void Application::RebuildDirtyChunks()
+	{
+		const auto cameraPosition = glm::round(camera->GetPosition());
+
+		const auto focus = Voxels::World::GetChunkCoord(
+			static_cast<int>(cameraPosition.x),
+			static_cast<int>(cameraPosition.y),
+			static_cast<int>(cameraPosition.z));
+
+		StreamMapChunks(focus);
+
+		for (const auto& chunkCoord : world.TakeDirtyChunks(maxChunkJobsPerFrame, focus))
+			ScheduleChunkMesh(chunkCoord);
+
+		UploadChunkMeshes(maxChunkUploadMillisecondsPerFrame);
+	}
+
+	void Application::StreamMapChunks(const glm::ivec3& focus)
+	{
+		if (mapReader == nullptr || focus == mapLoadCentre)
+			return;
+
+		mapLoadCentre = focus;
+
+		// New chunks come back dirty, together with their neighbours, and are meshed
+		// nearest first like any edit.
+		mapReader->LoadChunksNear(world, mapLoadCentre, mapLoadRadius);
+
+		// Unloading starts a margin further out, so walking back and forth across a
+		// chunk border does not read and drop the same chunks over and over.
+		for (const auto& chunkCoord : mapReader->UnloadChunksOutside(world, mapLoadCentre, mapLoadRadius + mapUnloadMargin))
+		{
+			chunkMeshes.erase(chunkCoord);
+			chunkMeshVersions.erase(chunkCoord);
+		}
+	}
+
+	void Application::ScheduleChunkMesh(const glm::ivec3& chunkCoord)
+	{
+		const auto version = ++lastChunkMeshVersion;
+		chunkMeshVersions[chunkCoord] = version;
+
+		// The neighbourhood is copied here so workers never read the blocks.
+		auto neighbourhood = octree != nullptr ?
+			Voxels::ChunkMesher::Gather(*octree, chunkCoord) : Voxels::ChunkMesher::Gather(world, chunkCoord);
+
+		jobSystem->Submit(
+			[this, neighbourhood = std::move(neighbourhood), version]
+			{
+				PROFILE_ZONE("ChunkMesher::Build");
+
+				chunkMeshResults.Push({ Voxels::ChunkMesher::Build(neighbourhood), version });
+			});
+	}
+
+	void Application::UploadChunkMeshes(const double budgetMilliseconds)
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		ChunkMeshResult result;
+		size_t meshedBlocks = 0;
+
+		while (std::chrono::duration<double, std::milli>(
+			std::chrono::steady_clock::now() - start).count() < budgetMilliseconds &&
+			chunkMeshResults.TryPop(result))
+		{
+			const auto& chunkCoord = result.data.coord;
+
+			// Jobs finish out of order; only the newest request for a chunk counts, and
+			// none does once the chunk has been unloaded.
+			const auto version = chunkMeshVersions.find(chunkCoord);
+
+			if (version == chunkMeshVersions.end() || version->second != result.version)
+				continue;
+
+			if (result.data.IsEmpty())
+				chunkMeshes.erase(chunkCoord);
+			else
+				chunkMeshes[chunkCoord] = std::make_unique<Graphics::ChunkMesh>(result.data);
+
+			meshedBlocks += std::erase_if(pendingBlocks,
+				[&chunkCoord, &result](const PendingBlock& block)
+				{
+					return block.chunkCoord == chunkCoord && block.lastMeshVersion < result.version;
+				});
+		}
+
+		if (meshedBlocks > 0)
+			UpdateDynamicBlocks();
+	}
+
+	void Application::LoadBlockMaterials()
+	{
+		std::vector<std::string> diffusePaths;
+		std::vector<std::string> specularPaths;
+
+		for (const auto& materialName : Voxels::BlockRegistry::GetMaterialNames()) {
+			diffusePaths.push_back("Content/Textures/" + materialName + ".png");
+			specularPaths.push_back("Content/Textures/" + materialName + "_specular.png");
+		}
+
+		blockDiffuseMaps = std::make_unique<Graphics::TextureArray>(
+			content.GetTextureArray("blocks_diffuse", diffusePaths));
+
+		blockSpecularMaps = std::make_unique<Graphics::TextureArray>(
+			content.GetTextureArray("blocks_specular", specularPaths));
+	}
+
+	void Application::PrintFrameStats() const
+	{
+		const auto print = [](const std::string& name, const Utils::RollingStatistics& times)
+		{
+			std::cout << name << ", last " << times.GetCount() << " of " << times.GetTotalCount() << ": " <<
+				"average " << times.GetAverage() << " ms" <<
+				", median " << times.GetPercentile(50.0) << " ms" <<
+				", 99th percentile " << times.GetPercentile(99.0) << " ms" <<
+				", worst " << times.GetMax() << " ms" << std::endl;
+		};
+
+		if (window->GetFrameTimes().GetCount() > 0)
+			print("Frames", window->GetFrameTimes());
+
+		if (startupStats.firstFrameMilliseconds >= 0.0)
+		{
+			std::cout << "Startup: first frame after " << startupStats.firstFrameMilliseconds << " ms" <<
+				", textures resident after " << startupStats.texturesResidentMilliseconds << " ms" << std::endl;
 		}
 
-		for (int x = 1; x < sizeX - 1; x++) {
-			for (int y = 1; y < sizeY - 1; y++) {
-				for (int z = 1; z < sizeZ - 1; z++) {
-					map[x][y][z] = 0;
-				}
+		if (!modelInstances.empty())
+			std::cout << "Models: " << content.GetLoadedModelCount() << " loaded for " << modelInstances.size() << " instances" << std::endl;
+
+		const auto& shaderStats = content.GetShaderCache().GetStats();
+
+		if (shaderStats.requestedPrograms > 0)
+		{
+			std::cout << "Shaders: " << shaderStats.requestedPrograms << " requested, " << shaderStats.sharedPrograms << " shared" <<
+				", " << shaderStats.binaryCacheHits << " loaded from " << shaderBinaryDirectory <<
+				", " << shaderStats.compiledPrograms << " compiled (" << shaderStats.rejectedBinaries << " binaries rejected)" <<
+				" in " << shaderStats.loadMilliseconds << " ms" << std::endl;
+		}
+
+		const auto& textureCache = content.GetTextureCache();
+		const auto& streamingStats = textureCache.GetStreamingStats();
+
+		if (textureCache.GetUploadTimes().GetCount() > 0)
+		{
+			print("Texture uploads", textureCache.GetUploadTimes());
+
+			std::cout << "Textures: " << streamingStats.residentTextures << " of " << streamingStats.requestedTextures <<
+				" streamed, " << streamingStats.decodeMilliseconds << " ms decoding on the workers" <<
+				", worst single upload " << streamingStats.maxUploadMilliseconds << " ms" <<
+				", " << streamingStats.uploadedBytes / 1024 << " KiB uploaded" << std::endl;
+
+			if (streamingStats.bakedCacheHits + streamingStats.bakedCacheMisses > 0)
+			{
+				std::cout << "Baked textures: " << streamingStats.bakedCacheHits << " loaded from " << textureBakeDirectory <<
+					", " << streamingStats.bakedCacheMisses << " baked" << std::endl;
 			}
 		}
 
-		map[1][1][1] = 1;
-		map[1][2][1] = 1;
-		map[1][3][1] = 1;
-		map[1][4][1] = 1;
-		map[1][5][1] = 1;
-		map[1][6][1] = 1;
-		map[1][7][1] = 1;
-		map[1][8][1] = 1;
-		map[1][9][1] = 1;
-		map[1][18][1] = 1;
-		map[1][19][1] = 1;
-		map[1][20][1] = 1;
-		map[1][21][1] = 1;
-		map[1][22][1] = 1;
-		map[1][23][1] = 1;
-		map[1][24][1] = 1;
-		map[1][25][1] = 1;
-		map[1][26][1] = 1;
-		map[1][27][1] = 1;
-		map[1][28][1] = 1;
-		map[1][29][1] = 1;
-		map[1][30][1] = 1;
-		map[2][1][1] = 1;
-		map[2][2][1] = 1;
-		map[2][3][1] = 1;
-		map[2][4][1] = 1;
-		map[2][5][1] = 1;
-		map[2][6][1] = 1;
-		map[2][7][1] = 1;
-		map[2][19][1] = 1;
-		map[2][20][1] = 1;
-		map[2][21][1] = 1;
-		map[2][22][1] = 1;
-		map[2][23][1] = 1;
-		map[2][24][1] = 1;
-		map[2][25][1] = 1;
-		map[2][26][1] = 1;
-		map[2][27][1] = 1;
-		map[2][28][1] = 1;
-		map[2][29][1] = 1;
-		map[2][30][1] = 1;
-		map[3][1][1] = 1;
-		map[3][2][1] = 1;
-		map[3][3][1] = 1;
-		map[3][4][1] = 1;
-		map[3][5][1] = 1;
-		map[3][22][1] = 1;
-		map[3][23][1] = 1;
-		map[3][24][1] = 1;
-		map[3][25][1] = 1;
-		map[3][26][1] = 1;
-		map[3][27][1] = 1;
-		map[3][28][1] = 1;
-		map[3][29][1] = 1;
-		map[3][30][1] = 1;
-		map[4][1][1] = 1;
-		map[4][2][1] = 1;
-		map[4][3][1] = 1;
-		map[4][4][1] = 1;
-		map[4][23][1] = 1;
-		map[4][24][1] = 1;
-		map[4][25][1] = 1;
-		map[4][26][1] = 1;
-		map[4][27][1] = 1;
-		map[4][28][1] = 1;
-		map[4][29][1] = 1;
-		map[4][30][1] = 1;
-		map[5][1][1] = 1;
-		map[5][2][1] = 1;
-		map[5][3][1] = 1;
-		map[5][23][1] = 1;
-		map[5][24][1] = 1;
-		map[5][25][1] = 1;
-		map[5][26][1] = 1;
-		map[5][27][1] = 1;
-		map[5][28][1] = 1;
-		map[5][29][1] = 1;
-		map[5][30][1] = 1;
-		map[6][1][1] = 1;
-		map[6][2][1] = 1;
-		map[6][24][1] = 1;
-		map[6][25][1] = 1;
-		map[6][26][1] = 1;
-		map[6][27][1] = 1;
-		map[6][28][1] = 1;
-		map[6][29][1] = 1;
-		map[6][30][1] = 1;
-		map[7][1][1] = 1;
-		map[7][25][1] = 1;
-		map[7][26][1] = 1;
-		map[7][27][1] = 1;
-		map[7][28][1] = 1;
-		map[7][29][1] = 1;
-		map[7][30][1] = 1;
-		map[8][1][1] = 1;
-		map[8][25][1] = 1;
-		map[8][26][1] = 1;
-		map[8][27][1] = 1;
-		map[8][28][1] = 1;
-		map[8][29][1] = 1;
-		map[8][30][1] = 1;
-		map[9][1][1] = 1;
-		map[9][18][1] = 1;
-		map[9][19][1] = 1;
-		map[9][26][1] = 1;
-		map[9][27][1] = 1;
-		map[9][28][1] = 1;
-		map[9][29][1] = 1;
-		map[9][30][1] = 1;
-		map[10][15][1] = 1;
-		map[10][16][1] = 1;
-		map[10][17][1] = 1;
-		map[10][18][1] = 1;
-		map[10][19][1] = 1;
-		map[10][26][1] = 1;
-		map[10][27][1] = 1;
-		map[10][28][1] = 1;
-		map[10][29][1] = 1;
-		map[10][30][1] = 1;
-		map[11][11][1] = 1;
-		map[11][12][1] = 1;
-		map[11][13][1] = 1;
-		map[11][14][1] = 1;
-		map[11][15][1] = 1;
-		map[11][16][1] = 1;
-		map[11][17][1] = 1;
-		map[11][18][1] = 1;
-		map[11][19][1] = 1;
-		map[11][27][1] = 1;
-		map[11][28][1] = 1;
-		map[11][29][1] = 1;
-		map[11][30][1] = 1;
-		map[12][9][1] = 1;
-		map[12][10][1] = 1;
-		map[12][11][1] = 1;
-		map[12][12][1] = 1;
-		map[12][13][1] = 1;
-		map[12][14][1] = 1;
-		map[12][15][1] = 1;
-		map[12][16][1] = 1;
-		map[12][17][1] = 1;
-		map[12][18][1] = 1;
-		map[12][19][1] = 1;
-		map[12][20][1] = 1;
-		map[12][27][1] = 1;
-		map[12][28][1] = 1;
-		map[12][29][1] = 1;
-		map[12][30][1] = 1;
-		map[13][8][1] = 1;
-		map[13][9][1] = 1;
-		map[13][19][1] = 1;
-		map[13][20][1] = 1;
-		map[13][27][1] = 1;
-		map[13][28][1] = 1;
-		map[13][29][1] = 1;
-		map[13][30][1] = 1;
-		map[14][7][1] = 1;
-		map[14][8][1] = 1;
-		map[14][20][1] = 1;
-		map[14][21][1] = 1;
-		map[14][28][1] = 1;
-		map[14][29][1] = 1;
-		map[14][30][1] = 1;
-		map[15][7][1] = 1;
-		map[15][20][1] = 1;
-		map[15][21][1] = 1;
-		map[15][28][1] = 1;
-		map[15][29][1] = 1;
-		map[15][30][1] = 1;
-		map[16][7][1] = 1;
-		map[16][21][1] = 1;
-		map[16][22][1] = 1;
-		map[16][29][1] = 1;
-		map[16][30][1] = 1;
-		map[17][7][1] = 1;
-		map[17][8][1] = 1;
-		map[17][21][1] = 1;
-		map[17][22][1] = 1;
-		map[17][29][1] = 1;
-		map[17][30][1] = 1;
-		map[18][8][1] = 1;
-		map[18][9][1] = 1;
-		map[18][22][1] = 1;
-		map[18][30][1] = 1;
-		map[19][1][1] = 1;
-		map[19][9][1] = 1;
-		map[19][10][1] = 1;
-		map[19][11][1] = 1;
-		map[19][22][1] = 1;
-		map[19][30][1] = 1;
-		map[20][1][1] = 1;
-		map[20][11][1] = 1;
-		map[20][12][1] = 1;
-		map[20][13][1] = 1;
-		map[20][14][1] = 1;
-		map[20][15][1] = 1;
-		map[20][16][1] = 1;
-		map[20][20][1] = 1;
-		map[20][21][1] = 1;
-		map[20][22][1] = 1;
-		map[20][23][1] = 1;
-		map[21][1][1] = 1;
-		map[21][16][1] = 1;
-		map[21][17][1] = 1;
-		map[21][18][1] = 1;
-		map[21][19][1] = 1;
-		map[21][20][1] = 1;
-		map[22][1][1] = 1;
-		map[23][1][1] = 1;
-		map[23][30][1] = 1;
-		map[24][1][1] = 1;
-		map[24][2][1] = 1;
-		map[24][30][1] = 1;
-		map[25][1][1] = 1;
-		map[25][2][1] = 1;
-		map[25][3][1] = 1;
-		map[25][30][1] = 1;
-		map[26][1][1] = 1;
-		map[26][2][1] = 1;
-		map[26][3][1] = 1;
-		map[26][4][1] = 1;
-		map[26][5][1] = 1;
-		map[26][29][1] = 1;
-		map[26][30][1] = 1;
-		map[27][1][1] = 1;
-		map[27][2][1] = 1;
-		map[27][3][1] = 1;
-		map[27][4][1] = 1;
-		map[27][5][1] = 1;
-		map[27][6][1] = 1;
-		map[27][7][1] = 1;
-		map[27][8][1] = 1;
-		map[27][29][1] = 1;
-		map[27][30][1] = 1;
-		map[28][1][1] = 1;
-		map[28][2][1] = 1;
-		map[28][3][1] = 1;
-		map[28][4][1] = 1;
-		map[28][5][1] = 1;
-		map[28][6][1] = 1;
-		map[28][7][1] = 1;
-		map[28][8][1] = 1;
-		map[28][9][1] = 1;
-		map[28][10][1] = 1;
-		map[28][28][1] = 1;
-		map[28][29][1] = 1;
-		map[28][30][1] = 1;
-		map[29][1][1] = 1;
-		map[29][10][1] = 1;
-		map[29][11][1] = 1;
-		map[29][12][1] = 1;
-		map[29][13][1] = 1;
-		map[29][14][1] = 1;
-		map[29][15][1] = 1;
-		map[29][16][1] = 1;
-		map[29][17][1] = 1;
-		map[29][18][1] = 1;
-		map[29][28][1] = 1;
-		map[29][29][1] = 1;
-		map[29][30][1] = 1;
-		map[30][1][1] = 1;
-		map[30][13][1] = 1;
-		map[30][14][1] = 1;
-		map[30][18][1] = 1;
-		map[30][19][1] = 1;
-		map[30][24][1] = 1;
-		map[30][25][1] = 1;
-		map[30][26][1] = 1;
-		map[30][27][1] = 1;
-		map[30][28][1] = 1;
-		map[30][29][1] = 1;
-		map[30][30][1] = 1;
-
-		map[1][1][2] = 1;
-		map[1][2][2] = 1;
-		map[1][3][2] = 1;
-		map[1][4][2] = 1;
-		map[1][5][2] = 1;
-		map[1][6][2] = 1;
-		map[1][7][2] = 1;
-		map[1][8][2] = 1;
-		map[1][9][2] = 1;
-		map[1][19][2] = 1;
-		map[1][20][2] = 1;
-		map[1][21][2] = 1;
-		map[1][22][2] = 1;
-		map[1][23][2] = 1;
-		map[1][24][2] = 1;
-		map[1][25][2] = 1;
-		map[1][26][2] = 1;
-		map[1][27][2] = 1;
-		map[1][28][2] = 1;
-		map[1][29][2] = 1;
-		map[1][30][2] = 1;
-		map[2][1][2] = 1;
-		map[2][2][2] = 1;
-		map[2][3][2] = 1;
-		map[2][4][2] = 1;
-		map[2][5][2] = 1;
-		map[2][6][2] = 1;
-		map[2][7][2] = 1;
-		map[2][21][2] = 1;
-		map[2][22][2] = 1;
-		map[2][23][2] = 1;
-		map[2][24][2] = 1;
-		map[2][25][2] = 1;
-		map[2][26][2] = 1;
-		map[2][27][2] = 1;
-		map[2][28][2] = 1;
-		map[2][29][2] = 1;
-		map[2][30][2] = 1;
-		map[3][1][2] = 1;
-		map[3][2][2] = 1;
-		map[3][3][2] = 1;
-		map[3][23][2] = 2;
-		map[3][24][2] = 2;
-		map[3][25][2] = 1;
-		map[3][26][2] = 1;
-		map[3][27][2] = 1;
-		map[3][28][2] = 1;
-		map[3][29][2] = 1;
-		map[3][30][2] = 1;
-		map[4][1][2] = 1;
-		map[4][2][2] = 1;
-		map[4][3][2] = 1;
-		map[4][24][2] = 2;
-		map[4][25][2] = 1;
-		map[4][26][2] = 1;
-		map[4][27][2] = 1;
-		map[4][28][2] = 1;
-		map[4][29][2] = 1;
-		map[4][30][2] = 1;
-		map[5][1][2] = 1;
-		map[5][2][2] = 1;
-		map[5][24][2] = 2;
-		map[5][25][2] = 2;
-		map[5][26][2] = 1;
-		map[5][27][2] = 1;
-		map[5][28][2] = 1;
-		map[5][29][2] = 1;
-		map[5][30][2] = 1;
-		map[6][1][2] = 1;
-		map[6][25][2] = 2;
-		map[6][26][2] = 1;
-		map[6][27][2] = 1;
-		map[6][28][2] = 1;
-		map[6][29][2] = 1;
-		map[6][30][2] = 1;
-		map[7][1][2] = 1;
-		map[7][25][2] = 2;
-		map[7][26][2] = 2;
-		map[7][27][2] = 1;
-		map[7][28][2] = 1;
-		map[7][29][2] = 1;
-		map[7][30][2] = 1;
-		map[8][1][2] = 1;
-		map[8][26][2] = 2;
-		map[8][27][2] = 1;
-		map[8][28][2] = 1;
-		map[8][29][2] = 1;
-		map[8][30][2] = 1;
-		map[9][1][2] = 1;
-		map[9][18][2] = 1;
-		map[9][19][2] = 1;
-		map[9][26][2] = 2;
-		map[9][27][2] = 2;
-		map[9][28][2] = 1;
-		map[9][29][2] = 1;
-		map[9][30][2] = 1;
-		map[10][15][2] = 1;
-		map[10][16][2] = 1;
-		map[10][17][2] = 1;
-		map[10][18][2] = 1;
-		map[10][19][2] = 1;
-		map[10][27][2] = 2;
-		map[10][28][2] = 1;
-		map[10][29][2] = 1;
-		map[10][30][2] = 1;
-		map[11][11][2] = 3;
-		map[11][12][2] = 3;
-		map[11][13][2] = 3;
-		map[11][14][2] = 3;
-		map[11][15][2] = 1;
-		map[11][16][2] = 1;
-		map[11][17][2] = 1;
-		map[11][18][2] = 1;
-		map[11][19][2] = 1;
-		map[11][27][2] = 1;
-		map[11][28][2] = 1;
-		map[11][29][2] = 1;
-		map[11][30][2] = 1;
-		map[12][9][2] = 1;
-		map[12][10][2] = 1;
-		map[12][11][2] = 1;
-		map[12][12][2] = 1;
-		map[12][13][2] = 1;
-		map[12][14][2] = 1;
-		map[12][15][2] = 1;
-		map[12][16][2] = 1;
-		map[12][17][2] = 1;
-		map[12][18][2] = 1;
-		map[12][19][2] = 1;
-		map[12][20][2] = 1;
-		map[12][28][2] = 1;
-		map[12][29][2] = 1;
-		map[12][30][2] = 1;
-		map[13][9][2] = 1;
-		map[13][19][2] = 1;
-		map[13][20][2] = 1;
-		map[13][28][2] = 1;
-		map[13][29][2] = 1;
-		map[13][30][2] = 1;
-		map[14][8][2] = 1;
-		map[14][9][2] = 1;
-		map[14][10][2] = 1;
-		map[14][20][2] = 1;
-		map[14][21][2] = 1;
-		map[14][29][2] = 1;
-		map[14][30][2] = 1;
-		map[15][8][2] = 1;
-		map[15][9][2] = 1;
-		map[15][10][2] = 1;
-		map[15][20][2] = 1;
-		map[15][21][2] = 1;
-		map[15][29][2] = 1;
-		map[15][30][2] = 1;
-		map[16][8][2] = 1;
-		map[16][9][2] = 1;
-		map[16][10][2] = 1;
-		map[16][21][2] = 1;
-		map[16][22][2] = 1;
-		map[16][30][2] = 1;
-		map[17][8][2] = 1;
-		map[17][9][2] = 1;
-		map[17][10][2] = 1;
-		map[17][21][2] = 1;
-		map[17][22][2] = 3;
-		map[17][30][2] = 1;
-		map[18][9][2] = 1;
-		map[18][10][2] = 1;
-		map[18][11][2] = 1;
-		map[18][12][2] = 1;
-		map[18][22][2] = 3;
-		map[18][30][2] = 1;
-		map[19][10][2] = 1;
-		map[19][11][2] = 1;
-		map[19][12][2] = 1;
-		map[19][13][2] = 1;
-		map[19][14][2] = 1;
-		map[19][15][2] = 1;
-		map[19][16][2] = 1;
-		map[19][22][2] = 1;
-		map[20][12][2] = 1;
-		map[20][13][2] = 1;
-		map[20][14][2] = 1;
-		map[20][15][2] = 1;
-		map[20][16][2] = 1;
-		map[20][17][2] = 1;
-		map[20][18][2] = 1;
-		map[20][19][2] = 1;
-		map[20][20][2] = 1;
-		map[20][21][2] = 1;
-		map[20][22][2] = 1;
-		map[20][23][2] = 1;
-		map[21][18][2] = 1;
-		map[21][19][2] = 1;
-		map[21][20][2] = 1;
-		map[22][1][2] = 1;
-		map[23][1][2] = 1;
-		map[23][30][2] = 1;
-		map[24][1][2] = 1;
-		map[24][30][2] = 1;
-		map[25][1][2] = 1;
-		map[25][2][2] = 1;
-		map[25][3][2] = 1;
-		map[25][30][2] = 1;
-		map[26][1][2] = 1;
-		map[26][2][2] = 1;
-		map[26][3][2] = 1;
-		map[26][4][2] = 1;
-		map[26][5][2] = 1;
-		map[26][29][2] = 1;
-		map[26][30][2] = 1;
-		map[27][1][2] = 1;
-		map[27][2][2] = 1;
-		map[27][3][2] = 1;
-		map[27][4][2] = 1;
-		map[27][5][2] = 1;
-		map[27][6][2] = 4;
-		map[27][7][2] = 4;
-		map[27][8][2] = 4;
-		map[27][29][2] = 1;
-		map[27][30][2] = 1;
-		map[28][1][2] = 1;
-		map[28][2][2] = 1;
-		map[28][3][2] = 1;
-		map[28][4][2] = 1;
-		map[28][5][2] = 1;
-		map[28][6][2] = 1;
-		map[28][7][2] = 1;
-		map[28][8][2] = 1;
-		map[28][9][2] = 1;
-		map[28][10][2] = 1;
-		map[28][29][2] = 1;
-		map[28][30][2] = 1;
-		map[29][1][2] = 1;
-		map[29][10][2] = 1;
-		map[29][11][2] = 1;
-		map[29][12][2] = 1;
-		map[29][13][2] = 1;
-		map[29][14][2] = 1;
-		map[29][15][2] = 1;
-		map[29][16][2] = 1;
-		map[29][17][2] = 1;
-		map[29][28][2] = 1;
-		map[29][29][2] = 1;
-		map[29][30][2] = 1;
-		map[30][1][2] = 1;
-		map[30][13][2] = 1;
-		map[30][14][2] = 1;
-		map[30][18][2] = 1;
-		map[30][19][2] = 1;
-		map[30][24][2] = 1;
-		map[30][25][2] = 1;
-		map[30][26][2] = 1;
-		map[30][27][2] = 1;
-		map[30][28][2] = 1;
-		map[30][29][2] = 1;
-		map[30][30][2] = 1;
-
-
-		map[1][1][3] = 1;
-		map[1][2][3] = 1;
-		map[1][3][3] = 1;
-		map[1][4][3] = 1;
-		map[1][5][3] = 1;
-		map[1][6][3] = 1;
-		map[1][7][3] = 1;
-		map[1][8][3] = 1;
-		map[1][9][3] = 1;
-		map[1][19][3] = 1;
-		map[1][20][3] = 1;
-		map[1][21][3] = 1;
-		map[1][22][3] = 1;
-		map[1][23][3] = 1;
-		map[1][24][3] = 1;
-		map[1][25][3] = 1;
-		map[1][26][3] = 1;
-		map[1][27][3] = 1;
-		map[1][28][3] = 1;
-		map[1][29][3] = 1;
-		map[1][30][3] = 1;
-		map[2][1][3] = 1;
-		map[2][2][3] = 1;
-		map[2][3][3] = 1;
-		map[2][4][3] = 1;
-		map[2][5][3] = 1;
-		map[2][6][3] = 1;
-		map[2][7][3] = 1;
-		map[2][23][3] = 1;
-		map[2][24][3] = 1;
-		map[2][25][3] = 1;
-		map[2][26][3] = 1;
-		map[2][27][3] = 1;
-		map[2][28][3] = 1;
-		map[2][29][3] = 1;
-		map[2][30][3] = 1;
-		map[3][1][3] = 1;
-		map[3][2][3] = 1;
-		map[3][3][3] = 1;
-		map[3][4][3] = 1;
-		map[3][5][3] = 1;
-		map[3][24][3] = 2;
-		map[3][25][3] = 1;
-		map[3][26][3] = 1;
-		map[3][27][3] = 1;
-		map[3][28][3] = 1;
-		map[3][29][3] = 1;
-		map[3][30][3] = 1;
-		map[4][1][3] = 1;
-		map[4][2][3] = 1;
-		map[4][3][3] = 1;
-		map[4][4][3] = 1;
-		map[4][5][3] = 1;
-		map[4][25][3] = 2;
-		map[4][26][3] = 1;
-		map[4][27][3] = 1;
-		map[4][28][3] = 1;
-		map[4][29][3] = 1;
-		map[4][30][3] = 1;
-		map[5][1][3] = 1;
-		map[5][2][3] = 1;
-		map[5][3][3] = 1;
-		map[5][4][3] = 1;
-		map[5][5][3] = 1;
-		map[5][25][3] = 2;
-		map[5][26][3] = 1;
-		map[5][27][3] = 1;
-		map[5][28][3] = 1;
-		map[5][29][3] = 1;
-		map[5][30][3] = 1;
-		map[6][1][3] = 1;
-		map[6][2][3] = 1;
-		map[6][3][3] = 1;
-		map[6][4][3] = 1;
-		map[6][26][3] = 2;
-		map[6][27][3] = 1;
-		map[6][28][3] = 1;
-		map[6][29][3] = 1;
-		map[6][30][3] = 1;
-		map[7][1][3] = 1;
-		map[7][2][3] = 1;
-		map[7][3][3] = 1;
-		map[7][4][3] = 1;
-		map[7][26][3] = 2;
-		map[7][27][3] = 1;
-		map[7][28][3] = 1;
-		map[7][29][3] = 1;
-		map[7][30][3] = 1;
-		map[8][1][3] = 1;
-		map[8][2][3] = 1;
-		map[8][3][3] = 1;
-		map[8][27][3] = 2;
-		map[8][28][3] = 1;
-		map[8][29][3] = 1;
-		map[8][30][3] = 1;
-		map[9][1][3] = 1;
-		map[9][2][3] = 1;
-		map[9][18][3] = 1;
-		map[9][19][3] = 1;
-		map[9][27][3] = 2;
-		map[9][28][3] = 1;
-		map[9][29][3] = 1;
-		map[9][30][3] = 1;
-		map[10][1][3] = 1;
-		map[10][2][3] = 4;
-		map[10][15][3] = 1;
-		map[10][16][3] = 1;
-		map[10][17][3] = 1;
-		map[10][18][3] = 1;
-		map[10][19][3] = 1;
-		map[10][28][3] = 2;
-		map[10][29][3] = 1;
-		map[10][30][3] = 1;
-		map[11][1][3] = 1;
-		map[11][2][3] = 4;
-		map[11][11][3] = 3;
-		map[11][12][3] = 3;
-		map[11][13][3] = 1;
-		map[11][14][3] = 1;
-		map[11][15][3] = 1;
-		map[11][16][3] = 1;
-		map[11][17][3] = 1;
-		map[11][18][3] = 1;
-		map[11][19][3] = 1;
-		map[11][28][3] = 1;
-		map[11][29][3] = 1;
-		map[11][30][3] = 1;
-		map[12][1][3] = 1;
-		map[12][2][3] = 4;
-		map[12][9][3] = 1;
-		map[12][10][3] = 1;
-		map[12][11][3] = 1;
-		map[12][12][3] = 1;
-		map[12][13][3] = 1;
-		map[12][14][3] = 1;
-		map[12][15][3] = 1;
-		map[12][16][3] = 1;
-		map[12][17][3] = 1;
-		map[12][18][3] = 1;
-		map[12][19][3] = 1;
-		map[12][20][3] = 1;
-		map[12][29][3] = 1;
-		map[12][30][3] = 1;
-		map[13][1][3] = 1;
-		map[13][2][3] = 4;
-		map[13][9][3] = 1;
-		map[13][19][3] = 1;
-		map[13][20][3] = 1;
-		map[13][29][3] = 1;
-		map[13][30][3] = 1;
-		map[14][1][3] = 1;
-		map[14][8][3] = 1;
-		map[14][9][3] = 1;
-		map[14][10][3] = 1;
-		map[14][20][3] = 1;
-		map[14][21][3] = 1;
-		map[14][30][3] = 1;
-		map[15][1][3] = 1;
-		map[15][8][3] = 1;
-		map[15][9][3] = 1;
-		map[15][10][3] = 1;
-		map[15][20][3] = 1;
-		map[15][21][3] = 1;
-		map[15][30][3] = 1;
-		map[16][8][3] = 1;
-		map[16][9][3] = 1;
-		map[16][10][3] = 1;
-		map[16][21][3] = 1;
-		map[16][22][3] = 1;
-		map[16][30][3] = 1;
-		map[17][9][3] = 1;
-		map[17][10][3] = 1;
-		map[17][21][3] = 1;
-		map[17][22][3] = 1;
-		map[17][30][3] = 1;
-		map[18][11][3] = 1;
-		map[18][12][3] = 1;
-		map[18][22][3] = 3;
-		map[18][30][3] = 1;
-		map[19][1][3] = 1;
-		map[19][12][3] = 1;
-		map[19][13][3] = 1;
-		map[19][14][3] = 1;
-		map[19][15][3] = 1;
-		map[19][16][3] = 1;
-		map[19][22][3] = 1;
-		map[20][1][3] = 1;
-		map[20][12][3] = 1;
-		map[20][13][3] = 1;
-		map[20][14][3] = 1;
-		map[20][15][3] = 1;
-		map[20][16][3] = 1;
-		map[20][17][3] = 1;
-		map[20][18][3] = 1;
-		map[20][19][3] = 1;
-		map[20][20][3] = 1;
-		map[20][21][3] = 1;
-		map[20][22][3] = 1;
-		map[20][23][3] = 1;
-		map[21][1][3] = 1;
-		map[21][18][3] = 1;
-		map[21][19][3] = 1;
-		map[21][20][3] = 1;
-		map[22][1][3] = 1;
-		map[22][2][3] = 1;
-		map[23][1][3] = 1;
-		map[23][2][3] = 1;
-		map[23][30][3] = 1;
-		map[24][1][3] = 1;
-		map[24][2][3] = 1;
-		map[24][30][3] = 1;
-		map[25][1][3] = 1;
-		map[25][2][3] = 1;
-		map[25][3][3] = 1;
-		map[25][30][3] = 1;
-		map[26][1][3] = 1;
-		map[26][2][3] = 1;
-		map[26][3][3] = 1;
-		map[26][4][3] = 1;
-		map[26][5][3] = 1;
-		map[26][29][3] = 5;
-		map[26][30][3] = 1;
-		map[27][1][3] = 1;
-		map[27][2][3] = 1;
-		map[27][3][3] = 1;
-		map[27][4][3] = 1;
-		map[27][5][3] = 1;
-		map[27][6][3] = 4;
-		map[27][7][3] = 4;
-		map[27][8][3] = 4;
-		map[27][29][3] = 5;
-		map[27][30][3] = 1;
-		map[28][1][3] = 1;
-		map[28][2][3] = 1;
-		map[28][3][3] = 1;
-		map[28][4][3] = 1;
-		map[28][5][3] = 1;
-		map[28][6][3] = 1;
-		map[28][7][3] = 1;
-		map[28][8][3] = 1;
-		map[28][9][3] = 1;
-		map[28][10][3] = 1;
-		map[28][29][3] = 1;
-		map[28][30][3] = 1;
-		map[29][1][3] = 1;
-		map[29][10][3] = 1;
-		map[29][11][3] = 1;
-		map[29][12][3] = 1;
-		map[29][13][3] = 1;
-		map[29][14][3] = 1;
-		map[29][15][3] = 1;
-		map[29][16][3] = 1;
-		map[29][17][3] = 1;
-		map[29][28][3] = 1;
-		map[29][29][3] = 1;
-		map[29][30][3] = 1;
-		map[30][1][3] = 1;
-		map[30][13][3] = 1;
-		map[30][14][3] = 1;
-		map[30][18][3] = 1;
-		map[30][19][3] = 1;
-		map[30][24][3] = 1;
-		map[30][25][3] = 1;
-		map[30][26][3] = 1;
-		map[30][27][3] = 1;
-		map[30][28][3] = 1;
-		map[30][29][3] = 1;
-		map[30][30][3] = 1;
-
-		map[1][8][4] = 1;
-		map[1][9][4] = 1;
-		map[1][10][4] = 1;
-		map[1][11][4] = 1;
-		map[1][12][4] = 1;
-		map[1][13][4] = 1;
-		map[1][14][4] = 1;
-		map[1][15][4] = 1;
-		map[1][19][4] = 1;
-		map[1][20][4] = 1;
-		map[1][21][4] = 1;
-		map[1][22][4] = 1;
-		map[1][23][4] = 1;
-		map[1][24][4] = 1;
-		map[1][25][4] = 1;
-		map[1][26][4] = 1;
-		map[1][27][4] = 1;
-		map[1][28][4] = 1;
-		map[2][8][4] = 1;
-		map[2][9][4] = 1;
-		map[2][10][4] = 1;
-		map[2][11][4] = 1;
-		map[2][12][4] = 1;
-		map[2][13][4] = 1;
-		map[2][14][4] = 1;
-		map[2][21][4] = 1;
-		map[2][22][4] = 1;
-		map[2][23][4] = 1;
-		map[2][24][4] = 1;
-		map[2][25][4] = 1;
-		map[2][26][4] = 1;
-		map[2][27][4] = 1;
-		map[2][28][4] = 1;
-		map[2][29][4] = 1;
-		map[3][5][4] = 1;
-		map[3][6][4] = 1;
-		map[3][7][4] = 1;
-		map[3][8][4] = 1;
-		map[3][9][4] = 1;
-		map[3][10][4] = 1;
-		map[3][11][4] = 1;
-		map[3][12][4] = 1;
-		map[3][13][4] = 1;
-		map[3][22][4] = 1;
-		map[3][23][4] = 1;
-		map[3][24][4] = 1;
-		map[3][25][4] = 1;
-		map[3][26][4] = 1;
-		map[3][27][4] = 1;
-		map[3][28][4] = 1;
-		map[3][29][4] = 1;
-		map[4][4][4] = 1;
-		map[4][5][4] = 1;
-		map[4][6][4] = 1;
-		map[4][7][4] = 1;
-		map[4][8][4] = 1;
-		map[4][9][4] = 1;
-		map[4][10][4] = 1;
-		map[4][23][4] = 1;
-		map[4][24][4] = 1;
-		map[4][25][4] = 1;
-		map[4][26][4] = 1;
-		map[4][27][4] = 1;
-		map[4][28][4] = 1;
-		map[4][29][4] = 1;
-		map[4][30][4] = 1;
-		map[5][3][4] = 1;
-		map[5][4][4] = 1;
-		map[5][5][4] = 1;
-		map[5][6][4] = 1;
-		map[5][7][4] = 1;
-		map[5][8][4] = 1;
-		map[5][9][4] = 1;
-		map[5][25][4] = 1;
-		map[5][26][4] = 1;
-		map[5][27][4] = 1;
-		map[5][28][4] = 1;
-		map[5][29][4] = 1;
-		map[5][30][4] = 1;
-		map[6][3][4] = 1;
-		map[6][4][4] = 1;
-		map[6][5][4] = 1;
-		map[6][6][4] = 1;
-		map[6][7][4] = 1;
-		map[6][8][4] = 1;
-		map[6][25][4] = 1;
-		map[6][26][4] = 1;
-		map[6][27][4] = 1;
-		map[6][28][4] = 1;
-		map[6][29][4] = 1;
-		map[6][30][4] = 1;
-		map[7][3][4] = 1;
-		map[7][4][4] = 1;
-		map[7][5][4] = 1;
-		map[7][6][4] = 1;
-		map[7][7][4] = 1;
-		map[7][13][4] = 2;
-		map[7][14][4] = 2;
-		map[7][15][4] = 1;
-		map[7][26][4] = 1;
-		map[7][27][4] = 1;
-		map[7][28][4] = 1;
-		map[7][29][4] = 1;
-		map[7][30][4] = 1;
-		map[8][2][4] = 1;
-		map[8][3][4] = 1;
-		map[8][4][4] = 1;
-		map[8][5][4] = 1;
-		map[8][6][4] = 1;
-		map[8][7][4] = 1;
-		map[8][12][4] = 2;
-		map[8][13][4] = 2;
-		map[8][14][4] = 1;
-		map[8][15][4] = 1;
-		map[8][16][4] = 1;
-		map[8][27][4] = 1;
-		map[8][28][4] = 1;
-		map[8][29][4] = 1;
-		map[8][30][4] = 1;
-		map[9][2][4] = 1;
-		map[9][3][4] = 1;
-		map[9][4][4] = 1;
-		map[9][5][4] = 1;
-		map[9][6][4] = 1;
-		map[9][10][4] = 2;
-		map[9][11][4] = 2;
-		map[9][12][4] = 2;
-		map[9][13][4] = 1;
-		map[9][14][4] = 1;
-		map[9][15][4] = 1;
-		map[9][16][4] = 1;
-		map[9][17][4] = 1;
-		map[9][18][4] = 1;
-		map[9][19][4] = 1;
-		map[9][27][4] = 1;
-		map[9][28][4] = 1;
-		map[9][29][4] = 1;
-		map[9][30][4] = 1;
-		map[10][1][4] = 1;
-		map[10][2][4] = 1;
-		map[10][3][4] = 1;
-		map[10][4][4] = 1;
-		map[10][5][4] = 1;
-		map[10][10][4] = 2;
-		map[10][11][4] = 1;
-		map[10][12][4] = 1;
-		map[10][13][4] = 1;
-		map[10][14][4] = 1;
-		map[10][15][4] = 1;
-		map[10][16][4] = 1;
-		map[10][17][4] = 1;
-		map[10][18][4] = 1;
-		map[10][19][4] = 1;
-		map[10][27][4] = 1;
-		map[10][28][4] = 1;
-		map[10][29][4] = 1;
-		map[10][30][4] = 1;
-		map[11][1][4] = 1;
-		map[11][2][4] = 1;
-		map[11][3][4] = 1;
-		map[11][4][4] = 1;
-		map[11][10][4] = 1;
-		map[11][11][4] = 1;
-		map[11][12][4] = 1;
-		map[11][13][4] = 1;
-		map[11][14][4] = 1;
-		map[11][15][4] = 1;
-		map[11][16][4] = 1;
-		map[11][17][4] = 1;
-		map[11][18][4] = 1;
-		map[11][19][4] = 1;
-		map[11][20][4] = 1;
-		map[11][27][4] = 1;
-		map[11][28][4] = 1;
-		map[11][29][4] = 1;
-		map[11][30][4] = 1;
-		map[12][1][4] = 1;
-		map[12][2][4] = 1;
-		map[12][3][4] = 1;
-		map[12][9][4] = 1;
-		map[12][10][4] = 1;
-		map[12][11][4] = 1;
-		map[12][12][4] = 1;
-		map[12][13][4] = 1;
-		map[12][14][4] = 1;
-		map[12][15][4] = 1;
-		map[12][16][4] = 1;
-		map[12][17][4] = 1;
-		map[12][18][4] = 1;
-		map[12][19][4] = 1;
-		map[12][20][4] = 1;
-		map[12][28][4] = 1;
-		map[12][29][4] = 1;
-		map[12][30][4] = 1;
-		map[13][1][4] = 1;
-		map[13][2][4] = 1;
-		map[13][3][4] = 1;
-		map[13][9][4] = 1;
-		map[13][10][4] = 1;
-		map[13][11][4] = 1;
-		map[13][12][4] = 1;
-		map[13][13][4] = 1;
-		map[13][14][4] = 1;
-		map[13][15][4] = 1;
-		map[13][16][4] = 1;
-		map[13][19][4] = 1;
-		map[13][20][4] = 1;
-		map[13][21][4] = 1;
-		map[13][28][4] = 1;
-		map[13][29][4] = 1;
-		map[13][30][4] = 1;
-		map[14][1][4] = 1;
-		map[14][2][4] = 1;
-		map[14][3][4] = 1;
-		map[14][8][4] = 1;
-		map[14][9][4] = 1;
-		map[14][10][4] = 1;
-		map[14][11][4] = 1;
-		map[14][12][4] = 1;
-		map[14][13][4] = 1;
-		map[14][14][4] = 1;
-		map[14][20][4] = 1;
-		map[14][21][4] = 1;
-		map[14][28][4] = 1;
-		map[14][29][4] = 1;
-		map[14][30][4] = 1;
-		map[15][1][4] = 1;
-		map[15][2][4] = 1;
-		map[15][8][4] = 1;
-		map[15][9][4] = 1;
-		map[15][10][4] = 1;
-		map[15][11][4] = 1;
-		map[15][12][4] = 1;
-		map[15][13][4] = 1;
-		map[15][20][4] = 1;
-		map[15][21][4] = 1;
-		map[15][22][4] = 1;
-		map[15][29][4] = 1;
-		map[15][30][4] = 1;
-		map[16][1][4] = 1;
-		map[16][2][4] = 1;
-		map[16][8][4] = 1;
-		map[16][9][4] = 1;
-		map[16][10][4] = 1;
-		map[16][11][4] = 1;
-		map[16][12][4] = 1;
-		map[16][21][4] = 1;
-		map[16][22][4] = 1;
-		map[16][29][4] = 1;
-		map[16][30][4] = 1;
-		map[17][1][4] = 1;
-		map[17][9][4] = 1;
-		map[17][10][4] = 1;
-		map[17][21][4] = 1;
-		map[17][22][4] = 1;
-		map[17][30][4] = 1;
-		map[18][1][4] = 1;
-		map[18][10][4] = 1;
-		map[18][11][4] = 1;
-		map[18][12][4] = 1;
-		map[18][22][4] = 1;
-		map[18][23][4] = 1;
-		map[18][30][4] = 1;
-		map[19][1][4] = 1;
-		map[19][10][4] = 1;
-		map[19][11][4] = 1;
-		map[19][12][4] = 1;
-		map[19][13][4] = 1;
-		map[19][14][4] = 1;
-		map[19][15][4] = 1;
-		map[19][16][4] = 1;
-		map[19][22][4] = 1;
-		map[19][23][4] = 1;
-		map[19][30][4] = 1;
-		map[20][1][4] = 1;
-		map[20][11][4] = 1;
-		map[20][12][4] = 1;
-		map[20][13][4] = 1;
-		map[20][14][4] = 1;
-		map[20][15][4] = 1;
-		map[20][16][4] = 1;
-		map[20][17][4] = 1;
-		map[20][18][4] = 1;
-		map[20][19][4] = 1;
-		map[20][20][4] = 1;
-		map[20][21][4] = 1;
-		map[20][22][4] = 1;
-		map[20][23][4] = 1;
-		map[20][30][4] = 3;
-		map[21][1][4] = 1;
-		map[21][2][4] = 1;
-		map[21][13][4] = 1;
-		map[21][14][4] = 1;
-		map[21][15][4] = 1;
-		map[21][16][4] = 1;
-		map[21][17][4] = 1;
-		map[21][18][4] = 1;
-		map[21][19][4] = 1;
-		map[21][20][4] = 1;
-		map[21][21][4] = 1;
-		map[21][22][4] = 1;
-		map[21][30][4] = 3;
-		map[22][1][4] = 1;
-		map[22][2][4] = 1;
-		map[22][15][4] = 1;
-		map[22][16][4] = 1;
-		map[22][17][4] = 1;
-		map[22][18][4] = 1;
-		map[22][19][4] = 1;
-		map[22][30][4] = 1;
-		map[23][1][4] = 1;
-		map[23][2][4] = 1;
-		map[23][3][4] = 1;
-		map[23][30][4] = 1;
-		map[24][1][4] = 1;
-		map[24][2][4] = 1;
-		map[24][3][4] = 1;
-		map[24][30][4] = 1;
-		map[25][1][4] = 1;
-		map[25][2][4] = 1;
-		map[25][3][4] = 1;
-		map[25][4][4] = 1;
-		map[25][29][4] = 1;
-		map[25][30][4] = 1;
-		map[26][1][4] = 1;
-		map[26][2][4] = 1;
-		map[26][3][4] = 1;
-		map[26][4][4] = 1;
-		map[26][5][4] = 1;
-		map[26][29][4] = 1;
-		map[26][30][4] = 1;
-		map[27][1][4] = 1;
-		map[27][2][4] = 1;
-		map[27][3][4] = 1;
-		map[27][4][4] = 1;
-		map[27][5][4] = 1;
-		map[27][6][4] = 4;
-		map[27][7][4] = 4;
-		map[27][8][4] = 4;
-		map[27][29][4] = 1;
-		map[27][30][4] = 1;
-		map[28][1][4] = 1;
-		map[28][2][4] = 1;
-		map[28][3][4] = 1;
-		map[28][4][4] = 1;
-		map[28][5][4] = 1;
-		map[28][6][4] = 1;
-		map[28][7][4] = 1;
-		map[28][8][4] = 1;
-		map[28][9][4] = 1;
-		map[28][10][4] = 1;
-		map[28][28][4] = 1;
-		map[28][29][4] = 1;
-		map[28][30][4] = 1;
-		map[29][1][4] = 1;
-		map[29][10][4] = 1;
-		map[29][11][4] = 1;
-		map[29][12][4] = 1;
-		map[29][13][4] = 1;
-		map[29][14][4] = 1;
-		map[29][15][4] = 1;
-		map[29][16][4] = 1;
-		map[29][17][4] = 1;
-		map[29][24][4] = 1;
-		map[29][25][4] = 1;
-		map[29][26][4] = 1;
-		map[29][27][4] = 1;
-		map[29][28][4] = 1;
-		map[29][29][4] = 1;
-		map[29][30][4] = 1;
-		map[30][1][4] = 1;
-		map[30][13][4] = 1;
-		map[30][14][4] = 1;
-		map[30][18][4] = 1;
-		map[30][19][4] = 1;
-		map[30][20][4] = 1;
-		map[30][21][4] = 1;
-		map[30][22][4] = 1;
-		map[30][23][4] = 1;
-		map[30][24][4] = 1;
-		map[30][25][4] = 1;
-		map[30][26][4] = 1;
-		map[30][27][4] = 1;
-		map[30][28][4] = 1;
-		map[30][29][4] = 1;
-		map[30][30][4] = 1;
-
-		map[1][8][4] = 1;
-		map[1][9][4] = 1;
-		map[1][10][4] = 1;
-		map[1][11][4] = 1;
-		map[1][12][4] = 1;
-		map[1][13][4] = 1;
-		map[1][14][4] = 1;
-		map[1][15][4] = 1;
-		map[1][19][4] = 1;
-		map[1][20][4] = 1;
-		map[1][21][4] = 1;
-		map[1][22][4] = 1;
-		map[1][23][4] = 1;
-		map[1][24][4] = 1;
-		map[1][25][4] = 1;
-		map[1][26][4] = 1;
-		map[1][27][4] = 1;
-		map[1][28][4] = 1;
-		map[2][8][4] = 1;
-		map[2][9][4] = 1;
-		map[2][10][4] = 1;
-		map[2][11][4] = 1;
-		map[2][12][4] = 1;
-		map[2][13][4] = 1;
-		map[2][14][4] = 1;
-		map[2][21][4] = 1;
-		map[2][22][4] = 1;
-		map[2][23][4] = 1;
-		map[2][24][4] = 1;
-		map[2][25][4] = 1;
-		map[2][26][4] = 1;
-		map[2][27][4] = 1;
-		map[2][28][4] = 1;
-		map[2][29][4] = 1;
-		map[3][5][4] = 1;
-		map[3][6][4] = 1;
-		map[3][7][4] = 1;
-		map[3][8][4] = 1;
-		map[3][9][4] = 1;
-		map[3][10][4] = 1;
-		map[3][11][4] = 1;
-		map[3][12][4] = 1;
-		map[3][13][4] = 1;
-		map[3][22][4] = 1;
-		map[3][23][4] = 1;
-		map[3][24][4] = 1;
-		map[3][25][4] = 1;
-		map[3][26][4] = 1;
-		map[3][27][4] = 1;
-		map[3][28][4] = 1;
-		map[3][29][4] = 1;
-		map[4][4][4] = 1;
-		map[4][5][4] = 1;
-		map[4][6][4] = 1;
-		map[4][7][4] = 1;
-		map[4][8][4] = 1;
-		map[4][9][4] = 1;
-		map[4][10][4] = 1;
-		map[4][23][4] = 1;
-		map[4][24][4] = 1;
-		map[4][25][4] = 1;
-		map[4][26][4] = 1;
-		map[4][27][4] = 1;
-		map[4][28][4] = 1;
-		map[4][29][4] = 1;
-		map[4][30][4] = 1;
-		map[5][3][4] = 1;
-		map[5][4][4] = 1;
-		map[5][5][4] = 1;
-		map[5][6][4] = 1;
-		map[5][7][4] = 1;
-		map[5][8][4] = 1;
-		map[5][9][4] = 1;
-		map[5][25][4] = 1;
-		map[5][26][4] = 1;
-		map[5][27][4] = 1;
-		map[5][28][4] = 1;
-		map[5][29][4] = 1;
-		map[5][30][4] = 1;
-		map[6][3][4] = 1;
-		map[6][4][4] = 1;
-		map[6][5][4] = 1;
-		map[6][6][4] = 1;
-		map[6][7][4] = 1;
-		map[6][8][4] = 1;
-		map[6][25][4] = 1;
-		map[6][26][4] = 1;
-		map[6][27][4] = 1;
-		map[6][28][4] = 1;
-		map[6][29][4] = 1;
-		map[6][30][4] = 1;
-		map[7][3][4] = 1;
-		map[7][4][4] = 1;
-		map[7][5][4] = 1;
-		map[7][6][4] = 1;
-		map[7][7][4] = 1;
-		map[7][13][4] = 2;
-		map[7][14][4] = 2;
-		map[7][15][4] = 1;
-		map[7][26][4] = 1;
-		map[7][27][4] = 1;
-		map[7][28][4] = 1;
-		map[7][29][4] = 1;
-		map[7][30][4] = 1;
-		map[8][2][4] = 1;
-		map[8][3][4] = 1;
-		map[8][4][4] = 1;
-		map[8][5][4] = 1;
-		map[8][6][4] = 1;
-		map[8][7][4] = 1;
-		map[8][12][4] = 2;
-		map[8][13][4] = 2;
-		map[8][14][4] = 1;
-		map[8][15][4] = 1;
-		map[8][16][4] = 1;
-		map[8][27][4] = 1;
-		map[8][28][4] = 1;
-		map[8][29][4] = 1;
-		map[8][30][4] = 1;
-		map[9][2][4] = 1;
-		map[9][3][4] = 1;
-		map[9][4][4] = 1;
-		map[9][5][4] = 1;
-		map[9][6][4] = 1;
-		map[9][10][4] = 2;
-		map[9][11][4] = 2;
-		map[9][12][4] = 2;
-		map[9][13][4] = 1;
-		map[9][14][4] = 1;
-		map[9][15][4] = 1;
-		map[9][16][4] = 1;
-		map[9][17][4] = 1;
-		map[9][18][4] = 1;
-		map[9][19][4] = 1;
-		map[9][27][4] = 1;
-		map[9][28][4] = 1;
-		map[9][29][4] = 1;
-		map[9][30][4] = 1;
-		map[10][1][4] = 1;
-		map[10][2][4] = 1;
-		map[10][3][4] = 1;
-		map[10][4][4] = 1;
-		map[10][5][4] = 1;
-		map[10][10][4] = 2;
-		map[10][11][4] = 1;
-		map[10][12][4] = 1;
-		map[10][13][4] = 1;
-		map[10][14][4] = 1;
-		map[10][15][4] = 1;
-		map[10][16][4] = 1;
-		map[10][17][4] = 1;
-		map[10][18][4] = 1;
-		map[10][19][4] = 1;
-		map[10][27][4] = 1;
-		map[10][28][4] = 1;
-		map[10][29][4] = 1;
-		map[10][30][4] = 1;
-		map[11][1][4] = 1;
-		map[11][2][4] = 1;
-		map[11][3][4] = 1;
-		map[11][4][4] = 1;
-		map[11][10][4] = 1;
-		map[11][11][4] = 1;
-		map[11][12][4] = 1;
-		map[11][13][4] = 1;
-		map[11][14][4] = 1;
-		map[11][15][4] = 1;
-		map[11][16][4] = 1;
-		map[11][17][4] = 1;
-		map[11][18][4] = 1;
-		map[11][19][4] = 1;
-		map[11][20][4] = 1;
-		map[11][27][4] = 1;
-		map[11][28][4] = 1;
-		map[11][29][4] = 1;
-		map[11][30][4] = 1;
-		map[12][1][4] = 1;
-		map[12][2][4] = 1;
-		map[12][3][4] = 1;
-		map[12][9][4] = 1;
-		map[12][10][4] = 1;
-		map[12][11][4] = 1;
-		map[12][12][4] = 1;
-		map[12][13][4] = 1;
-		map[12][14][4] = 1;
-		map[12][15][4] = 1;
-		map[12][16][4] = 1;
-		map[12][17][4] = 1;
-		map[12][18][4] = 1;
-		map[12][19][4] = 1;
-		map[12][20][4] = 1;
-		map[12][28][4] = 1;
-		map[12][29][4] = 1;
-		map[12][30][4] = 1;
-		map[13][1][4] = 1;
-		map[13][2][4] = 1;
-		map[13][3][4] = 1;
-		map[13][9][4] = 1;
-		map[13][10][4] = 1;
-		map[13][11][4] = 1;
-		map[13][12][4] = 1;
-		map[13][13][4] = 1;
-		map[13][14][4] = 1;
-		map[13][15][4] = 1;
-		map[13][16][4] = 1;
-		map[13][19][4] = 1;
-		map[13][20][4] = 1;
-		map[13][21][4] = 1;
-		map[13][28][4] = 1;
-		map[13][29][4] = 1;
-		map[13][30][4] = 1;
-		map[14][1][4] = 1;
-		map[14][2][4] = 1;
-		map[14][3][4] = 1;
-		map[14][8][4] = 1;
-		map[14][9][4] = 1;
-		map[14][10][4] = 1;
-		map[14][11][4] = 1;
-		map[14][12][4] = 1;
-		map[14][13][4] = 1;
-		map[14][14][4] = 1;
-		map[14][20][4] = 1;
-		map[14][21][4] = 1;
-		map[14][28][4] = 1;
-		map[14][29][4] = 1;
-		map[14][30][4] = 1;
-		map[15][1][4] = 1;
-		map[15][2][4] = 1;
-		map[15][8][4] = 1;
-		map[15][9][4] = 1;
-		map[15][10][4] = 1;
-		map[15][11][4] = 1;
-		map[15][12][4] = 1;
-		map[15][13][4] = 1;
-		map[15][20][4] = 1;
-		map[15][21][4] = 1;
-		map[15][22][4] = 1;
-		map[15][29][4] = 1;
-		map[15][30][4] = 1;
-		map[16][1][4] = 1;
-		map[16][2][4] = 1;
-		map[16][8][4] = 1;
-		map[16][9][4] = 1;
-		map[16][10][4] = 1;
-		map[16][11][4] = 1;
-		map[16][12][4] = 1;
-		map[16][21][4] = 1;
-		map[16][22][4] = 1;
-		map[16][29][4] = 1;
-		map[16][30][4] = 1;
-		map[17][1][4] = 1;
-		map[17][9][4] = 1;
-		map[17][10][4] = 1;
-		map[17][21][4] = 1;
-		map[17][22][4] = 1;
-		map[17][30][4] = 1;
-		map[18][1][4] = 1;
-		map[18][10][4] = 1;
-		map[18][11][4] = 1;
-		map[18][12][4] = 1;
-		map[18][22][4] = 1;
-		map[18][23][4] = 1;
-		map[18][30][4] = 1;
-		map[19][1][4] = 1;
-		map[19][10][4] = 1;
-		map[19][11][4] = 1;
-		map[19][12][4] = 1;
-		map[19][13][4] = 1;
-		map[19][14][4] = 1;
-		map[19][15][4] = 1;
-		map[19][16][4] = 1;
-		map[19][22][4] = 1;
-		map[19][23][4] = 1;
-		map[19][30][4] = 1;
-		map[20][1][4] = 1;
-		map[20][11][4] = 1;
-		map[20][12][4] = 1;
-		map[20][13][4] = 1;
-		map[20][14][4] = 1;
-		map[20][15][4] = 1;
-		map[20][16][4] = 1;
-		map[20][17][4] = 1;
-		map[20][18][4] = 1;
-		map[20][19][4] = 1;
-		map[20][20][4] = 1;
-		map[20][21][4] = 1;
-		map[20][22][4] = 1;
-		map[20][23][4] = 1;
-		map[20][30][4] = 3;
-		map[21][1][4] = 1;
-		map[21][2][4] = 1;
-		map[21][13][4] = 1;
-		map[21][14][4] = 1;
-		map[21][15][4] = 1;
-		map[21][16][4] = 1;
-		map[21][17][4] = 1;
-		map[21][18][4] = 1;
-		map[21][19][4] = 1;
-		map[21][20][4] = 1;
-		map[21][21][4] = 1;
-		map[21][22][4] = 1;
-		map[21][30][4] = 3;
-		map[22][1][4] = 1;
-		map[22][2][4] = 1;
-		map[22][15][4] = 1;
-		map[22][16][4] = 1;
-		map[22][17][4] = 1;
-		map[22][18][4] = 1;
-		map[22][19][4] = 1;
-		map[22][30][4] = 1;
-		map[23][1][4] = 1;
-		map[23][2][4] = 1;
-		map[23][3][4] = 1;
-		map[23][30][4] = 1;
-		map[24][1][4] = 1;
-		map[24][2][4] = 1;
-		map[24][3][4] = 1;
-		map[24][30][4] = 1;
-		map[25][1][4] = 1;
-		map[25][2][4] = 1;
-		map[25][3][4] = 1;
-		map[25][4][4] = 1;
-		map[25][29][4] = 1;
-		map[25][30][4] = 1;
-		map[26][1][4] = 1;
-		map[26][2][4] = 1;
-		map[26][3][4] = 1;
-		map[26][4][4] = 1;
-		map[26][5][4] = 1;
-		map[26][29][4] = 1;
-		map[26][30][4] = 1;
-		map[27][1][4] = 1;
-		map[27][2][4] = 1;
-		map[27][3][4] = 1;
-		map[27][4][4] = 1;
-		map[27][5][4] = 1;
-		map[27][6][4] = 4;
-		map[27][7][4] = 4;
-		map[27][8][4] = 4;
-		map[27][29][4] = 1;
-		map[27][30][4] = 1;
-		map[28][1][4] = 1;
-		map[28][2][4] = 1;
-		map[28][3][4] = 1;
-		map[28][4][4] = 1;
-		map[28][5][4] = 1;
-		map[28][6][4] = 1;
-		map[28][7][4] = 1;
-		map[28][8][4] = 1;
-		map[28][9][4] = 1;
-		map[28][10][4] = 1;
-		map[28][28][4] = 1;
-		map[28][29][4] = 1;
-		map[28][30][4] = 1;
-		map[29][1][4] = 1;
-		map[29][10][4] = 1;
-		map[29][11][4] = 1;
-		map[29][12][4] = 1;
-		map[29][13][4] = 1;
-		map[29][14][4] = 1;
-		map[29][15][4] = 1;
-		map[29][16][4] = 1;
-		map[29][17][4] = 1;
-		map[29][24][4] = 1;
-		map[29][25][4] = 1;
-		map[29][26][4] = 1;
-		map[29][27][4] = 1;
-		map[29][28][4] = 1;
-		map[29][29][4] = 1;
-		map[29][30][4] = 1;
-		map[30][1][4] = 1;
-		map[30][13][4] = 1;
-		map[30][14][4] = 1;
-		map[30][18][4] = 1;
-		map[30][19][4] = 1;
-		map[30][20][4] = 1;
-		map[30][21][4] = 1;
-		map[30][22][4] = 1;
-		map[30][23][4] = 1;
-		map[30][24][4] = 1;
-		map[30][25][4] = 1;
-		map[30][26][4] = 1;
-		map[30][27][4] = 1;
-		map[30][28][4] = 1;
-		map[30][29][4] = 1;
-		map[30][30][4] = 1;
+		if (gpuTimer == nullptr)
+			return;
+
+		for (size_t pass = 0; pass < gpuTimer->GetPassCount(); ++pass)
+		{
+			if (gpuTimer->GetPassTimes(pass).GetCount() > 0)
+				print("GPU " + gpuTimer->GetPassName(pass), gpuTimer->GetPassTimes(pass));
+		}
+
+		if (gpuTimer->GetSkippedQueries() > 0)
+			std::cout << "GPU timer skipped " << gpuTimer->GetSkippedQueries() << " pass measurements." << std::endl;
+	}
+
+	glm::vec2 Application::GetRenderSize() const
+	{
+		if (offscreenTarget != nullptr)
+			return glm::vec2(offscreenTarget->GetWidth(), offscreenTarget->GetHeight());
+
+		return window->GetSize();
+	}
+
+	Utils::BoundingBox Application::GetTerrainBounds() const
+	{
+		Utils::BoundingBox bounds;
+
+		for (const auto& [chunkCoord, chunkMesh] : chunkMeshes)
+			bounds.Extend(chunkMesh->GetBounds());
+
+		return bounds;
+	}
+
+	Utils::CameraPath Application::MakeOrbitPath(const Utils::BoundingBox& bounds)
+	{
+		// A slow orbit above the terrain, looking down at its centre.
+		constexpr double orbitSeconds = 20.0;
+		constexpr int keyframeCount = 48;
+
+		const auto centre = (bounds.min + bounds.max) * 0.5f;
+		const auto extent = bounds.max - bounds.min;
+		const auto radius = std::max(extent.x, extent.z) * 0.75f + 4.0f;
+		const auto height = bounds.max.y + 6.0f;
+		const auto pitch = glm::degrees(std::atan2(centre.y - height, radius));
+
+		Utils::CameraPath path;
+
+		for (int i = 0; i <= keyframeCount; ++i)
+		{
+			const auto angle = static_cast<float>(i) / keyframeCount * glm::two_pi<float>();
+
+			Utils::CameraPose pose;
+			pose.position = glm::vec3(centre.x + radius * std::cos(angle), height, centre.z + radius * std::sin(angle));
+			// Facing the centre; kept continuous so the spline never spins through 360 degrees.
+			pose.yaw = glm::degrees(angle) + 180.0f;
+			pose.pitch = pitch;
+
+			path.AddKeyframe(orbitSeconds * i / keyframeCount, pose);
+		}
+
+		return path;
+	}
+
+	void Application::WriteBenchmarkReport(const std::string& filePath, const Utils::RollingStatistics& frameTimes) const
+	{
+		std::ofstream stream(filePath);
+
+		if (!stream)
+		{
+			const auto errorMessage = "Failed to open benchmark report for writing: " + filePath;
+			throw std::exception(errorMessage.c_str());
+		}
+
+		const auto writeStats = [&stream](const Utils::RollingStatistics& times)
+		{
+			stream << "{\"samples\": " << times.GetCount() <<
+				", \"average\": " << times.GetAverage() <<
+				", \"min\": " << times.GetMin() <<
+				", \"median\": " << times.GetPercentile(50.0) <<
+				", \"p95\": " << times.GetPercentile(95.0) <<
+				", \"p99\": " << times.GetPercentile(99.0) <<
+				", \"max\": " << times.GetMax() << "}";
+		};
+
+		const auto renderSize = GetRenderSize();
+
+		stream << "{\n" <<
+			"  \"map\": ";
+
+		Utils::WriteJsonString(stream, mapFilePath);
+
+		stream << ",\n" <<
+			"  \"headless\": " << (headless ? "true" : "false") << ",\n" <<
+			"  \"blockBackend\": " << (octree != nullptr ? "\"octree\"" : "\"world\"") << ",\n" <<
+			"  \"width\": " << renderSize.x << ",\n" <<
+			"  \"height\": " << renderSize.y << ",\n" <<
+			"  \"cameraPath\": ";
+
+		Utils::WriteJsonString(stream, cameraPathFilePath.empty() ? "orbit" : cameraPathFilePath);
+
+		stream << ",\n" <<
+			"  \"warmupFrames\": " << benchmarkWarmupFrames << ",\n" <<
+			"  \"frameTimeMs\": ";
+
+		writeStats(frameTimes);
+
+		stream << ",\n  \"gpuPassMs\": {";
+
+		for (size_t pass = 0; pass < gpuTimer->GetPassCount(); ++pass)
+		{
+			stream << (pass == 0 ? "\n" : ",\n") << "    ";
+			Utils::WriteJsonString(stream, gpuTimer->GetPassName(pass));
+			stream << ": ";
+			writeStats(gpuTimer->GetPassTimes(pass));
+		}
+
+		stream << "\n  },\n" <<
+			"  \"gpuSkippedQueries\": " << gpuTimer->GetSkippedQueries() << "\n" <<
+			"}\n";
+
+		if (stream.fail())
+		{
+			const auto errorMessage = "Failed to write benchmark report: " + filePath;
+			throw std::exception(errorMessage.c_str());
+		}
+	}
+
+	void Application::LoadMap() {
+		world.Clear();
+
+		mapReader = std::make_unique<Voxels::WorldFileReader>(mapFilePath);
+
+		const auto spawnBlock = glm::round(spawnPosition);
+
+		mapLoadCentre = Voxels::World::GetChunkCoord(
+			static_cast<int>(spawnBlock.x), static_cast<int>(spawnBlock.y), static_cast<int>(spawnBlock.z));
+
+		// Only the chunks around the spawn point are read before the first frame.
+		const auto loadedCount = mapReader->LoadChunksNear(world, mapLoadCentre, mapLoadRadius);
+
+		std::cout << "Loaded " << loadedCount << " of " << mapReader->GetChunkCount() << " chunks from " <<
+			mapFilePath << std::endl;
+
+		octree.reset();
+
+		if (useOctreeBackend)
+		{
+			octree = std::make_unique<Voxels::SparseVoxelOctree>(mapReader->ReadOctree());
+
+			std::cout << "Octree backend: " << octree->GetSize() << "^3 blocks in " << octree->GetNodeCount() <<
+				" nodes, " << octree->GetMemoryUsage() / 1024 << " KiB" << std::endl;
+		}
+	}
+
+	const Voxels::IBlockVolume& Application::GetBlockVolume() const
+	{
+		if (octree != nullptr)
+			return *octree;
+
+		return world;
 	}
 }
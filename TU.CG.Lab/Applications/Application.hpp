@@ -2,14 +2,32 @@
 
 #include <glm/glm.hpp>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "IApplication.hpp"
+#include "Graphics/ChunkMesh.hpp"
+#include "Graphics/FrameUniforms.hpp"
+#include "Graphics/Framebuffer.hpp"
+#include "Graphics/GpuTimer.hpp"
+#include "Graphics/InstancedBlockRenderer.hpp"
+#include "Graphics/ModelInstance.hpp"
 #include "Graphics/ShaderProgram.hpp"
-#include "Graphics/Texture.hpp"
+#include "Graphics/TextureArray.hpp"
+#include "Graphics/UniformBuffer.hpp"
 #include "Graphics/VertexArray.hpp"
 #include "Utils/Camera3D.hpp"
+#include "Utils/CameraPath.hpp"
+#include "Utils/CompletionQueue.hpp"
 #include "Utils/ContentManager.hpp"
+#include "Utils/FixedTimestep.hpp"
+#include "Utils/Frustum.hpp"
+#include "Utils/JobSystem.hpp"
 #include "Utils/Window.hpp"
+#include "Voxels/SparseVoxelOctree.hpp"
+#include "Voxels/World.hpp"
+#include "Voxels/WorldFile.hpp"
 
 #include "Graphics/Model.hpp"
 #include "Input/InputManager.hpp"
@@ -18,14 +36,49 @@ namespace Applications
 {
 	class Application : public IApplication
 	{
+		public:
+			// Render passes timed on the GPU, in the order GpuTimer reports them.
+			enum GpuPass : size_t
+			{
+				TERRAIN_PASS,
+				MODELS_PASS,
+				LIGHT_BOX_PASS,
+			};
+
+			struct CullingStats
+			{
+				size_t drawnChunks = 0;
+				size_t culledChunks = 0;
+				size_t drawnModels = 0;
+				size_t culledModels = 0;
+			};
+
+			// Milliseconds from the start of Run; negative until reached.
+			struct StartupStats
+			{
+				double firstFrameMilliseconds = -1.0;
+				double texturesResidentMilliseconds = -1.0;
+			};
 		private:
 			glm::vec3 lightPos;
-			std::unique_ptr<Graphics::Texture> boxDiffuseMap;
-			std::unique_ptr<Graphics::Texture> redstoneDiffuseMap;
-			std::unique_ptr<Graphics::Texture> boxSpecularMap;
-			std::unique_ptr<Graphics::Texture> redstoneSpecularMap;
-			std::unique_ptr<Graphics::Texture> goldDiffuseMap;
-			std::unique_ptr<Graphics::Texture> goldSpecularMap;
+			std::unique_ptr<Graphics::TextureArray> blockDiffuseMaps;
+			std::unique_ptr<Graphics::TextureArray> blockSpecularMaps;
+
+			struct ChunkMeshResult
+			{
+				Voxels::ChunkMeshData data;
+				unsigned version = 0;
+			};
+
+			// A placed block whose chunk mesh is still being rebuilt.
+			struct PendingBlock
+			{
+				glm::ivec3 position;
+				glm::ivec3 chunkCoord;
+				Voxels::BlockType type;
+				// Only a mesh scheduled after this one contains the block.
+				unsigned lastMeshVersion;
+			};
 
 		protected:
 			Input::InputManager inputManager;
@@ -33,30 +86,141 @@ namespace Applications
 
 			std::unique_ptr<Utils::Window> window;
 			std::unique_ptr<Utils::Camera3D> camera;
-			std::unique_ptr<Graphics::ShaderProgram> objectShader;
-			std::unique_ptr<Graphics::ShaderProgram> lightShader;
-			std::unique_ptr<Graphics::ShaderProgram> modelShader;
+			std::shared_ptr<Graphics::ShaderProgram> objectShader;
+			std::shared_ptr<Graphics::ShaderProgram> lightShader;
+			std::shared_ptr<Graphics::ShaderProgram> modelShader;
+			Graphics::UniformHandle objectModelUniform;
+			Graphics::UniformHandle objectNormalUniform;
+			Graphics::UniformHandle lightModelUniform;
+			Graphics::UniformHandle modelShaderModelUniform;
+			Graphics::UniformHandle modelShaderNormalUniform;
+			std::unique_ptr<Graphics::UniformBuffer> cameraUniforms;
+			std::unique_ptr<Graphics::UniformBuffer> lightUniforms;
 			std::unique_ptr<Graphics::VertexArray> objectVa;
 			std::unique_ptr<Graphics::VertexArray> lightVa;
 
-			std::unique_ptr<Graphics::Model> bed;
-			std::unique_ptr<Graphics::Model> torch;
+			// Placed blocks are drawn instanced until their chunk's new mesh is
+			// uploaded, so an edit shows up in the frame it happens.
+			std::shared_ptr<Graphics::ShaderProgram> instancedBlockShader;
+			std::unique_ptr<Graphics::InstancedBlockRenderer> dynamicBlocks;
+			std::vector<PendingBlock> pendingBlocks;
+
+			// Placed models; instances of one model share its buffers and textures.
+			std::vector<Graphics::ModelInstance> modelInstances;
+
+			Voxels::World world;
+			// With the octree backend every block read goes to the octree, which holds the
+			// whole map; the World still streams chunks to decide what gets meshed.
+			bool useOctreeBackend = false;
+			std::unique_ptr<Voxels::SparseVoxelOctree> octree;
+			std::unordered_map<glm::ivec3, std::unique_ptr<Graphics::ChunkMesh>, Voxels::ChunkCoordHash> chunkMeshes;
+			std::unordered_map<glm::ivec3, unsigned, Voxels::ChunkCoordHash> chunkMeshVersions;
+			unsigned lastChunkMeshVersion = 0;
+
+			// Per-frame culling scratch, kept to avoid reallocating every frame.
+			Utils::BoundingBoxList chunkBounds;
+			std::vector<const Graphics::ChunkMesh*> chunkDrawList;
+			std::vector<unsigned char> chunkVisibility;
+			CullingStats cullingStats;
+
+			std::unique_ptr<Graphics::GpuTimer> gpuTimer;
+			size_t gpuTimerHistorySize = 240;
 
-			int map[32][32][32];
-			int sizeX = 32;
-			int sizeY = 32;
-			int sizeZ = 6;
+			// Headless runs draw here instead of the hidden window's back buffer.
+			bool headless = false;
+			std::unique_ptr<Graphics::Framebuffer> offscreenTarget;
+			int benchmarkWarmupFrames = 30;
+
+			// Playback drives the camera from a path file instead of the input;
+			// recording samples the live camera into one, saved on exit.
+			std::string cameraPathFilePath;
+			std::string recordPathFilePath;
+			double recordPathInterval = 0.1;
+
+			// Declared before the job system, so workers are joined before it goes away.
+			Utils::CompletionQueue<ChunkMeshResult> chunkMeshResults;
+			std::unique_ptr<Utils::JobSystem> jobSystem;
+
+			std::string mapFilePath = "Content/Maps/default.world";
+			// Map chunks are read around the camera as it moves; the radius, in chunks,
+			// reaches past the far plane so no unloaded chunk is ever in view. Chunks are
+			// dropped again once they lie the margin beyond it.
+			std::unique_ptr<Voxels::WorldFileReader> mapReader;
+			int mapLoadRadius = 7;
+			int mapUnloadMargin = 2;
+			glm::ivec3 mapLoadCentre = glm::ivec3(0);
+			glm::vec3 spawnPosition = glm::vec3(0.0f, 0.0f, 3.0f);
+
+			// Left click breaks the block under the crosshair, right click places one against it.
+			float blockReach = 6.0f;
+			Voxels::BlockType placeBlockType = Voxels::Blocks::STONE;
+
+			// Per-frame limits on dirty chunks sent to the workers and on the time
+			// spent uploading finished meshes.
+			size_t maxChunkJobsPerFrame = 16;
+			double maxChunkUploadMillisecondsPerFrame = 2.0;
+			// Decoded textures swapped in per frame, so big images do not stall one frame.
+			double maxTextureUploadMillisecondsPerFrame = 2.0;
+			StartupStats startupStats;
+			// Mip chains baked from the source images on first use; empty to decode every launch.
+			std::string textureBakeDirectory = "Cache/Textures";
+			// Imported models kept in binary form, so later runs skip Assimp.
+			std::string modelCacheDirectory = "Cache/Models";
+			// Linked programs saved by the driver, so later runs compile no GLSL.
+			std::string shaderBinaryDirectory = "Cache/Shaders";
+
+			double simulationTicksPerSecond = 60.0;
+			int maxSimulationTicksPerFrame = 8;
+
+			Utils::VSyncMode vSyncMode = Utils::VSyncMode::ON;
+			// Frames per second; 0 leaves the rate to vsync alone.
+			double frameCap = 0.0;
 
 			void Initialize();
 			void LoadContent();
 			void UnloadContent();
+			// Input handled once per rendered frame.
+			void UpdateFrame();
+			// Game logic, run at the fixed simulation rate.
 			void Update(float deltaTime);
-			void Render() const;
+			void UpdateBlockInteraction();
+			// Sets a block in the world and shows it before its chunk is re-meshed.
+			void EditBlock(const glm::ivec3& position, Voxels::BlockType type);
+			void UpdateDynamicBlocks();
+			void Render();
 			void LoadMap();
+			[[nodiscard]] const Voxels::IBlockVolume& GetBlockVolume() const;
+			void BuildChunkMeshes();
+			void RebuildDirtyChunks();
+			void StreamMapChunks(const glm::ivec3& focus);
+			void ScheduleChunkMesh(const glm::ivec3& chunkCoord);
+			void UploadChunkMeshes(double budgetMilliseconds);
+			void LoadBlockMaterials();
+			void PrintFrameStats() const;
+			[[nodiscard]] glm::vec2 GetRenderSize() const;
+			[[nodiscard]] Utils::BoundingBox GetTerrainBounds() const;
+			[[nodiscard]] static Utils::CameraPath MakeOrbitPath(const Utils::BoundingBox& bounds);
+			void WriteBenchmarkReport(const std::string& filePath, const Utils::RollingStatistics& frameTimes) const;
 		public:
-			Application();
+			explicit Application(bool headless = false);
 
 			void Run();
+			// Renders frameCount frames along a fixed path as fast as possible and
+			// writes the frame-time statistics to filePath as JSON.
+			void RunBenchmark(int frameCount, const std::string& filePath);
+
+			void SetVSyncMode(const Utils::VSyncMode mode) { vSyncMode = mode; }
+			void SetFrameCap(const double framesPerSecond) { frameCap = framesPerSecond; }
+			void SetCameraPath(const std::string& filePath) { cameraPathFilePath = filePath; }
+			void SetRecordPath(const std::string& filePath) { recordPathFilePath = filePath; }
+			// Reads blocks from a sparse voxel octree instead of the chunked World.
+			void SetOctreeBackend(const bool enabled) { useOctreeBackend = enabled; }
+
+			// Counts from the last rendered frame.
+			[[nodiscard]] const CullingStats& GetCullingStats() const { return cullingStats; }
+			[[nodiscard]] const StartupStats& GetStartupStats() const { return startupStats; }
+			// Results arrive a few frames late; null before content is loaded.
+			[[nodiscard]] const Graphics::GpuTimer* GetGpuTimer() const { return gpuTimer.get(); }
 
 		Input::InputManager& GetInputManager() override
 		{
@@ -0,0 +1,60 @@
+#include "Benchmarks.hpp"
+
+#include <iostream>
+#include <utility>
+
+#include "CameraPathBenchmark.hpp"
+#include "ChunkStorageBenchmark.hpp"
+#include "CullingBenchmark.hpp"
+#include "FramePacingBenchmark.hpp"
+#include "JobSystemBenchmark.hpp"
+#include "MesherBenchmark.hpp"
+#include "ModelCacheBenchmark.hpp"
+#include "OctreeBenchmark.hpp"
+#include "PhysicsBenchmark.hpp"
+#include "ProfilerBenchmark.hpp"
+#include "RaycastBenchmark.hpp"
+#include "TextureBakeBenchmark.hpp"
+#include "WorldFileBenchmark.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		const std::pair<const char*, BenchmarkFunction> benchmarks[] =
+		{
+			{ "mesher", RunMesherBenchmark },
+			{ "jobs", RunJobSystemBenchmark },
+			{ "culling", RunCullingBenchmark },
+			{ "worldfile", RunWorldFileBenchmark },
+			{ "storage", RunChunkStorageBenchmark },
+			{ "octree", RunOctreeBenchmark },
+			{ "raycast", RunRaycastBenchmark },
+			{ "physics", RunPhysicsBenchmark },
+			{ "pacing", RunFramePacingBenchmark },
+			{ "profiler", RunProfilerBenchmark },
+			{ "camerapath", RunCameraPathBenchmark },
+			{ "texturebake", RunTextureBakeBenchmark },
+			{ "modelcache", RunModelCacheBenchmark },
+		};
+	}
+
+	BenchmarkFunction FindBenchmark(const std::string& name)
+	{
+		for (const auto& [benchmarkName, function] : benchmarks)
+		{
+			if (name == benchmarkName)
+				return function;
+		}
+
+		return nullptr;
+	}
+
+	void PrintBenchmarks()
+	{
+		std::cout << "Available benchmarks:" << std::endl;
+
+		for (const auto& [benchmarkName, function] : benchmarks)
+			std::cout << "  --bench " << benchmarkName << std::endl;
+	}
+}
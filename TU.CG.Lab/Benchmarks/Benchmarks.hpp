@@ -0,0 +1,12 @@
+#pragma once
+
+#include <string>
+
+namespace Benchmarks
+{
+	using BenchmarkFunction = void (*)();
+
+	// Headless benchmarks; none of them create a window or a GL context.
+	[[nodiscard]] BenchmarkFunction FindBenchmark(const std::string& name);
+	void PrintBenchmarks();
+}
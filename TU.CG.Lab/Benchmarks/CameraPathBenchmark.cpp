@@ -0,0 +1,146 @@
+#include "CameraPathBenchmark.hpp"
+
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "Checker.hpp"
+#include "Stopwatch.hpp"
+#include "Utils/CameraPath.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr Checker checker("Camera path");
+
+		bool IsNear(const Utils::CameraPose& a, const Utils::CameraPose& b, const float tolerance = 1e-4f)
+		{
+			return glm::all(glm::lessThan(glm::abs(a.position - b.position), glm::vec3(tolerance))) &&
+				glm::abs(a.yaw - b.yaw) < tolerance && glm::abs(a.pitch - b.pitch) < tolerance &&
+				glm::abs(a.zoom - b.zoom) < tolerance;
+		}
+
+		Utils::CameraPath MakePath()
+		{
+			Utils::CameraPath path;
+
+			for (int i = 0; i < 16; ++i)
+			{
+				Utils::CameraPose pose;
+				pose.position = glm::vec3(i * 2.0f, 3.0f + (i % 3), -i * 1.5f);
+				pose.yaw = -90.0f + i * 30.0f;
+				pose.pitch = -10.0f + (i % 4) * 5.0f;
+				pose.zoom = 45.0f - (i % 2) * 10.0f;
+
+				// Uneven spacing, like a recording with dropped frames.
+				path.AddKeyframe(i * 0.5 + (i % 3) * 0.1, pose);
+			}
+
+			return path;
+		}
+
+		void CheckSampling()
+		{
+			const auto path = MakePath();
+			const auto& keyframes = path.GetKeyframes();
+
+			for (const auto& [time, pose] : keyframes)
+				checker.Expect(IsNear(path.Sample(time), pose), "the path must pass through every keyframe");
+
+			checker.Expect(IsNear(path.Sample(-5.0), keyframes.front().pose), "times before the path must hold the first pose");
+			checker.Expect(IsNear(path.Sample(100.0), keyframes.back().pose), "times after the path must hold the last pose");
+
+			// Straight, evenly timed motion must stay straight and even.
+			Utils::CameraPath line;
+
+			for (int i = 0; i < 4; ++i)
+			{
+				Utils::CameraPose pose;
+				pose.position = glm::vec3(static_cast<float>(i), 0.0f, 0.0f);
+				line.AddKeyframe(i, pose);
+			}
+
+			checker.Expect(glm::abs(line.Sample(1.25).position.x - 1.25f) < 1e-5f, "linear motion must interpolate linearly");
+
+			bool threw = false;
+
+			try
+			{
+				line.AddKeyframe(1.0, Utils::CameraPose());
+			}
+			catch (const std::exception&)
+			{
+				threw = true;
+			}
+
+			checker.Expect(threw, "keyframes out of order must be rejected");
+		}
+
+		void CheckFileRoundTrip()
+		{
+			const auto path = MakePath();
+			const auto filePath = (std::filesystem::temp_directory_path() / "camera_path_benchmark.path").string();
+
+			path.Save(filePath);
+			const auto loaded = Utils::CameraPath::Load(filePath);
+			std::filesystem::remove(filePath);
+
+			checker.Expect(loaded.GetKeyframeCount() == path.GetKeyframeCount(), "a saved path must load every keyframe");
+
+			for (double time = -1.0; time < path.GetEndTime() + 1.0; time += 0.01)
+				checker.Expect(IsNear(loaded.Sample(time), path.Sample(time), 1e-3f), "a loaded path must sample like the original");
+		}
+
+		void CheckRecorder()
+		{
+			Utils::CameraPathRecorder recorder(0.1);
+
+			// A 144 Hz session: poses are kept at most every 0.1 seconds.
+			for (int frame = 0; frame < 144 * 2; ++frame)
+			{
+				Utils::CameraPose pose;
+				pose.position.x = frame / 144.0f;
+				recorder.Record(frame / 144.0, pose);
+			}
+
+			const auto& path = recorder.GetPath();
+
+			checker.Expect(path.GetKeyframeCount() >= 19 && path.GetKeyframeCount() <= 21, "the recorder must keep one pose per interval");
+			checker.Expect(glm::abs(path.Sample(1.0).position.x - 1.0f) < 1e-3f, "a recorded path must replay the motion");
+		}
+	}
+
+	void RunCameraPathBenchmark()
+	{
+		CheckSampling();
+		CheckFileRoundTrip();
+		CheckRecorder();
+
+		std::cout << "Camera path checks passed." << std::endl;
+
+		Utils::CameraPath path;
+
+		for (int i = 0; i < 3600; ++i)
+		{
+			Utils::CameraPose pose;
+			pose.position = glm::vec3(std::sin(i * 0.1f), 2.0f, std::cos(i * 0.1f)) * 10.0f;
+			path.AddKeyframe(i * 0.1, pose);
+		}
+
+		constexpr int sampleCount = 1 << 20;
+		float checksum = 0.0f;
+
+		const Stopwatch stopwatch;
+
+		for (int i = 0; i < sampleCount; ++i)
+			checksum += path.Sample(path.GetEndTime() * i / sampleCount).position.x;
+
+		const auto milliseconds = stopwatch.GetElapsedMilliseconds();
+
+		std::cout << std::fixed << std::setprecision(2) <<
+			"path of " << path.GetKeyframeCount() << " keyframes: sample = " << milliseconds * 1e6 / sampleCount <<
+			" ns (checksum " << checksum << ")" << std::endl;
+	}
+}
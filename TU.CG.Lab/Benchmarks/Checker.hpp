@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+
+namespace Benchmarks
+{
+	// Fails a benchmark with "<area> check failed: <message>".
+	class Checker
+	{
+		private:
+			const char* area;
+		public:
+			explicit constexpr Checker(const char* area) : area(area) {}
+
+			void Expect(const bool condition, const std::string& message) const
+			{
+				if (!condition)
+				{
+					const auto errorMessage = std::string(area) + " check failed: " + message;
+					throw std::exception(errorMessage.c_str());
+				}
+			}
+	};
+}
@@ -0,0 +1,162 @@
+#include "ChunkStorageBenchmark.hpp"
+
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Checker.hpp"
+#include "Stopwatch.hpp"
+#include "Voxels/BuiltinMap.hpp"
+#include "Voxels/PaletteStorage.hpp"
+#include "Voxels/TerrainGenerator.hpp"
+#include "Voxels/World.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		using DenseBlocks = std::array<Voxels::BlockType, Voxels::CHUNK_VOLUME>;
+
+		constexpr Checker checker("Chunk storage");
+
+		void CheckWidening()
+		{
+			Voxels::PaletteStorage storage(Voxels::CHUNK_VOLUME);
+
+			checker.Expect(storage.GetBitsPerIndex() == 0, "a uniform storage must hold no indices");
+
+			// Types 1..16 plus air take 17 entries, stepping through every width.
+			for (unsigned type = 1; type <= 16; ++type)
+			{
+				storage.Set(type * 97, static_cast<Voxels::BlockType>(type));
+
+				for (unsigned previous = 1; previous <= type; ++previous)
+					checker.Expect(storage.Get(previous * 97) == previous, "widening must keep earlier blocks");
+			}
+
+			checker.Expect(storage.GetBitsPerIndex() == 8, "17 types must need 8 bits");
+			checker.Expect(storage.Get(0) == Voxels::Blocks::AIR, "untouched blocks must stay air");
+
+			for (unsigned type = 2; type <= 16; ++type)
+				storage.Set(type * 97, Voxels::Blocks::AIR);
+
+			storage.Compact();
+
+			checker.Expect(storage.GetPaletteSize() == 2 && storage.GetBitsPerIndex() == 1, "compacting must narrow to 1 bit");
+			checker.Expect(storage.Get(97) == 1 && storage.Get(2 * 97) == Voxels::Blocks::AIR, "compacting must keep blocks");
+
+			DenseBlocks decoded;
+			storage.CopyTo(decoded.data());
+
+			for (int i = 0; i < Voxels::CHUNK_VOLUME; ++i)
+				checker.Expect(decoded[i] == storage.Get(i), "bulk decoding must match single reads");
+		}
+
+		void Measure(const std::string& name, const Voxels::World& world)
+		{
+			std::vector<DenseBlocks> dense;
+			std::vector<Voxels::PaletteStorage> packed;
+
+			size_t packedBytes = 0;
+			size_t bitHistogram[9] = {};
+
+			for (const auto& [chunkCoord, chunk] : world)
+			{
+				auto& blocks = dense.emplace_back();
+				chunk->CopyBlocks(blocks);
+
+				auto& storage = packed.emplace_back(Voxels::CHUNK_VOLUME);
+
+				for (int i = 0; i < Voxels::CHUNK_VOLUME; ++i)
+					storage.Set(i, blocks[i]);
+
+				storage.Compact();
+
+				packedBytes += sizeof(Voxels::PaletteStorage) + storage.GetMemoryUsage();
+				++bitHistogram[storage.GetBitsPerIndex()];
+			}
+
+			const auto chunkCount = dense.size();
+			const auto denseBytes = chunkCount * sizeof(DenseBlocks);
+
+			std::cout << std::fixed << std::setprecision(2) <<
+				name << ": chunks = " << chunkCount <<
+				", int array = " << denseBytes * sizeof(int) / 1024.0 << " KiB" <<
+				", byte array = " << denseBytes / 1024.0 << " KiB" <<
+				", paletted = " << packedBytes / 1024.0 << " KiB" <<
+				" (0/1/2/4/8 bits: " << bitHistogram[0] << "/" << bitHistogram[1] << "/" <<
+				bitHistogram[2] << "/" << bitHistogram[4] << "/" << bitHistogram[8] << ")" << std::endl;
+
+			constexpr int reads = 1 << 22;
+
+			std::mt19937 random(42);
+			std::vector<std::pair<unsigned, unsigned>> positions(reads);
+
+			for (auto& [chunk, block] : positions)
+			{
+				chunk = static_cast<unsigned>(random() % chunkCount);
+				block = static_cast<unsigned>(random() % Voxels::CHUNK_VOLUME);
+			}
+
+			unsigned denseSum = 0, packedSum = 0;
+
+			const Stopwatch denseStopwatch;
+
+			for (const auto& [chunk, block] : positions)
+				denseSum += dense[chunk][block];
+
+			const auto denseRead = denseStopwatch.GetElapsedMilliseconds();
+
+			const Stopwatch packedStopwatch;
+
+			for (const auto& [chunk, block] : positions)
+				packedSum += packed[chunk].Get(block);
+
+			const auto packedRead = packedStopwatch.GetElapsedMilliseconds();
+
+			checker.Expect(denseSum == packedSum, "random reads must agree");
+
+			DenseBlocks decoded;
+			const Stopwatch decodeStopwatch;
+
+			for (size_t i = 0; i < chunkCount; ++i)
+			{
+				packed[i].CopyTo(decoded.data());
+				checker.Expect(decoded == dense[i], "bulk decoding must match the array");
+			}
+
+			const auto decodeMilliseconds = decodeStopwatch.GetElapsedMilliseconds();
+
+			const Stopwatch writeStopwatch;
+
+			for (const auto& [chunk, block] : positions)
+				packed[chunk].Set(block, static_cast<Voxels::BlockType>(block & 3));
+
+			const auto packedWrite = writeStopwatch.GetElapsedMilliseconds();
+
+			std::cout << std::setprecision(2) <<
+				"  random get: array = " << denseRead * 1e6 / reads << " ns" <<
+				", paletted = " << packedRead * 1e6 / reads << " ns" << std::endl <<
+				"  random set (paletted) = " << packedWrite * 1e6 / reads << " ns" <<
+				", bulk decode = " << decodeMilliseconds * 1e3 / chunkCount << " us/chunk" << std::endl;
+		}
+	}
+
+	void RunChunkStorageBenchmark()
+	{
+		CheckWidening();
+
+		std::cout << "Chunk storage checks passed." << std::endl;
+
+		Voxels::World builtin;
+		Voxels::BuiltinMap::Build(builtin);
+		Measure("builtin map", builtin);
+
+		Voxels::World hills;
+		Voxels::TerrainGenerator::GenerateHills(hills, glm::ivec3(256, 64, 256), 1337);
+		Measure("hills 256x64x256", hills);
+	}
+}
@@ -0,0 +1,115 @@
+#include "CullingBenchmark.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Checker.hpp"
+#include "Stopwatch.hpp"
+#include "Utils/Frustum.hpp"
+#include "Voxels/Chunk.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr Checker checker("Culling");
+
+		Utils::Frustum MakeFrustum(const glm::vec3& position, const glm::vec3& front)
+		{
+			const auto view = glm::lookAt(position, position + front, glm::vec3(0.0f, 1.0f, 0.0f));
+			const auto projection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+
+			return Utils::Frustum(projection * view);
+		}
+
+		void CheckSimpleBoxes()
+		{
+			const auto frustum = MakeFrustum(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f));
+			const Utils::BoundingBox unitBox(glm::vec3(-0.5f), glm::vec3(0.5f));
+
+			const auto at = [&unitBox](const glm::vec3& position)
+			{
+				return unitBox.Transform(glm::translate(glm::mat4(1.0f), position));
+			};
+
+			checker.Expect(frustum.Intersects(at(glm::vec3(0.0f, 0.0f, -10.0f))), "a box ahead must be visible");
+			checker.Expect(!frustum.Intersects(at(glm::vec3(0.0f, 0.0f, 10.0f))), "a box behind must be culled");
+			checker.Expect(!frustum.Intersects(at(glm::vec3(0.0f, 0.0f, -200.0f))), "a box past the far plane must be culled");
+			checker.Expect(!frustum.Intersects(at(glm::vec3(50.0f, 0.0f, -10.0f))), "a box far to the side must be culled");
+		}
+	}
+
+	void RunCullingBenchmark()
+	{
+		CheckSimpleBoxes();
+
+		std::cout << "Culling checks passed." << std::endl;
+
+		// Chunk bounds of a 64x8x64 chunk world, seen from its middle.
+		Utils::BoundingBoxList boxes;
+		constexpr int chunksPerSide = 64;
+		constexpr int chunkLayers = 8;
+		constexpr auto size = static_cast<float>(Voxels::CHUNK_SIZE);
+
+		boxes.Reserve(chunksPerSide * chunksPerSide * chunkLayers);
+
+		for (int x = 0; x < chunksPerSide; ++x)
+			for (int y = 0; y < chunkLayers; ++y)
+				for (int z = 0; z < chunksPerSide; ++z)
+				{
+					const auto origin = glm::vec3(x, y, z) * size - 0.5f;
+					boxes.Add({ origin, origin + size });
+				}
+
+		const glm::vec3 centre(chunksPerSide * size / 2.0f, chunkLayers * size / 2.0f, chunksPerSide * size / 2.0f);
+		const auto frustum = MakeFrustum(centre, glm::normalize(glm::vec3(1.0f, -0.2f, 0.5f)));
+
+		std::vector<unsigned char> visible;
+		const auto batchVisible = frustum.CullBatch(boxes, visible);
+
+		size_t scalarVisible = 0;
+
+		for (size_t i = 0; i < boxes.GetSize(); ++i)
+		{
+			const auto isVisible = frustum.Intersects(boxes.Get(i));
+			scalarVisible += isVisible;
+
+			checker.Expect(isVisible == (visible[i] != 0), "batch and scalar tests must agree");
+		}
+
+		checker.Expect(batchVisible == scalarVisible, "batch and scalar counts must agree");
+
+		constexpr int repeats = 200;
+		const auto boxCount = static_cast<double>(boxes.GetSize() * repeats);
+
+		const Stopwatch scalarStopwatch;
+		size_t scalarTotal = 0;
+
+		for (int repeat = 0; repeat < repeats; ++repeat)
+			for (size_t i = 0; i < boxes.GetSize(); ++i)
+				scalarTotal += frustum.Intersects(boxes.Get(i));
+
+		const auto scalarMilliseconds = scalarStopwatch.GetElapsedMilliseconds();
+
+		const Stopwatch batchStopwatch;
+		size_t batchTotal = 0;
+
+		for (int repeat = 0; repeat < repeats; ++repeat)
+			batchTotal += frustum.CullBatch(boxes, visible);
+
+		const auto batchMilliseconds = batchStopwatch.GetElapsedMilliseconds();
+
+		checker.Expect(scalarTotal == batchTotal, "timed runs must agree");
+
+		std::cout << std::fixed << std::setprecision(2) <<
+			"boxes = " << boxes.GetSize() <<
+			", visible = " << batchVisible << std::endl <<
+			"scalar: " << scalarMilliseconds * 1e6 / boxCount << " ns/box" << std::endl <<
+			"batch:  " << batchMilliseconds * 1e6 / boxCount << " ns/box" <<
+			", speedup = " << scalarMilliseconds / batchMilliseconds << "x" << std::endl;
+	}
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Benchmarks
+{
+	void RunCullingBenchmark();
+}
@@ -0,0 +1,83 @@
+#include "FramePacingBenchmark.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "Checker.hpp"
+#include "Stopwatch.hpp"
+#include "Utils/FramePacer.hpp"
+#include "Utils/RollingStatistics.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr Checker checker("Frame pacing");
+
+		void CheckStatistics()
+		{
+			Utils::RollingStatistics statistics(4);
+
+			checker.Expect(statistics.GetAverage() == 0.0 && statistics.GetPercentile(99.0) == 0.0, "empty statistics must read zero");
+
+			for (const auto sample : { 100.0, 1.0, 2.0, 3.0, 4.0 })
+				statistics.Add(sample);
+
+			checker.Expect(statistics.GetCount() == 4 && statistics.GetTotalCount() == 5, "the window must hold the newest samples");
+			checker.Expect(statistics.GetLast() == 4.0, "the last sample must be the newest");
+			checker.Expect(statistics.GetAverage() == 2.5, "the oldest sample must fall out of the average");
+			checker.Expect(statistics.GetMin() == 1.0 && statistics.GetMax() == 4.0, "min and max must cover the window");
+			checker.Expect(statistics.GetPercentile(50.0) == 2.0 && statistics.GetPercentile(100.0) == 4.0,
+				"percentiles must use the nearest rank");
+		}
+
+		void Measure(const std::string& name, const double framesPerSecond, const std::chrono::microseconds spinThreshold)
+		{
+			constexpr int frameCount = 240;
+
+			Utils::FramePacer pacer;
+			pacer.SetSpinThreshold(spinThreshold);
+			pacer.SetTargetFrameRate(framesPerSecond);
+
+			Utils::RollingStatistics frameTimes(frameCount);
+			Stopwatch frameStopwatch;
+			const Stopwatch totalStopwatch;
+
+			for (int frame = 0; frame < frameCount; ++frame)
+			{
+				pacer.Wait();
+
+				frameTimes.Add(frameStopwatch.GetElapsedMilliseconds());
+				frameStopwatch.Restart();
+			}
+
+			const auto totalMilliseconds = totalStopwatch.GetElapsedMilliseconds();
+			const auto targetMilliseconds = 1000.0 / framesPerSecond;
+
+			std::cout << std::fixed << std::setprecision(3) <<
+				name << ": target = " << targetMilliseconds << " ms" <<
+				", average = " << frameTimes.GetAverage() << " ms" <<
+				", median = " << frameTimes.GetPercentile(50.0) << " ms" <<
+				", 99th = " << frameTimes.GetPercentile(99.0) << " ms" <<
+				", rate = " << frameCount * 1000.0 / totalMilliseconds << " fps" << std::endl;
+
+			// Deadlines advance by whole periods, so the average holds even when single frames slip.
+			checker.Expect(std::abs(frameTimes.GetAverage() - targetMilliseconds) < targetMilliseconds * 0.1,
+				"the capped rate must stay near the target");
+		}
+	}
+
+	void RunFramePacingBenchmark()
+	{
+		CheckStatistics();
+
+		std::cout << "Frame pacing checks passed." << std::endl;
+
+		Measure("sleep only, 240 fps", 240.0, std::chrono::microseconds(0));
+		Measure("sleep + spin, 240 fps", 240.0, std::chrono::microseconds(500));
+		Measure("sleep + spin, 60 fps", 60.0, std::chrono::microseconds(500));
+	}
+}
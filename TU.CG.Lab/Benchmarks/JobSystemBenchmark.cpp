@@ -0,0 +1,90 @@
+#include "JobSystemBenchmark.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "Stopwatch.hpp"
+#include "Utils/CompletionQueue.hpp"
+#include "Utils/JobSystem.hpp"
+#include "Voxels/ChunkMesher.hpp"
+#include "Voxels/TerrainGenerator.hpp"
+#include "Voxels/World.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		double MeshAll(
+			const std::vector<Voxels::ChunkNeighbourhood>& neighbourhoods,
+			const unsigned threadCount, size_t& triangleCount)
+		{
+			Utils::JobSystem jobSystem(threadCount);
+			Utils::CompletionQueue<Voxels::ChunkMeshData> results;
+
+			const Stopwatch stopwatch;
+
+			for (const auto& neighbourhood : neighbourhoods)
+			{
+				jobSystem.Submit([&results, &neighbourhood]
+				{
+					results.Push(Voxels::ChunkMesher::Build(neighbourhood));
+				});
+			}
+
+			jobSystem.WaitIdle();
+
+			const auto elapsed = stopwatch.GetElapsedMilliseconds();
+
+			triangleCount = 0;
+			Voxels::ChunkMeshData mesh;
+
+			while (results.TryPop(mesh))
+				triangleCount += mesh.GetTriangleCount();
+
+			return elapsed;
+		}
+	}
+
+	void RunJobSystemBenchmark()
+	{
+		Voxels::World world;
+		Voxels::TerrainGenerator::GenerateHills(world, glm::ivec3(256, 64, 256), 1337);
+
+		std::vector<Voxels::ChunkNeighbourhood> neighbourhoods;
+		neighbourhoods.reserve(world.GetChunkCount());
+
+		for (const auto& [chunkCoord, chunk] : world)
+			neighbourhoods.push_back(Voxels::ChunkMesher::Gather(world, chunkCoord));
+
+		const auto hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+		std::vector<unsigned> threadCounts = { 1, 2, 4, hardwareThreads };
+		std::sort(threadCounts.begin(), threadCounts.end());
+		threadCounts.erase(std::unique(threadCounts.begin(), threadCounts.end()), threadCounts.end());
+
+		std::cout << "Meshing " << neighbourhoods.size() << " chunks" << std::endl;
+
+		double singleThreaded = 0.0;
+
+		for (const auto threadCount : threadCounts)
+		{
+			size_t triangleCount = 0;
+			auto best = MeshAll(neighbourhoods, threadCount, triangleCount);
+
+			for (int i = 0; i < 4; ++i)
+				best = std::min(best, MeshAll(neighbourhoods, threadCount, triangleCount));
+
+			if (threadCount == 1)
+				singleThreaded = best;
+
+			std::cout << std::fixed << std::setprecision(2) <<
+				"threads = " << threadCount <<
+				", time = " << best << " ms" <<
+				", speedup = " << singleThreaded / best << "x" <<
+				", triangles = " << triangleCount << std::endl;
+		}
+	}
+}
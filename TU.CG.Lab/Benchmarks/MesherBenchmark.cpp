@@ -0,0 +1,126 @@
+#include "MesherBenchmark.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Checker.hpp"
+#include "Stopwatch.hpp"
+#include "Voxels/ChunkMesher.hpp"
+#include "Voxels/TerrainGenerator.hpp"
+#include "Voxels/World.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr Checker checker("Mesher");
+
+		void CheckSolidChunk()
+		{
+			Voxels::World world;
+
+			for (int y = 0; y < Voxels::CHUNK_SIZE; ++y)
+				for (int z = 0; z < Voxels::CHUNK_SIZE; ++z)
+					for (int x = 0; x < Voxels::CHUNK_SIZE; ++x)
+						world.SetBlock(x, y, z, Voxels::Blocks::STONE);
+
+			const auto mesh = Voxels::ChunkMesher::Build(world, glm::ivec3(0));
+
+			checker.Expect(mesh.GetTriangleCount() == 12, "a solid chunk must mesh to 6 quads");
+		}
+
+		void CheckChunkBorders()
+		{
+			Voxels::World world;
+
+			// Two touching blocks in different chunks share no visible face.
+			world.SetBlock(Voxels::CHUNK_SIZE - 1, 0, 0, Voxels::Blocks::STONE);
+			world.SetBlock(Voxels::CHUNK_SIZE, 0, 0, Voxels::Blocks::GOLD);
+
+			const auto left = Voxels::ChunkMesher::Build(world, glm::ivec3(0, 0, 0));
+			const auto right = Voxels::ChunkMesher::Build(world, glm::ivec3(1, 0, 0));
+
+			checker.Expect(left.GetTriangleCount() == 10, "border face must be culled in the left chunk");
+			checker.Expect(right.GetTriangleCount() == 10, "border face must be culled in the right chunk");
+		}
+
+		void CheckDirtyTracking()
+		{
+			Voxels::World world;
+
+			world.SetBlock(0, 0, 0, Voxels::Blocks::STONE);
+			world.SetBlock(Voxels::CHUNK_SIZE, 0, 0, Voxels::Blocks::STONE);
+			world.ClearDirtyChunks();
+
+			world.SetBlock(5, 5, 5, Voxels::Blocks::GOLD);
+			checker.Expect(world.GetDirtyChunkCount() == 1, "an interior edit must dirty one chunk");
+
+			world.ClearDirtyChunks();
+			world.ClearBlock(Voxels::CHUNK_SIZE - 1, 0, 0);
+			world.SetBlock(Voxels::CHUNK_SIZE - 1, 0, 0, Voxels::Blocks::STONE);
+			checker.Expect(world.GetDirtyChunkCount() == 2, "a border edit must dirty the neighbour too");
+
+			const auto taken = world.TakeDirtyChunks(1, glm::ivec3(1, 0, 0));
+			checker.Expect(taken.size() == 1 && taken.front() == glm::ivec3(1, 0, 0), "nearest dirty chunk must come first");
+			checker.Expect(world.GetDirtyChunkCount() == 1, "taken chunks must leave the dirty set");
+		}
+
+		void MeasureWorld(const std::string& name, const Voxels::World& world)
+		{
+			constexpr int iterations = 10;
+
+			size_t naiveTriangles = 0;
+
+			for (const auto& [chunkCoord, chunk] : world)
+			{
+				const auto neighbourhood = Voxels::ChunkMesher::Gather(world, chunkCoord);
+				naiveTriangles += Voxels::ChunkMesher::CountVisibleFaces(neighbourhood) * 2;
+			}
+
+			size_t builtTriangles = 0;
+			const Stopwatch stopwatch;
+
+			for (int i = 0; i < iterations; ++i)
+			{
+				for (const auto& [chunkCoord, chunk] : world)
+					builtTriangles += Voxels::ChunkMesher::Build(world, chunkCoord).GetTriangleCount();
+			}
+
+			const auto greedyTriangles = builtTriangles / iterations;
+			const auto chunkCount = world.GetChunkCount();
+			const auto perChunk = stopwatch.GetElapsedMilliseconds() /
+				static_cast<double>(iterations * chunkCount);
+
+			std::cout << std::fixed << std::setprecision(3) <<
+				name << ": chunks = " << chunkCount <<
+				", per-face triangles = " << naiveTriangles <<
+				", greedy triangles = " << greedyTriangles <<
+				", meshing = " << perChunk << " ms/chunk" << std::endl;
+		}
+	}
+
+	void RunMesherBenchmark()
+	{
+		CheckSolidChunk();
+		CheckChunkBorders();
+		CheckDirtyTracking();
+
+		std::cout << "Mesher checks passed." << std::endl;
+
+		Voxels::World checkerboard;
+
+		for (int y = 0; y < Voxels::CHUNK_SIZE; ++y)
+			for (int z = 0; z < Voxels::CHUNK_SIZE; ++z)
+				for (int x = 0; x < Voxels::CHUNK_SIZE; ++x)
+					if ((x + y + z) % 2 == 0)
+						checkerboard.SetBlock(x, y, z, Voxels::Blocks::STONE);
+
+		Voxels::World hills;
+		Voxels::TerrainGenerator::GenerateHills(hills, glm::ivec3(128, 48, 128), 1337);
+
+		MeasureWorld("checkerboard", checkerboard);
+		MeasureWorld("hills 128x48x128", hills);
+	}
+}
@@ -0,0 +1,112 @@
+#include "ModelCacheBenchmark.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "Checker.hpp"
+#include "Stopwatch.hpp"
+#include "Graphics/ModelLoader.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr int repeatCount = 5;
+
+		constexpr Checker checker("Model cache");
+
+		void ExpectSameModel(const Graphics::ModelFile& imported, const Graphics::ModelFile& cached, const std::string& name)
+		{
+			checker.Expect(imported.GetMeshes().size() == cached.GetMeshes().size(), name + " must keep its mesh count");
+
+			for (size_t i = 0; i < imported.GetMeshes().size(); ++i)
+			{
+				const auto& left = imported.GetMeshes()[i];
+				const auto& right = cached.GetMeshes()[i];
+
+				checker.Expect(left.vertices.size() == right.vertices.size() &&
+					std::memcmp(left.vertices.data(), right.vertices.data(), left.vertices.size_bytes()) == 0,
+					name + " must keep its vertices");
+				checker.Expect(left.indices.size() == right.indices.size() &&
+					std::memcmp(left.indices.data(), right.indices.data(), left.indices.size_bytes()) == 0,
+					name + " must keep its indices");
+				checker.Expect(left.texturePaths == right.texturePaths, name + " must keep its texture paths");
+				checker.Expect(left.bounds.min == right.bounds.min && left.bounds.max == right.bounds.max,
+					name + " must keep its bounds");
+			}
+		}
+
+		void TimeModel(const std::string& modelFilePath, const std::string& cacheDirectory)
+		{
+			const Stopwatch importStopwatch;
+
+			for (int i = 0; i < repeatCount; ++i)
+				const auto modelFile = Graphics::ModelLoader::Import(modelFilePath);
+
+			const auto importMilliseconds = importStopwatch.GetElapsedMilliseconds() / repeatCount;
+
+			const auto imported = Graphics::ModelLoader::LoadOrImport(modelFilePath, cacheDirectory);
+			checker.Expect(!imported.IsFromCache(), modelFilePath + " must be imported on the first load");
+
+			// The cache is keyed by contents alone, so it must not hold where the model lives.
+			const auto modelDirectory = std::filesystem::path(modelFilePath).parent_path().string();
+
+			for (const auto& mesh : imported.GetMeshes())
+			{
+				for (const auto& texturePath : mesh.texturePaths)
+				{
+					checker.Expect(!texturePath.starts_with(modelDirectory + "/"),
+						modelFilePath + " must store texture paths relative to the model");
+				}
+			}
+
+			const Stopwatch cacheStopwatch;
+
+			for (int i = 0; i < repeatCount; ++i)
+			{
+				const auto modelFile = Graphics::ModelLoader::LoadOrImport(modelFilePath, cacheDirectory);
+				checker.Expect(modelFile.IsFromCache(), modelFilePath + " must come from the cache on later loads");
+			}
+
+			const auto cacheMilliseconds = cacheStopwatch.GetElapsedMilliseconds() / repeatCount;
+
+			ExpectSameModel(imported, Graphics::ModelLoader::LoadOrImport(modelFilePath, cacheDirectory), modelFilePath);
+
+			std::cout << std::fixed << std::setprecision(2) <<
+				modelFilePath << ": meshes = " << imported.GetMeshes().size() <<
+				", vertices = " << imported.GetVertexCount() <<
+				", indices = " << imported.GetIndexCount() <<
+				", Assimp = " << importMilliseconds << " ms" <<
+				", cache = " << cacheMilliseconds << " ms" <<
+				" (" << importMilliseconds / cacheMilliseconds << "x)" << std::endl;
+		}
+	}
+
+	void RunModelCacheBenchmark()
+	{
+		const auto cacheDirectory = (std::filesystem::temp_directory_path() / "tu_cg_lab_benchmark_models").string();
+
+		std::filesystem::remove_all(cacheDirectory);
+
+		size_t modelCount = 0;
+
+		for (const auto& entry : std::filesystem::recursive_directory_iterator("Content/Models"))
+		{
+			if (entry.is_regular_file() && entry.path().extension() == ".obj")
+			{
+				TimeModel(entry.path().string(), cacheDirectory);
+				++modelCount;
+			}
+		}
+
+		std::filesystem::remove_all(cacheDirectory);
+
+		if (modelCount == 0)
+			std::cout << "No .obj models found under Content/Models." << std::endl;
+		else
+			std::cout << "Model cache checks passed." << std::endl;
+	}
+}
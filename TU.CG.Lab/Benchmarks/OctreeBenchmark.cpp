@@ -0,0 +1,274 @@
+#include "OctreeBenchmark.hpp"
+
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Checker.hpp"
+#include "Stopwatch.hpp"
+#include "Voxels/BuiltinMap.hpp"
+#include "Voxels/ChunkMesher.hpp"
+#include "Voxels/SparseVoxelOctree.hpp"
+#include "Voxels/TerrainGenerator.hpp"
+#include "Voxels/World.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr Checker checker("Octree");
+
+		// The world copied into one flat array covering the octree's cube.
+		class DenseVolume
+		{
+			private:
+				std::vector<Voxels::BlockType> blocks;
+				glm::ivec3 origin;
+				int size;
+			public:
+				DenseVolume(const Voxels::World& world, const glm::ivec3& origin, const int size)
+					: blocks(static_cast<size_t>(size) * size * size, Voxels::Blocks::AIR), origin(origin), size(size)
+				{
+					std::array<Voxels::BlockType, Voxels::CHUNK_VOLUME> chunkBlocks;
+
+					for (const auto& [chunkCoord, chunk] : world)
+					{
+						chunk->CopyBlocks(chunkBlocks);
+
+						const auto chunkOrigin = chunk->GetOrigin() - origin;
+
+						for (int y = 0; y < Voxels::CHUNK_SIZE; ++y)
+							for (int z = 0; z < Voxels::CHUNK_SIZE; ++z)
+								for (int x = 0; x < Voxels::CHUNK_SIZE; ++x)
+								{
+									blocks[GetIndex(chunkOrigin.x + x, chunkOrigin.y + y, chunkOrigin.z + z)] =
+										chunkBlocks[Voxels::Chunk::GetIndex(x, y, z)];
+								}
+					}
+				}
+
+				[[nodiscard]] size_t GetIndex(const int x, const int y, const int z) const
+				{
+					return x + static_cast<size_t>(size) * (z + static_cast<size_t>(size) * y);
+				}
+
+				[[nodiscard]] Voxels::BlockType GetBlock(const int x, const int y, const int z) const
+				{
+					return blocks[GetIndex(x - origin.x, y - origin.y, z - origin.z)];
+				}
+
+				[[nodiscard]] size_t GetMemoryUsage() const { return blocks.size(); }
+		};
+
+		void CheckEdits()
+		{
+			Voxels::SparseVoxelOctree octree(glm::ivec3(-8), 4);
+
+			checker.Expect(octree.GetNodeCount() == 1, "an empty octree must be a single leaf");
+
+			octree.SetBlock(-8, -8, -8, Voxels::Blocks::STONE);
+			checker.Expect(octree.GetBlock(-8, -8, -8) == Voxels::Blocks::STONE, "a set block must read back");
+			checker.Expect(octree.GetBlock(-7, -8, -8) == Voxels::Blocks::AIR, "neighbours must stay air");
+
+			for (int y = -8; y < 8; ++y)
+				for (int z = -8; z < 8; ++z)
+					for (int x = -8; x < 8; ++x)
+						octree.SetBlock(x, y, z, Voxels::Blocks::GOLD);
+
+			checker.Expect(octree.GetNodeCount() == 1, "a uniform octree must collapse to one leaf");
+
+			octree.SetBlock(3, 3, 3, Voxels::Blocks::AIR);
+
+			Voxels::OctreeRayHit hit{};
+			checker.Expect(octree.Raycast(glm::vec3(3.0f, 3.0f, 3.0f), glm::vec3(1.0f, 0.0f, 0.0f), 10.0f, hit),
+				"a ray leaving an air pocket must hit");
+			checker.Expect(hit.block == glm::ivec3(4, 3, 3) && hit.normal == glm::ivec3(-1, 0, 0),
+				"the ray must hit the next block through its facing side");
+			checker.Expect(glm::abs(hit.distance - 0.5f) < 1e-4f, "the hit distance must reach the face");
+		}
+
+		void CheckAgainstWorld(const Voxels::World& world, const Voxels::SparseVoxelOctree& octree)
+		{
+			const auto min = octree.GetOrigin();
+			const auto max = min + octree.GetSize();
+
+			for (int y = min.y; y < max.y; ++y)
+				for (int z = min.z; z < max.z; ++z)
+					for (int x = min.x; x < max.x; ++x)
+						checker.Expect(world.GetBlock(x, y, z) == octree.GetBlock(x, y, z), "every block must match the world");
+
+			for (const auto& [chunkCoord, chunk] : world)
+			{
+				const auto fromWorld = Voxels::ChunkMesher::Build(Voxels::ChunkMesher::Gather(world, chunkCoord));
+				const auto fromOctree = Voxels::ChunkMesher::Build(
+					Voxels::ChunkMesher::Gather(static_cast<const Voxels::IBlockVolume&>(octree), chunkCoord));
+
+				checker.Expect(fromWorld.indices.size() == fromOctree.indices.size(), "both backends must mesh alike");
+			}
+		}
+
+		void Measure(const std::string& name, const Voxels::World& world)
+		{
+			const Stopwatch buildStopwatch;
+			const auto octree = Voxels::SparseVoxelOctree::FromWorld(world);
+			const auto buildMilliseconds = buildStopwatch.GetElapsedMilliseconds();
+
+			const auto origin = octree.GetOrigin();
+			const auto size = octree.GetSize();
+			const DenseVolume dense(world, origin, size);
+
+			size_t worldBytes = 0;
+
+			for (const auto& [chunkCoord, chunk] : world)
+				worldBytes += sizeof(Voxels::Chunk) + chunk->GetStorage().GetMemoryUsage();
+
+			std::cout << std::fixed << std::setprecision(2) <<
+				name << ": cube = " << size << "^3" <<
+				", octree nodes = " << octree.GetNodeCount() <<
+				", build = " << buildMilliseconds << " ms" << std::endl <<
+				"  memory: dense = " << dense.GetMemoryUsage() / 1024.0 << " KiB" <<
+				", chunks = " << worldBytes / 1024.0 << " KiB" <<
+				", octree = " << octree.GetMemoryUsage() / 1024.0 << " KiB" << std::endl;
+
+			constexpr int queryCount = 1 << 21;
+
+			std::mt19937 random(7);
+			std::uniform_int_distribution<int> coordinate(0, size - 1);
+			std::vector<glm::ivec3> queries(queryCount);
+
+			for (auto& query : queries)
+				query = origin + glm::ivec3(coordinate(random), coordinate(random), coordinate(random));
+
+			unsigned denseSum = 0, worldSum = 0, octreeSum = 0;
+
+			const Stopwatch denseStopwatch;
+			for (const auto& query : queries)
+				denseSum += dense.GetBlock(query.x, query.y, query.z);
+			const auto denseQuery = denseStopwatch.GetElapsedMilliseconds();
+
+			const Stopwatch worldStopwatch;
+			for (const auto& query : queries)
+				worldSum += world.GetBlock(query.x, query.y, query.z);
+			const auto worldQuery = worldStopwatch.GetElapsedMilliseconds();
+
+			const Stopwatch octreeStopwatch;
+			for (const auto& query : queries)
+				octreeSum += octree.GetBlock(query.x, query.y, query.z);
+			const auto octreeQuery = octreeStopwatch.GetElapsedMilliseconds();
+
+			checker.Expect(denseSum == worldSum && worldSum == octreeSum, "point queries must agree");
+
+			std::cout << std::setprecision(2) <<
+				"  point query: dense = " << denseQuery * 1e6 / queryCount << " ns" <<
+				", chunks = " << worldQuery * 1e6 / queryCount << " ns" <<
+				", octree = " << octreeQuery * 1e6 / queryCount << " ns" << std::endl;
+
+			// Solid blocks in the whole cube, counted block by block and box by box.
+			const auto regionMax = origin + size - 1;
+
+			const Stopwatch denseRegionStopwatch;
+			size_t denseSolid = 0;
+
+			for (int y = origin.y; y <= regionMax.y; ++y)
+				for (int z = origin.z; z <= regionMax.z; ++z)
+					for (int x = origin.x; x <= regionMax.x; ++x)
+						denseSolid += dense.GetBlock(x, y, z) != Voxels::Blocks::AIR;
+
+			const auto denseRegion = denseRegionStopwatch.GetElapsedMilliseconds();
+
+			const Stopwatch octreeRegionStopwatch;
+			size_t octreeSolid = 0;
+			size_t boxCount = 0;
+
+			octree.ForEachInRegion(origin, regionMax,
+				[&octreeSolid, &boxCount](const glm::ivec3& min, const glm::ivec3& max, const Voxels::BlockType type)
+				{
+					const auto extent = glm::ivec3(max - min + 1);
+
+					if (type != Voxels::Blocks::AIR)
+						octreeSolid += static_cast<size_t>(extent.x) * extent.y * extent.z;
+
+					++boxCount;
+				});
+
+			const auto octreeRegion = octreeRegionStopwatch.GetElapsedMilliseconds();
+
+			checker.Expect(denseSolid == octreeSolid, "region iteration must count every solid block");
+
+			std::cout <<
+				"  region scan: dense = " << denseRegion << " ms" <<
+				", octree = " << octreeRegion << " ms over " << boxCount << " boxes" <<
+				", solid = " << octreeSolid << std::endl;
+
+			// Rays from above the volume, pointing down at random angles.
+			constexpr int rayCount = 1 << 16;
+
+			std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+			std::vector<std::pair<glm::vec3, glm::vec3>> rays(rayCount);
+
+			for (auto& [rayOrigin, direction] : rays)
+			{
+				rayOrigin = glm::vec3(origin) + glm::vec3(unit(random), 1.1f, unit(random)) * static_cast<float>(size);
+				direction = glm::vec3(unit(random) - 0.5f, -1.0f, unit(random) - 0.5f);
+			}
+
+			const auto maxDistance = static_cast<float>(size) * 4.0f;
+			size_t hitCount = 0;
+
+			const Stopwatch rayStopwatch;
+
+			for (const auto& [rayOrigin, direction] : rays)
+			{
+				Voxels::OctreeRayHit hit{};
+
+				if (octree.Raycast(rayOrigin, direction, maxDistance, hit))
+				{
+					++hitCount;
+
+					checker.Expect(dense.GetBlock(hit.block.x, hit.block.y, hit.block.z) == hit.type,
+						"a ray must stop at a solid block");
+
+					const auto before = hit.block + hit.normal;
+
+					checker.Expect(!octree.IsSolid(before.x, before.y, before.z),
+						"the block in front of a hit must be air");
+				}
+			}
+
+			const auto rayMilliseconds = rayStopwatch.GetElapsedMilliseconds();
+
+			std::cout <<
+				"  raycast: " << rayMilliseconds * 1e3 / rayCount << " us/ray" <<
+				", hits = " << hitCount << "/" << rayCount << std::endl;
+		}
+	}
+
+	void RunOctreeBenchmark()
+	{
+		CheckEdits();
+
+		Voxels::World builtin;
+		Voxels::BuiltinMap::Build(builtin);
+
+		CheckAgainstWorld(builtin, Voxels::SparseVoxelOctree::FromWorld(builtin));
+
+		std::cout << "Octree checks passed." << std::endl;
+
+		Measure("builtin map", builtin);
+
+		// Ore scattered through the stone keeps most leaves at block size; the
+		// plain hills show the octree on homogeneous ground.
+		{
+			Voxels::World plainTerrain;
+			Voxels::TerrainGenerator::GenerateHills(plainTerrain, glm::ivec3(512), 1337, false);
+			Measure("plain hills 512^3", plainTerrain);
+		}
+
+		Voxels::World terrain;
+		Voxels::TerrainGenerator::GenerateHills(terrain, glm::ivec3(512), 1337);
+		Measure("ore hills 512^3", terrain);
+	}
+}
@@ -0,0 +1,232 @@
+#include "PhysicsBenchmark.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Checker.hpp"
+#include "Stopwatch.hpp"
+#include "Physics/PlayerBody.hpp"
+#include "Voxels/TerrainGenerator.hpp"
+#include "Voxels/World.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr Checker checker("Physics");
+
+		// A 16x16 floor of stone at y = 0, with its top face at y = 0.5.
+		Voxels::World MakeFloor()
+		{
+			Voxels::World world;
+
+			for (int z = 0; z < 16; ++z)
+				for (int x = 0; x < 16; ++x)
+					world.SetBlock(x, 0, z, Voxels::Blocks::STONE);
+
+			return world;
+		}
+
+		const float timeSteps[] = { 1.0f / 20.0f, 1.0f / 60.0f, 1.0f / 144.0f, 1.0f / 1000.0f };
+
+		void CheckFalling(const Voxels::World& floor)
+		{
+			for (const auto deltaTime : timeSteps)
+			{
+				Physics::PlayerBody body(glm::vec3(8.0f, 10.5f, 8.0f));
+				const auto expectedTime = std::sqrt(2.0f * 10.0f / body.GetSettings().gravity);
+
+				auto time = 0.0f;
+
+				while (!body.IsOnGround() && time < 10.0f)
+				{
+					body.Step(floor, deltaTime);
+					time += deltaTime;
+				}
+
+				checker.Expect(body.IsOnGround(), "a falling body must land");
+				checker.Expect(glm::abs(body.GetPosition().y - 0.5f) < 1e-3f, "the body must rest on the top face");
+				checker.Expect(glm::abs(time - expectedTime) <= deltaTime + 1e-4f, "the fall time must not depend on the frame rate");
+
+				for (int i = 0; i < 100; ++i)
+					body.Step(floor, deltaTime);
+
+				checker.Expect(body.IsOnGround() && glm::abs(body.GetPosition().y - 0.5f) < 1e-3f, "a resting body must stay put");
+			}
+		}
+
+		void CheckJumping(const Voxels::World& floor)
+		{
+			for (const auto deltaTime : timeSteps)
+			{
+				Physics::PlayerBody body(glm::vec3(8.0f, 0.5f, 8.0f));
+				body.Step(floor, deltaTime);
+
+				checker.Expect(body.Jump(), "a grounded body must jump");
+				checker.Expect(!body.Jump(), "a body in the air must not jump again");
+
+				const auto& settings = body.GetSettings();
+				const auto expectedApex = 0.5f + settings.jumpSpeed * settings.jumpSpeed / (2.0f * settings.gravity);
+
+				auto apex = body.GetPosition().y;
+
+				do
+				{
+					body.Step(floor, deltaTime);
+					apex = std::max(apex, body.GetPosition().y);
+				}
+				while (!body.IsOnGround());
+
+				// Sampling at whole steps can only miss the true apex by v * dt near the top.
+				const auto tolerance = settings.gravity * deltaTime * deltaTime + 1e-3f;
+
+				checker.Expect(apex <= expectedApex + 1e-3f && apex >= expectedApex - tolerance,
+					"the jump height must not depend on the frame rate");
+				checker.Expect(glm::abs(body.GetPosition().y - 0.5f) < 1e-3f, "the body must land on the floor");
+			}
+		}
+
+		void CheckWalls(Voxels::World world)
+		{
+			// A one block thick wall at x = 12, two blocks tall.
+			for (int z = 0; z < 16; ++z)
+			{
+				world.SetBlock(12, 1, z, Voxels::Blocks::STONE);
+				world.SetBlock(12, 2, z, Voxels::Blocks::STONE);
+			}
+
+			for (const auto deltaTime : { 1.0f / 60.0f, 0.5f })
+			{
+				Physics::PlayerBody body(glm::vec3(4.0f, 0.5f, 8.0f));
+
+				for (int i = 0; i < 200; ++i)
+				{
+					body.SetHorizontalVelocity(glm::vec2(30.0f, 0.0f));
+					body.Step(world, deltaTime);
+				}
+
+				const auto wallFace = 11.5f - body.GetSettings().halfWidth;
+
+				checker.Expect(glm::abs(body.GetPosition().x - wallFace) < 1e-3f, "a fast body must stop at the wall, not pass it");
+				checker.Expect(body.IsTouching(world, 0, 1), "the body must touch the wall");
+				checker.Expect(body.IsOnGround(), "walking into a wall must keep the body on the ground");
+			}
+
+			// Sliding along the wall keeps the parallel motion.
+			Physics::PlayerBody body(glm::vec3(11.0f, 0.5f, 2.0f));
+
+			for (int i = 0; i < 30; ++i)
+			{
+				body.SetHorizontalVelocity(glm::vec2(5.0f, 5.0f));
+				body.Step(world, 1.0f / 60.0f);
+			}
+
+			checker.Expect(body.GetPosition().z > 4.0f, "the body must slide along the wall");
+		}
+
+		void CheckCeiling(Voxels::World world)
+		{
+			// A ceiling block whose bottom face is 2.2 above the floor.
+			world.SetBlock(8, 3, 8, Voxels::Blocks::STONE);
+
+			Physics::PlayerBody body(glm::vec3(8.0f, 0.5f, 8.0f));
+			body.Step(world, 1.0f / 60.0f);
+			body.Jump();
+
+			auto apex = 0.0f;
+
+			for (int i = 0; i < 120; ++i)
+			{
+				body.Step(world, 1.0f / 60.0f);
+				apex = std::max(apex, body.GetMax().y);
+			}
+
+			checker.Expect(apex <= 2.5f + 1e-3f, "the head must stop at the ceiling");
+			checker.Expect(body.IsOnGround(), "the body must fall back down after hitting the ceiling");
+		}
+
+		void CheckLedge(const Voxels::World& floor)
+		{
+			Physics::PlayerBody body(glm::vec3(14.0f, 0.5f, 8.0f));
+
+			for (int i = 0; i < 60; ++i)
+			{
+				body.SetHorizontalVelocity(glm::vec2(5.0f, 0.0f));
+				body.Step(floor, 1.0f / 60.0f);
+			}
+
+			checker.Expect(!body.IsOnGround() && body.GetPosition().y < 0.5f, "walking off a ledge must fall");
+		}
+	}
+
+	void RunPhysicsBenchmark()
+	{
+		const auto floor = MakeFloor();
+
+		CheckFalling(floor);
+		CheckJumping(floor);
+		CheckWalls(MakeFloor());
+		CheckCeiling(MakeFloor());
+		CheckLedge(floor);
+
+		std::cout << "Physics checks passed." << std::endl;
+
+		const glm::ivec3 size(256, 64, 256);
+
+		Voxels::World terrain;
+		Voxels::TerrainGenerator::GenerateHills(terrain, size, 1337);
+
+		// Bodies running around the hills in random directions, jumping whenever they can.
+		constexpr int bodyCount = 1024;
+		constexpr int stepCount = 600;
+		constexpr float deltaTime = 1.0f / 60.0f;
+
+		std::mt19937 random(3);
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+		std::vector<Physics::PlayerBody> bodies;
+		std::vector<glm::vec2> headings;
+
+		for (int i = 0; i < bodyCount; ++i)
+		{
+			bodies.emplace_back(glm::vec3(
+				16.0f + unit(random) * (size.x - 32), static_cast<float>(size.y), 16.0f + unit(random) * (size.z - 32)));
+
+			const auto angle = unit(random) * 6.2831853f;
+			headings.emplace_back(glm::vec2(std::cos(angle), std::sin(angle)) * 5.5f);
+		}
+
+		size_t jumps = 0;
+
+		const Stopwatch stopwatch;
+
+		for (int step = 0; step < stepCount; ++step)
+			for (int i = 0; i < bodyCount; ++i)
+			{
+				bodies[i].SetHorizontalVelocity(headings[i]);
+				jumps += bodies[i].Jump();
+				bodies[i].Step(terrain, deltaTime);
+			}
+
+		const auto milliseconds = stopwatch.GetElapsedMilliseconds();
+
+		for (const auto& body : bodies)
+		{
+			const auto min = body.GetMin() + 0.01f;
+			const auto max = body.GetMax() - 0.01f;
+
+			for (int y = static_cast<int>(glm::round(min.y)); y <= static_cast<int>(glm::round(max.y)); ++y)
+				for (int z = static_cast<int>(glm::round(min.z)); z <= static_cast<int>(glm::round(max.z)); ++z)
+					for (int x = static_cast<int>(glm::round(min.x)); x <= static_cast<int>(glm::round(max.x)); ++x)
+						checker.Expect(!terrain.IsSolid(x, y, z), "no body may end up inside the terrain");
+		}
+
+		std::cout << std::fixed << std::setprecision(2) <<
+			"hills 256x64x256: bodies = " << bodyCount << ", steps = " << stepCount << ", jumps = " << jumps << std::endl <<
+			"  step = " << milliseconds * 1e6 / (static_cast<double>(bodyCount) * stepCount) << " ns/body" << std::endl;
+	}
+}
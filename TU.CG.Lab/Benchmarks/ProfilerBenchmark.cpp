@@ -0,0 +1,101 @@
+#include "ProfilerBenchmark.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "Checker.hpp"
+#include "Stopwatch.hpp"
+#include "Utils/Profiler.hpp"
+
+namespace Benchmarks
+{
+#if PROFILER_ENABLED
+	namespace
+	{
+		constexpr Checker checker("Profiler");
+
+		size_t CountOccurrences(const std::string& text, const std::string& pattern)
+		{
+			size_t count = 0;
+
+			for (auto position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + 1))
+				++count;
+
+			return count;
+		}
+
+		void CheckTrace()
+		{
+			const auto firstFrame = Utils::Profiler::GetFrameIndex() + 1;
+
+			for (int frame = 0; frame < 3; ++frame)
+			{
+				Utils::Profiler::BeginFrame();
+				PROFILE_ZONE("Benchmark frame");
+
+				{
+					PROFILE_ZONE("Benchmark \"inner\" zone");
+				}
+
+				std::thread([] { PROFILE_ZONE("Benchmark worker zone"); }).join();
+			}
+
+			// Starts in the last captured frame and ends in the next one.
+			{
+				PROFILE_ZONE("Benchmark spanning zone");
+				Utils::Profiler::BeginFrame();
+			}
+
+			const auto filePath = (std::filesystem::temp_directory_path() / "profiler_benchmark.json").string();
+			const auto zoneCount = Utils::Profiler::WriteChromeTrace(filePath, firstFrame + 1, firstFrame + 2);
+
+			std::ifstream stream(filePath);
+			std::stringstream contents;
+			contents << stream.rdbuf();
+			const auto trace = contents.str();
+
+			std::filesystem::remove(filePath);
+
+			// The outer zone of the last frame only ends with the loop body, so it is recorded too.
+			checker.Expect(zoneCount == 7, "two frames of three zones and the spanning zone must be written, got " +
+				std::to_string(zoneCount));
+			checker.Expect(CountOccurrences(trace, "Benchmark spanning zone") == 1, "zones must keep the frame they start in");
+			checker.Expect(CountOccurrences(trace, "\"ph\":\"X\"") == zoneCount, "every zone must be a complete event");
+			checker.Expect(CountOccurrences(trace, "Benchmark \\\"inner\\\" zone") == 2, "zone names must be escaped");
+			checker.Expect(CountOccurrences(trace, "Benchmark worker zone") == 2, "zones from other threads must be included");
+			checker.Expect(trace.front() == '{' && trace.find("\"traceEvents\":[") != std::string::npos, "the trace must be trace-event JSON");
+		}
+	}
+
+	void RunProfilerBenchmark()
+	{
+		CheckTrace();
+
+		std::cout << "Profiler checks passed." << std::endl;
+
+		constexpr int zoneCount = 1 << 22;
+
+		const Stopwatch stopwatch;
+
+		for (int i = 0; i < zoneCount; ++i)
+		{
+			PROFILE_ZONE("Benchmark overhead zone");
+		}
+
+		const auto milliseconds = stopwatch.GetElapsedMilliseconds();
+
+		std::cout << std::fixed << std::setprecision(2) <<
+			"zones = " << zoneCount << ", overhead = " << milliseconds * 1e6 / zoneCount << " ns/zone" << std::endl;
+	}
+#else
+	void RunProfilerBenchmark()
+	{
+		std::cout << "The profiler is compiled out (PROFILER_ENABLED = 0)." << std::endl;
+	}
+#endif
+}
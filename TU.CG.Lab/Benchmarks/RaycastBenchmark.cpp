@@ -0,0 +1,167 @@
+#include "RaycastBenchmark.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Checker.hpp"
+#include "Stopwatch.hpp"
+#include "Voxels/SparseVoxelOctree.hpp"
+#include "Voxels/TerrainGenerator.hpp"
+#include "Voxels/VoxelRaycast.hpp"
+#include "Voxels/World.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr Checker checker("Raycast");
+
+		void CheckSimpleCases()
+		{
+			Voxels::World world;
+			world.SetBlock(5, 0, 0, Voxels::Blocks::GOLD);
+			world.SetBlock(0, -3, 0, Voxels::Blocks::STONE);
+
+			Voxels::RaycastHit hit;
+
+			checker.Expect(Voxels::VoxelRaycast::Cast(world, { glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f), 10.0f }, hit),
+				"a ray along +x must hit the gold block");
+			checker.Expect(hit.block == glm::ivec3(5, 0, 0) && hit.normal == glm::ivec3(-1, 0, 0),
+				"the ray must enter through the -x face");
+			checker.Expect(glm::abs(hit.distance - 4.5f) < 1e-5f, "the hit distance must reach the face");
+			checker.Expect(hit.type == Voxels::Blocks::GOLD, "the hit must report the block type");
+
+			checker.Expect(!Voxels::VoxelRaycast::Cast(world, { glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f), 4.0f }, hit),
+				"a ray must stop at its max distance");
+			checker.Expect(hit.type == Voxels::Blocks::AIR, "a miss must report air");
+
+			checker.Expect(Voxels::VoxelRaycast::Cast(world, { glm::vec3(0.2f, 0.0f, 0.1f), glm::vec3(0.0f, -2.0f, 0.0f), 10.0f }, hit),
+				"an unnormalised direction must still hit");
+			checker.Expect(hit.block == glm::ivec3(0, -3, 0) && hit.normal == glm::ivec3(0, 1, 0),
+				"a downward ray must land on the top face");
+			checker.Expect(glm::abs(hit.distance - 2.5f) < 1e-5f, "the distance must be measured along the unit direction");
+
+			checker.Expect(Voxels::VoxelRaycast::Cast(world, { glm::vec3(5.1f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f), 10.0f }, hit),
+				"a ray starting inside a block must hit it");
+			checker.Expect(hit.distance == 0.0f && hit.normal == glm::ivec3(0), "a starting hit has no face");
+
+			// Crosses the chunk border at x = 15.5.
+			world.SetBlock(40, 2, 0, Voxels::Blocks::STONE);
+
+			checker.Expect(Voxels::VoxelRaycast::Cast(world, { glm::vec3(6.0f, 2.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), 64.0f }, hit),
+				"a ray must cross chunk borders");
+			checker.Expect(hit.block == glm::ivec3(40, 2, 0), "the ray must hit the block past the border");
+
+			// Upwards nothing is solid, so an unbounded ray would never stop.
+			checker.Expect(!Voxels::VoxelRaycast::Cast(world,
+				{ glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f), std::numeric_limits<float>::infinity() }, hit),
+				"a ray with an infinite reach must be rejected");
+		}
+
+		std::vector<Voxels::Ray> MakeRays(const Voxels::World& world, const glm::ivec3& size, const int count)
+		{
+			std::mt19937 random(11);
+			std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+			std::vector<Voxels::Ray> rays;
+			rays.reserve(count);
+
+			// Line-of-sight style queries: start in open air, look anywhere within 64 blocks.
+			while (static_cast<int>(rays.size()) < count)
+			{
+				const auto origin = glm::vec3(unit(random), unit(random), unit(random)) * glm::vec3(size - 1);
+				const auto block = glm::ivec3(glm::round(origin));
+
+				if (world.IsSolid(block.x, block.y, block.z))
+					continue;
+
+				const auto direction = glm::vec3(unit(random), unit(random), unit(random)) * 2.0f - 1.0f;
+
+				if (glm::length(direction) < 0.01f)
+					continue;
+
+				rays.push_back({ origin, direction, 64.0f });
+			}
+
+			return rays;
+		}
+	}
+
+	void RunRaycastBenchmark()
+	{
+		CheckSimpleCases();
+
+		const glm::ivec3 size(256, 64, 256);
+
+		Voxels::World world;
+		Voxels::TerrainGenerator::GenerateHills(world, size, 1337);
+
+		const auto octree = Voxels::SparseVoxelOctree::FromWorld(world);
+
+		constexpr int rayCount = 1 << 18;
+		const auto rays = MakeRays(world, size, rayCount);
+
+		std::vector<Voxels::RaycastHit> worldHits(rayCount);
+		std::vector<Voxels::RaycastHit> volumeHits(rayCount);
+		std::vector<Voxels::RaycastHit> batchHits(rayCount);
+		size_t worldHitCount = 0, volumeHitCount = 0, octreeHitCount = 0;
+
+		const Stopwatch worldStopwatch;
+		for (int i = 0; i < rayCount; ++i)
+			worldHitCount += Voxels::VoxelRaycast::Cast(world, rays[i], worldHits[i]);
+		const auto worldMilliseconds = worldStopwatch.GetElapsedMilliseconds();
+
+		const auto& volume = static_cast<const Voxels::IBlockVolume&>(world);
+
+		const Stopwatch volumeStopwatch;
+		for (int i = 0; i < rayCount; ++i)
+			volumeHitCount += Voxels::VoxelRaycast::Cast(volume, rays[i], volumeHits[i]);
+		const auto volumeMilliseconds = volumeStopwatch.GetElapsedMilliseconds();
+
+		const Stopwatch batchStopwatch;
+		const auto batchHitCount = Voxels::VoxelRaycast::CastBatch(world, rays, batchHits);
+		const auto batchMilliseconds = batchStopwatch.GetElapsedMilliseconds();
+
+		const Stopwatch octreeStopwatch;
+		for (int i = 0; i < rayCount; ++i)
+		{
+			Voxels::OctreeRayHit hit{};
+
+			if (octree.Raycast(rays[i].origin, rays[i].direction, rays[i].maxDistance, hit))
+			{
+				++octreeHitCount;
+
+				const auto& expected = worldHits[i];
+
+				// Rays through an edge or corner may pick either block; the distance still agrees.
+				checker.Expect(expected.type != Voxels::Blocks::AIR, "the grid must hit where the octree does");
+				checker.Expect(glm::abs(hit.distance - expected.distance) < 1e-3f,
+					"the octree and the grid must agree on the distance");
+			}
+		}
+		const auto octreeMilliseconds = octreeStopwatch.GetElapsedMilliseconds();
+
+		for (int i = 0; i < rayCount; ++i)
+		{
+			checker.Expect(worldHits[i].block == volumeHits[i].block && worldHits[i].type == volumeHits[i].type &&
+				worldHits[i].block == batchHits[i].block && worldHits[i].type == batchHits[i].type,
+				"every entry point must return the same hit");
+		}
+
+		checker.Expect(worldHitCount == volumeHitCount && worldHitCount == batchHitCount && worldHitCount == octreeHitCount,
+			"every entry point must hit the same number of rays");
+
+		std::cout << "Raycast checks passed." << std::endl;
+
+		std::cout << std::fixed << std::setprecision(2) <<
+			"hills 256x64x256: rays = " << rayCount << ", hits = " << worldHitCount << ", reach = 64" << std::endl <<
+			"  world = " << worldMilliseconds * 1e6 / rayCount << " ns/ray" <<
+			", volume = " << volumeMilliseconds * 1e6 / rayCount << " ns/ray" <<
+			", batch = " << batchMilliseconds * 1e6 / rayCount << " ns/ray" <<
+			", octree = " << octreeMilliseconds * 1e6 / rayCount << " ns/ray" << std::endl;
+	}
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <chrono>
+
+namespace Benchmarks
+{
+	class Stopwatch
+	{
+		private:
+			std::chrono::steady_clock::time_point start;
+		public:
+			Stopwatch() : start(std::chrono::steady_clock::now()) {}
+
+			void Restart() { start = std::chrono::steady_clock::now(); }
+
+			[[nodiscard]] double GetElapsedMilliseconds() const
+			{
+				return std::chrono::duration<double, std::milli>(
+					std::chrono::steady_clock::now() - start).count();
+			}
+	};
+}
@@ -0,0 +1,270 @@
+#include "TextureBakeBenchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stb/stb_image.h>
+
+#include "Checker.hpp"
+#include "Stopwatch.hpp"
+#include "Graphics/BakedTexture.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr Checker checker("Texture bake");
+
+		std::vector<unsigned char> MakeImage(const int width, const int height, const int channels)
+		{
+			std::vector<unsigned char> pixels(static_cast<size_t>(width) * height * channels);
+
+			for (int y = 0; y < height; ++y)
+			{
+				for (int x = 0; x < width; ++x)
+				{
+					const auto pixel = &pixels[(static_cast<size_t>(y) * width + x) * channels];
+					const auto wave = 0.5f + 0.5f * std::sin(x * 0.05f) * std::cos(y * 0.07f);
+
+					for (int c = 0; c < channels; ++c)
+						pixel[c] = static_cast<unsigned char>(c == 3 ? 255 * (x < width / 2) : 255 * wave * (c + 1) / channels);
+				}
+			}
+
+			return pixels;
+		}
+
+		std::uint64_t Read(const std::byte* data, const int byteCount)
+		{
+			std::uint64_t value = 0;
+
+			for (int i = 0; i < byteCount; ++i)
+				value |= static_cast<std::uint64_t>(data[i]) << (8 * i);
+
+			return value;
+		}
+
+		// Reference decoders for the blocks the baker writes, in the four-colour
+		// and eight-value modes it always selects.
+		void DecodeColorBlock(const std::byte* block, int colors[16][3])
+		{
+			int palette[4][3];
+
+			for (int endpoint = 0; endpoint < 2; ++endpoint)
+			{
+				const auto color = static_cast<int>(Read(block + endpoint * 2, 2));
+				const auto r = color >> 11 & 31, g = color >> 5 & 63, b = color & 31;
+
+				palette[endpoint][0] = r << 3 | r >> 2;
+				palette[endpoint][1] = g << 2 | g >> 4;
+				palette[endpoint][2] = b << 3 | b >> 2;
+			}
+
+			for (int c = 0; c < 3; ++c)
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+
+			const auto indices = Read(block + 4, 4);
+
+			for (int i = 0; i < 16; ++i)
+				std::memcpy(colors[i], palette[indices >> (2 * i) & 3], sizeof colors[i]);
+		}
+
+		void DecodeSingleChannelBlock(const std::byte* block, int values[16])
+		{
+			const auto encoded = Read(block, 8);
+			const auto maximum = static_cast<int>(encoded & 255);
+			const auto minimum = static_cast<int>(encoded >> 8 & 255);
+
+			int palette[8] = { maximum, minimum };
+
+			for (int i = 1; i < 7; ++i)
+				palette[i + 1] = ((7 - i) * maximum + i * minimum) / 7;
+
+			for (int i = 0; i < 16; ++i)
+				values[i] = palette[encoded >> (16 + 3 * i) & 7];
+		}
+
+		// Root mean square error of level 0 against the source, over all stored channels.
+		double GetError(const Graphics::BakedTexture& texture, const std::vector<unsigned char>& pixels, const int channels)
+		{
+			const auto& level = texture.GetLevels()[0];
+			const auto blockSize = texture.GetFormat() == Graphics::BakedPixelFormat::BC3 ? 16 : 8;
+			const auto blocksPerRow = (level.width + 3) / 4;
+
+			double squaredError = 0.0;
+
+			for (int y = 0; y < level.height; ++y)
+			{
+				for (int x = 0; x < level.width; ++x)
+				{
+					const auto block = level.data + (static_cast<size_t>(y / 4) * blocksPerRow + x / 4) * blockSize;
+					const auto i = y % 4 * 4 + x % 4;
+					const auto source = &pixels[(static_cast<size_t>(y) * level.width + x) * channels];
+
+					int decoded[4] = {};
+
+					if (texture.GetFormat() == Graphics::BakedPixelFormat::BC4)
+					{
+						int values[16];
+						DecodeSingleChannelBlock(block, values);
+						decoded[0] = values[i];
+					}
+					else
+					{
+						int colors[16][3];
+						DecodeColorBlock(block + blockSize - 8, colors);
+						std::memcpy(decoded, colors[i], sizeof colors[i]);
+
+						if (blockSize == 16)
+						{
+							int values[16];
+							DecodeSingleChannelBlock(block, values);
+							decoded[3] = values[i];
+						}
+					}
+
+					for (int c = 0; c < channels; ++c)
+						squaredError += (decoded[c] - source[c]) * (decoded[c] - source[c]);
+				}
+			}
+
+			return std::sqrt(squaredError / (static_cast<double>(level.width) * level.height * channels));
+		}
+
+		void CheckBake(const std::string& name, const int width, const int height, const int channels,
+			const Graphics::BakedPixelFormat expectedFormat, const double maxError)
+		{
+			const auto pixels = MakeImage(width, height, channels);
+			const auto texture = Graphics::BakedTexture::Bake(pixels.data(), width, height, channels, true, 42);
+
+			checker.Expect(texture.GetFormat() == expectedFormat, name + " must pick the expected block format");
+			checker.Expect(texture.GetLevels().size() == static_cast<size_t>(std::log2(std::max(width, height))) + 1,
+				name + " must hold a full mip chain");
+			checker.Expect(texture.GetLevels().back().width == 1 && texture.GetLevels().back().height == 1,
+				name + " must end in a 1x1 level");
+
+			const auto error = GetError(texture, pixels, channels);
+
+			checker.Expect(error < maxError, name + " compression error " + std::to_string(error) + " is too high");
+		}
+
+		void CheckRoundTrip(const std::string& directory)
+		{
+			const auto pixels = MakeImage(100, 60, 3);
+			const auto texture = Graphics::BakedTexture::Bake(pixels.data(), 100, 60, 3, false, 7);
+			const auto filePath = (std::filesystem::path(directory) / "round_trip.ttex").string();
+
+			texture.Save(filePath);
+
+			{
+				const auto loaded = Graphics::BakedTexture::Load(filePath);
+
+				checker.Expect(loaded.IsFromCache() && loaded.GetSourceHash() == 7, "loaded texture must keep its hash");
+				checker.Expect(loaded.GetFormat() == Graphics::BakedPixelFormat::RGB8, "uncompressed bake must stay RGB8");
+				checker.Expect(loaded.GetLevels().size() == texture.GetLevels().size(), "level count must survive a round trip");
+
+				for (size_t i = 0; i < loaded.GetLevels().size(); ++i)
+				{
+					const auto& left = loaded.GetLevels()[i];
+					const auto& right = texture.GetLevels()[i];
+
+					checker.Expect(left.width == right.width && left.height == right.height && left.size == right.size &&
+						std::memcmp(left.data, right.data, left.size) == 0, "level data must survive a round trip");
+				}
+
+				checker.Expect(std::memcmp(loaded.GetLevels()[0].data, pixels.data(), pixels.size()) == 0,
+					"uncompressed level 0 must match the source");
+			}
+
+			std::filesystem::resize_file(filePath, std::filesystem::file_size(filePath) - 5);
+
+			auto threw = false;
+
+			try
+			{
+				const auto truncated = Graphics::BakedTexture::Load(filePath);
+			}
+			catch (const std::exception&)
+			{
+				threw = true;
+			}
+
+			checker.Expect(threw, "a truncated file must be rejected");
+			checker.Expect(Graphics::BakedTexture::GetCacheFileName(1, true) != Graphics::BakedTexture::GetCacheFileName(1, false),
+				"compressed and uncompressed bakes must not share a cache file");
+		}
+
+		void TimeImage(const std::string& sourceFilePath, const std::string& directory)
+		{
+			int width, height, channels;
+
+			const Stopwatch decodeStopwatch;
+			const auto pixels = stbi_load(sourceFilePath.c_str(), &width, &height, &channels, 0);
+			const auto decodeMilliseconds = decodeStopwatch.GetElapsedMilliseconds();
+
+			checker.Expect(pixels != nullptr, "failed to decode " + sourceFilePath);
+			stbi_image_free(pixels);
+
+			for (const auto compress : { false, true })
+			{
+				std::filesystem::remove_all(directory);
+
+				const Stopwatch bakeStopwatch;
+				const auto baked = Graphics::BakedTexture::LoadOrBake(sourceFilePath, directory, compress);
+				const auto bakeMilliseconds = bakeStopwatch.GetElapsedMilliseconds();
+
+				const Stopwatch loadStopwatch;
+				const auto cached = Graphics::BakedTexture::LoadOrBake(sourceFilePath, directory, compress);
+				const auto loadMilliseconds = loadStopwatch.GetElapsedMilliseconds();
+
+				checker.Expect(cached.IsFromCache(), "second load of " + sourceFilePath + " must come from the cache");
+				checker.Expect(cached.GetDataSize() == baked.GetDataSize(), "cached texture must match the bake");
+
+				std::cout << std::fixed << std::setprecision(2) <<
+					std::filesystem::path(sourceFilePath).filename().string() << " " << width << "x" << height << "x" << channels <<
+					(compress ? ", compressed" : ", uncompressed") <<
+					": stb decode = " << decodeMilliseconds << " ms" <<
+					", first bake = " << bakeMilliseconds << " ms" <<
+					", cached load = " << loadMilliseconds << " ms" <<
+					", texels with mips = " << cached.GetDataSize() / 1024.0 << " KiB" <<
+					" (decoded level 0 = " << static_cast<double>(width) * height * channels / 1024.0 << " KiB)" << std::endl;
+			}
+		}
+	}
+
+	void RunTextureBakeBenchmark()
+	{
+		const auto directory = (std::filesystem::temp_directory_path() / "tu_cg_lab_benchmark_textures").string();
+
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory);
+
+		CheckBake("opaque RGB", 256, 256, 3, Graphics::BakedPixelFormat::BC1, 8.0);
+		CheckBake("odd-sized RGB", 130, 70, 3, Graphics::BakedPixelFormat::BC1, 8.0);
+		CheckBake("RGBA with alpha", 128, 128, 4, Graphics::BakedPixelFormat::BC3, 8.0);
+		CheckBake("single channel", 200, 100, 1, Graphics::BakedPixelFormat::BC4, 4.0);
+		CheckRoundTrip(directory);
+
+		std::cout << "Texture bake checks passed." << std::endl;
+
+		stbi_set_flip_vertically_on_load(true);
+
+		for (const auto& sourceFilePath : {
+			"Content/Models/bed2/bed_low_parts_Bed_SpecularSmoothness.png",
+			"Content/Textures/container2.png" })
+		{
+			if (std::filesystem::exists(sourceFilePath))
+				TimeImage(sourceFilePath, directory);
+		}
+
+		std::filesystem::remove_all(directory);
+	}
+}
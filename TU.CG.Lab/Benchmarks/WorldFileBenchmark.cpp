@@ -0,0 +1,132 @@
+#include "WorldFileBenchmark.hpp"
+
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "Checker.hpp"
+#include "Stopwatch.hpp"
+#include "Voxels/BuiltinMap.hpp"
+#include "Voxels/TerrainGenerator.hpp"
+#include "Voxels/WorldFile.hpp"
+
+namespace Benchmarks
+{
+	namespace
+	{
+		constexpr Checker checker("World file");
+
+		bool HaveSameBlocks(const Voxels::World& left, const Voxels::World& right)
+		{
+			if (left.GetChunkCount() != right.GetChunkCount())
+				return false;
+
+			for (const auto& [chunkCoord, chunk] : left)
+			{
+				const auto other = right.GetChunk(chunkCoord);
+
+				if (other == nullptr)
+					return false;
+
+				for (int y = 0; y < Voxels::CHUNK_SIZE; ++y)
+					for (int z = 0; z < Voxels::CHUNK_SIZE; ++z)
+						for (int x = 0; x < Voxels::CHUNK_SIZE; ++x)
+							if (chunk->GetBlock(x, y, z) != other->GetBlock(x, y, z))
+								return false;
+			}
+
+			return true;
+		}
+
+		// Only the world's chunks are compared; the volume may extend past them.
+		bool MatchesVolume(const Voxels::World& world, const Voxels::IBlockVolume& volume)
+		{
+			for (const auto& [chunkCoord, chunk] : world)
+			{
+				const auto origin = chunk->GetOrigin();
+
+				for (int y = 0; y < Voxels::CHUNK_SIZE; ++y)
+					for (int z = 0; z < Voxels::CHUNK_SIZE; ++z)
+						for (int x = 0; x < Voxels::CHUNK_SIZE; ++x)
+							if (chunk->GetBlock(x, y, z) != volume.GetBlock(origin.x + x, origin.y + y, origin.z + z))
+								return false;
+			}
+
+			return true;
+		}
+
+		void RoundTrip(const std::string& name, const Voxels::World& world, const std::string& filePath)
+		{
+			const Stopwatch writeStopwatch;
+			Voxels::WorldFileWriter::Save(world, filePath);
+			const auto writeMilliseconds = writeStopwatch.GetElapsedMilliseconds();
+
+			Voxels::World loaded;
+
+			const Stopwatch readStopwatch;
+			{
+				const Voxels::WorldFileReader reader(filePath);
+				reader.LoadInto(loaded);
+			}
+			const auto readMilliseconds = readStopwatch.GetElapsedMilliseconds();
+
+			checker.Expect(HaveSameBlocks(world, loaded), name + " must load back unchanged");
+			checker.Expect(MatchesVolume(world, Voxels::WorldFileReader(filePath).ReadOctree()),
+				name + " must load into an octree unchanged");
+
+			Voxels::World nearby;
+			Voxels::WorldFileReader nearbyReader(filePath);
+
+			const Stopwatch nearbyStopwatch;
+			const auto nearbyCount = nearbyReader.LoadChunksNear(nearby, glm::ivec3(0), 1);
+			const auto nearMilliseconds = nearbyStopwatch.GetElapsedMilliseconds();
+
+			checker.Expect(nearbyReader.LoadChunksNear(nearby, glm::ivec3(0), 1) == 0,
+				name + " must not read loaded chunks again");
+			checker.Expect(nearbyCount <= world.GetChunkCount(), name + " must not load more than the file holds");
+
+			// Walk away and back: everything left behind goes, and comes back unchanged.
+			const glm::ivec3 farCentre(4, 0, 4);
+			nearbyReader.LoadChunksNear(nearby, farCentre, 1);
+
+			checker.Expect(nearbyReader.UnloadChunksOutside(nearby, farCentre, 1).size() == nearbyCount,
+				name + " must unload the chunks left behind");
+			checker.Expect(nearbyReader.LoadChunksNear(nearby, glm::ivec3(0), 1) == nearbyCount,
+				name + " must read unloaded chunks again");
+
+			nearbyReader.UnloadChunksOutside(nearby, glm::ivec3(0), 1);
+
+			for (const auto& [chunkCoord, chunk] : nearby)
+			{
+				const auto offset = glm::abs(chunkCoord);
+
+				checker.Expect(offset.x <= 1 && offset.y <= 1 && offset.z <= 1,
+					name + " must only load chunks in range");
+			}
+
+			std::cout << std::fixed << std::setprecision(2) <<
+				name << ": chunks = " << world.GetChunkCount() <<
+				", file = " << std::filesystem::file_size(filePath) / 1024.0 << " KiB" <<
+				", raw = " << world.GetChunkCount() * Voxels::CHUNK_VOLUME / 1024.0 << " KiB" <<
+				", write = " << writeMilliseconds << " ms" <<
+				", read = " << readMilliseconds << " ms" <<
+				", read near origin = " << nearbyCount << " chunks in " << nearMilliseconds << " ms" << std::endl;
+		}
+	}
+
+	void RunWorldFileBenchmark()
+	{
+		const auto filePath = (std::filesystem::temp_directory_path() / "tu_cg_lab_benchmark.world").string();
+
+		Voxels::World builtin;
+		Voxels::BuiltinMap::Build(builtin);
+		RoundTrip("builtin map", builtin, filePath);
+
+		Voxels::World hills;
+		Voxels::TerrainGenerator::GenerateHills(hills, glm::ivec3(256, 64, 256), 1337);
+		RoundTrip("hills 256x64x256", hills, filePath);
+
+		std::filesystem::remove(filePath);
+	}
+}
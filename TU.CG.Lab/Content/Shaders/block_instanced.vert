@@ -0,0 +1,31 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTexCoords;
+layout (location = 3) in int aLayer;
+layout (location = 4) in vec3 aOffset;
+
+layout (std140) uniform Camera
+{
+	mat4 view;
+	mat4 projection;
+	vec3 viewPos;
+};
+
+out vec2 TexCoords;
+out vec3 FragPos;
+out vec3 Normal;
+flat out int Layer;
+
+void main()
+{
+	vec3 worldPosition = aPos + aOffset;
+
+	gl_Position = projection * view * vec4(worldPosition, 1.0f);
+
+	FragPos = worldPosition;
+	Normal = aNormal;
+	TexCoords = aTexCoords;
+	Layer = aLayer;
+}
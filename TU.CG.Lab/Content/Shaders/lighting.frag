@@ -3,32 +3,38 @@
 in vec2 TexCoords;
 in vec3 FragPos;
 in vec3 Normal;
+flat in int Layer;
 
 out vec4 FragColor;
 
 struct Material
 {
-	sampler2D diffuse;
-	sampler2D specular;
+	sampler2DArray diffuse;
+	sampler2DArray specular;
 	float shininess;
 };
 
-struct Light
+uniform Material material;
+
+layout (std140) uniform Camera
+{
+	mat4 view;
+	mat4 projection;
+	vec3 viewPos;
+};
+
+layout (std140) uniform Light
 {
 	vec3 position;
 	vec3 ambient;
 	vec3 diffuse;
 	vec3 specular;
-};
-
-uniform Material material;
-uniform Light light;
-uniform vec3 viewPos;
+} light;
 
 void main()
 {
-	vec3 diffuseMapColor = vec3(texture(material.diffuse, TexCoords));
-	vec3 specularMapColor = vec3(texture(material.specular, TexCoords));
+	vec3 diffuseMapColor = vec3(texture(material.diffuse, vec3(TexCoords, Layer)));
+	vec3 specularMapColor = vec3(texture(material.specular, vec3(TexCoords, Layer)));
 
 	vec3 ambient = light.ambient * diffuseMapColor;
 
@@ -3,15 +3,22 @@
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNormal;
 layout (location = 2) in vec2 aTexCoords;
+layout (location = 3) in int aLayer;
 
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
 uniform mat3 normal;
 
+layout (std140) uniform Camera
+{
+	mat4 view;
+	mat4 projection;
+	vec3 viewPos;
+};
+
 out vec2 TexCoords;
 out vec3 FragPos;
 out vec3 Normal;
+flat out int Layer;
 
 void main()
 {
@@ -22,4 +29,5 @@ void main()
 	FragPos = vec3(model * position);
 	Normal = normal * aNormal;
 	TexCoords = aTexCoords;
+	Layer = aLayer;
 }
@@ -13,17 +13,22 @@ struct Material
 	float shininess;
 };
 
-struct Light
+uniform Material material;
+
+layout (std140) uniform Camera
+{
+	mat4 view;
+	mat4 projection;
+	vec3 viewPos;
+};
+
+layout (std140) uniform Light
 {
 	vec3 position;
 	vec3 ambient;
 	vec3 diffuse;
 	vec3 specular;
-};
-
-uniform Material material;
-uniform Light light;
-uniform vec3 viewPos;
+} light;
 
 void main()
 {
@@ -0,0 +1,550 @@
+#include "BakedTexture.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <span>
+#include <stb/stb_image.h>
+
+#include "Utils/BinaryData.hpp"
+#include "Utils/Hash.hpp"
+
+namespace Graphics
+{
+	namespace
+	{
+		using Block = std::array<std::array<std::uint8_t, 4>, 16>;
+
+		int GetChannelCount(const BakedPixelFormat format)
+		{
+			switch (format)
+			{
+				case BakedPixelFormat::R8:
+				case BakedPixelFormat::BC4:
+					return 1;
+				case BakedPixelFormat::RGB8:
+				case BakedPixelFormat::BC1:
+					return 3;
+				default:
+					return 4;
+			}
+		}
+
+		size_t GetLevelSize(const BakedPixelFormat format, const int width, const int height)
+		{
+			if (!BakedTexture::IsCompressed(format))
+				return static_cast<size_t>(width) * height * GetChannelCount(format);
+
+			const auto blockCount = static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4);
+
+			return blockCount * (format == BakedPixelFormat::BC3 ? 16 : 8);
+		}
+
+		// 2x2 box filter; odd edges repeat their last row or column.
+		std::vector<std::uint8_t> Downsample(
+			const std::vector<std::uint8_t>& pixels, const int width, const int height, const int channels)
+		{
+			const auto nextWidth = std::max(width / 2, 1);
+			const auto nextHeight = std::max(height / 2, 1);
+
+			std::vector<std::uint8_t> next(static_cast<size_t>(nextWidth) * nextHeight * channels);
+
+			for (int y = 0; y < nextHeight; ++y)
+			{
+				const auto y0 = std::min(y * 2, height - 1);
+				const auto y1 = std::min(y * 2 + 1, height - 1);
+
+				for (int x = 0; x < nextWidth; ++x)
+				{
+					const auto x0 = std::min(x * 2, width - 1);
+					const auto x1 = std::min(x * 2 + 1, width - 1);
+
+					for (int c = 0; c < channels; ++c)
+					{
+						const auto sum =
+							pixels[(static_cast<size_t>(y0) * width + x0) * channels + c] +
+							pixels[(static_cast<size_t>(y0) * width + x1) * channels + c] +
+							pixels[(static_cast<size_t>(y1) * width + x0) * channels + c] +
+							pixels[(static_cast<size_t>(y1) * width + x1) * channels + c];
+
+						next[(static_cast<size_t>(y) * nextWidth + x) * channels + c] = static_cast<std::uint8_t>((sum + 2) / 4);
+					}
+				}
+			}
+
+			return next;
+		}
+
+		// Edge blocks of images not a multiple of 4 repeat their last pixels.
+		Block GetBlock(
+			const std::vector<std::uint8_t>& pixels, const int width, const int height, const int channels,
+			const int blockX, const int blockY)
+		{
+			Block block;
+
+			for (int i = 0; i < 16; ++i)
+			{
+				const auto x = std::min(blockX * 4 + i % 4, width - 1);
+				const auto y = std::min(blockY * 4 + i / 4, height - 1);
+				const auto pixel = &pixels[(static_cast<size_t>(y) * width + x) * channels];
+
+				block[i] = { pixel[0], pixel[std::min(1, channels - 1)], pixel[std::min(2, channels - 1)], 255 };
+
+				if (channels == 4)
+					block[i][3] = pixel[3];
+			}
+
+			return block;
+		}
+
+		std::uint16_t PackRgb565(const float r, const float g, const float b)
+		{
+			const auto quantize = [](const float value, const int maximum)
+			{
+				return static_cast<std::uint16_t>(std::clamp(static_cast<int>(value / 255.0f * maximum + 0.5f), 0, maximum));
+			};
+
+			return static_cast<std::uint16_t>(quantize(r, 31) << 11 | quantize(g, 63) << 5 | quantize(b, 31));
+		}
+
+		std::array<int, 3> UnpackRgb565(const std::uint16_t color)
+		{
+			const auto r = color >> 11 & 31;
+			const auto g = color >> 5 & 63;
+			const auto b = color & 31;
+
+			return { r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2 };
+		}
+
+		// Endpoints are the extremes of the block along its principal axis.
+		void EncodeColorBlock(const Block& block, std::byte* output)
+		{
+			float mean[3] = {};
+
+			for (const auto& pixel : block)
+			{
+				for (int c = 0; c < 3; ++c)
+					mean[c] += pixel[c] / 16.0f;
+			}
+
+			float covariance[3][3] = {};
+
+			for (const auto& pixel : block)
+			{
+				for (int i = 0; i < 3; ++i)
+				{
+					for (int j = 0; j < 3; ++j)
+						covariance[i][j] += (pixel[i] - mean[i]) * (pixel[j] - mean[j]);
+				}
+			}
+
+			float axis[3] = { 1.0f, 1.0f, 1.0f };
+
+			for (int iteration = 0; iteration < 8; ++iteration)
+			{
+				float next[3];
+
+				for (int i = 0; i < 3; ++i)
+					next[i] = covariance[i][0] * axis[0] + covariance[i][1] * axis[1] + covariance[i][2] * axis[2];
+
+				const auto length = std::max({ std::abs(next[0]), std::abs(next[1]), std::abs(next[2]) });
+
+				// A flat block has no spread; any axis works.
+				if (length < 1e-6f)
+					break;
+
+				for (int i = 0; i < 3; ++i)
+					axis[i] = next[i] / length;
+			}
+
+			size_t minIndex = 0, maxIndex = 0;
+			float minProjection = std::numeric_limits<float>::max();
+			float maxProjection = std::numeric_limits<float>::lowest();
+
+			for (size_t i = 0; i < block.size(); ++i)
+			{
+				const auto projection = block[i][0] * axis[0] + block[i][1] * axis[1] + block[i][2] * axis[2];
+
+				if (projection < minProjection)
+				{
+					minProjection = projection;
+					minIndex = i;
+				}
+
+				if (projection > maxProjection)
+				{
+					maxProjection = projection;
+					maxIndex = i;
+				}
+			}
+
+			auto color0 = PackRgb565(block[maxIndex][0], block[maxIndex][1], block[maxIndex][2]);
+			auto color1 = PackRgb565(block[minIndex][0], block[minIndex][1], block[minIndex][2]);
+
+			// color0 > color1 selects the four-colour mode; equal endpoints only ever use index 0.
+			if (color0 < color1)
+				std::swap(color0, color1);
+
+			const auto endpoint0 = UnpackRgb565(color0);
+			const auto endpoint1 = UnpackRgb565(color1);
+
+			std::array<int, 3> palette[4] = { endpoint0, endpoint1 };
+
+			for (int c = 0; c < 3; ++c)
+			{
+				palette[2][c] = (2 * endpoint0[c] + endpoint1[c]) / 3;
+				palette[3][c] = (endpoint0[c] + 2 * endpoint1[c]) / 3;
+			}
+
+			std::uint32_t indices = 0;
+
+			for (int i = 0; i < 16 && color0 != color1; ++i)
+			{
+				int bestIndex = 0;
+				int bestDistance = std::numeric_limits<int>::max();
+
+				for (int index = 0; index < 4; ++index)
+				{
+					int distance = 0;
+
+					for (int c = 0; c < 3; ++c)
+						distance += (block[i][c] - palette[index][c]) * (block[i][c] - palette[index][c]);
+
+					if (distance < bestDistance)
+					{
+						bestDistance = distance;
+						bestIndex = index;
+					}
+				}
+
+				indices |= static_cast<std::uint32_t>(bestIndex) << (2 * i);
+			}
+
+			const std::uint64_t encoded = color0 | static_cast<std::uint64_t>(color1) << 16 | static_cast<std::uint64_t>(indices) << 32;
+
+			for (int i = 0; i < 8; ++i)
+				output[i] = static_cast<std::byte>(encoded >> (8 * i));
+		}
+
+		// The BC4 block, also used for the alpha half of BC3.
+		void EncodeSingleChannelBlock(const Block& block, const int channel, std::byte* output)
+		{
+			int maximum = 0, minimum = 255;
+
+			for (const auto& pixel : block)
+			{
+				maximum = std::max(maximum, static_cast<int>(pixel[channel]));
+				minimum = std::min(minimum, static_cast<int>(pixel[channel]));
+			}
+
+			// maximum > minimum selects eight interpolated values, index 0 and 1 being the endpoints.
+			int palette[8] = { maximum, minimum };
+
+			for (int i = 1; i < 7; ++i)
+				palette[i + 1] = ((7 - i) * maximum + i * minimum) / 7;
+
+			std::uint64_t encoded = static_cast<std::uint64_t>(maximum) | static_cast<std::uint64_t>(minimum) << 8;
+
+			for (int i = 0; i < 16 && maximum != minimum; ++i)
+			{
+				int bestIndex = 0;
+
+				for (int index = 1; index < 8; ++index)
+				{
+					if (std::abs(block[i][channel] - palette[index]) < std::abs(block[i][channel] - palette[bestIndex]))
+						bestIndex = index;
+				}
+
+				encoded |= static_cast<std::uint64_t>(bestIndex) << (16 + 3 * i);
+			}
+
+			for (int i = 0; i < 8; ++i)
+				output[i] = static_cast<std::byte>(encoded >> (8 * i));
+		}
+
+		void AppendLevel(
+			std::vector<std::byte>& bytes, const BakedPixelFormat format,
+			const std::vector<std::uint8_t>& pixels, const int width, const int height, const int channels)
+		{
+			const auto size = GetLevelSize(format, width, height);
+
+			Utils::PutUint(bytes, width, 4);
+			Utils::PutUint(bytes, height, 4);
+			Utils::PutUint(bytes, size, 4);
+
+			const auto offset = bytes.size();
+			bytes.resize(offset + size);
+
+			if (!BakedTexture::IsCompressed(format))
+			{
+				std::memcpy(bytes.data() + offset, pixels.data(), size);
+			}
+			else
+			{
+				auto output = bytes.data() + offset;
+
+				for (int blockY = 0; blockY < (height + 3) / 4; ++blockY)
+				{
+					for (int blockX = 0; blockX < (width + 3) / 4; ++blockX)
+					{
+						const auto block = GetBlock(pixels, width, height, channels, blockX, blockY);
+
+						if (format == BakedPixelFormat::BC4)
+						{
+							EncodeSingleChannelBlock(block, 0, output);
+							output += 8;
+						}
+						else if (format == BakedPixelFormat::BC3)
+						{
+							EncodeSingleChannelBlock(block, 3, output);
+							EncodeColorBlock(block, output + 8);
+							output += 16;
+						}
+						else
+						{
+							EncodeColorBlock(block, output);
+							output += 8;
+						}
+					}
+				}
+			}
+
+			bytes.resize((bytes.size() + 3) & ~static_cast<size_t>(3));
+		}
+	}
+
+	BakedTexture BakedTexture::Bake(
+		const unsigned char* pixels, const int width, const int height, const int channels,
+		const bool compress, const std::uint64_t sourceHash)
+	{
+		if (width <= 0 || height <= 0 || channels < 1 || channels > 4)
+			throw std::exception("Cannot bake an empty texture.");
+
+		const auto pixelCount = static_cast<size_t>(width) * height;
+		const auto storedChannels = channels == 2 ? 4 : channels;
+
+		std::vector<std::uint8_t> level(pixelCount * storedChannels);
+
+		if (channels == 2)
+		{
+			for (size_t i = 0; i < pixelCount; ++i)
+			{
+				level[i * 4] = level[i * 4 + 1] = level[i * 4 + 2] = pixels[i * 2];
+				level[i * 4 + 3] = pixels[i * 2 + 1];
+			}
+		}
+		else
+		{
+			std::memcpy(level.data(), pixels, level.size());
+		}
+
+		auto format = storedChannels == 1 ? BakedPixelFormat::R8 :
+			storedChannels == 3 ? BakedPixelFormat::RGB8 : BakedPixelFormat::RGBA8;
+
+		if (compress)
+		{
+			auto isOpaque = true;
+
+			for (size_t i = 3; i < level.size() && storedChannels == 4 && isOpaque; i += 4)
+				isOpaque = level[i] == 255;
+
+			format = storedChannels == 1 ? BakedPixelFormat::BC4 :
+				isOpaque ? BakedPixelFormat::BC1 : BakedPixelFormat::BC3;
+		}
+
+		// Halving down to 1x1, as the driver's own mip chain would.
+		int levelCount = 1;
+
+		for (auto extent = std::max(width, height); extent > 1; extent /= 2)
+			++levelCount;
+
+		std::vector<std::byte> bytes;
+		bytes.reserve(BakedTextureFormat::HEADER_SIZE + level.size() * 2);
+
+		for (const auto character : BakedTextureFormat::MAGIC)
+			bytes.push_back(static_cast<std::byte>(character));
+
+		Utils::PutUint(bytes, BakedTextureFormat::VERSION, 4);
+		Utils::PutUint(bytes, sourceHash, 8);
+		Utils::PutUint(bytes, static_cast<std::uint32_t>(format), 4);
+		Utils::PutUint(bytes, width, 4);
+		Utils::PutUint(bytes, height, 4);
+		Utils::PutUint(bytes, levelCount, 4);
+
+		auto levelWidth = width;
+		auto levelHeight = height;
+
+		for (int i = 0; i < levelCount; ++i)
+		{
+			AppendLevel(bytes, format, level, levelWidth, levelHeight, storedChannels);
+
+			if (i + 1 < levelCount)
+			{
+				level = Downsample(level, levelWidth, levelHeight, storedChannels);
+				levelWidth = std::max(levelWidth / 2, 1);
+				levelHeight = std::max(levelHeight / 2, 1);
+			}
+		}
+
+		BakedTexture texture;
+		texture.bytes = std::move(bytes);
+		texture.Parse(texture.bytes.data(), texture.bytes.size(), "baked in memory");
+
+		return texture;
+	}
+
+	BakedTexture BakedTexture::Load(const std::string& filePath)
+	{
+		BakedTexture texture;
+		texture.file = std::make_unique<Utils::MappedFile>(filePath);
+		texture.Parse(texture.file->GetData(), texture.file->GetSize(), filePath);
+		texture.fromCache = true;
+
+		return texture;
+	}
+
+	void BakedTexture::Save(const std::string& filePath) const
+	{
+		const auto data = file != nullptr ? file->GetData() : bytes.data();
+		const auto size = file != nullptr ? file->GetSize() : bytes.size();
+
+		Utils::WriteFileAtomically(filePath, std::span(data, size));
+	}
+
+	BakedTexture BakedTexture::LoadOrBake(
+		const std::string& sourceFilePath, const std::string& bakeDirectory, const bool compress)
+	{
+		const Utils::MappedFile source(sourceFilePath);
+		const auto sourceHash = Utils::HashBytes(source.GetData(), source.GetSize());
+		const auto cacheFilePath = (std::filesystem::path(bakeDirectory) / GetCacheFileName(sourceHash, compress)).string();
+
+		if (std::filesystem::exists(cacheFilePath))
+		{
+			// A damaged or outdated cache file is simply baked again.
+			try
+			{
+				auto texture = Load(cacheFilePath);
+
+				if (texture.sourceHash == sourceHash)
+					return texture;
+			}
+			catch (const std::exception&)
+			{
+			}
+		}
+
+		int width, height, channels;
+
+		// Decoded from the mapping, so the source is read once for both hash and pixels.
+		const std::unique_ptr<stbi_uc, decltype(&stbi_image_free)> pixels(
+			stbi_load_from_memory(
+				reinterpret_cast<const stbi_uc*>(source.GetData()), static_cast<int>(source.GetSize()),
+				&width, &height, &channels, 0),
+			stbi_image_free);
+
+		if (!pixels)
+		{
+			const auto errorMessage = "Failed to decode texture: " + sourceFilePath;
+			throw std::exception(errorMessage.c_str());
+		}
+
+		auto texture = Bake(pixels.get(), width, height, channels, compress, sourceHash);
+
+		try
+		{
+			texture.Save(cacheFilePath);
+		}
+		catch (const std::exception& exception)
+		{
+			std::cout << "Failed to save baked texture " << cacheFilePath << ": " << exception.what() << std::endl;
+		}
+
+		return texture;
+	}
+
+	std::string BakedTexture::GetCacheFileName(const std::uint64_t sourceHash, const bool compress)
+	{
+		return Utils::ToHexString(sourceHash) + (compress ? ".bc.ttex" : ".raw.ttex");
+	}
+
+	bool BakedTexture::IsCompressed(const BakedPixelFormat format)
+	{
+		return format == BakedPixelFormat::BC1 || format == BakedPixelFormat::BC3 || format == BakedPixelFormat::BC4;
+	}
+
+	size_t BakedTexture::GetDataSize() const
+	{
+		size_t size = 0;
+
+		for (const auto& level : levels)
+			size += level.size;
+
+		return size;
+	}
+
+	void BakedTexture::Parse(const std::byte* data, const size_t size, const std::string& name)
+	{
+		const auto throwCorrupt = [&name](const std::string& reason)
+		{
+			const auto errorMessage = "Invalid baked texture " + name + ": " + reason;
+			throw std::exception(errorMessage.c_str());
+		};
+
+		if (size < BakedTextureFormat::HEADER_SIZE ||
+			std::memcmp(data, BakedTextureFormat::MAGIC, sizeof BakedTextureFormat::MAGIC) != 0)
+		{
+			throwCorrupt("not a baked texture");
+		}
+
+		if (Utils::GetUint(data + 4, 4) != BakedTextureFormat::VERSION)
+			throwCorrupt("unsupported version");
+
+		sourceHash = Utils::GetUint(data + 8, 8);
+
+		const auto formatValue = Utils::GetUint(data + 16, 4);
+
+		if (formatValue > static_cast<std::uint32_t>(BakedPixelFormat::BC4))
+			throwCorrupt("unknown pixel format");
+
+		format = static_cast<BakedPixelFormat>(formatValue);
+		width = static_cast<int>(Utils::GetUint(data + 20, 4));
+		height = static_cast<int>(Utils::GetUint(data + 24, 4));
+
+		const auto levelCount = Utils::GetUint(data + 28, 4);
+
+		if (width <= 0 || height <= 0 || levelCount == 0 || levelCount > 32)
+			throwCorrupt("bad dimensions");
+
+		levels.clear();
+
+		size_t offset = BakedTextureFormat::HEADER_SIZE;
+
+		for (std::uint64_t i = 0; i < levelCount; ++i)
+		{
+			if (size - offset < BakedTextureFormat::LEVEL_HEADER_SIZE)
+				throwCorrupt("level header is truncated");
+
+			BakedTextureLevel level;
+			level.width = static_cast<int>(Utils::GetUint(data + offset, 4));
+			level.height = static_cast<int>(Utils::GetUint(data + offset + 4, 4));
+			level.size = static_cast<size_t>(Utils::GetUint(data + offset + 8, 4));
+			level.data = data + offset + BakedTextureFormat::LEVEL_HEADER_SIZE;
+
+			if (level.width <= 0 || level.height <= 0 || level.size != GetLevelSize(format, level.width, level.height))
+				throwCorrupt("level size does not match its dimensions");
+
+			offset += BakedTextureFormat::LEVEL_HEADER_SIZE;
+
+			if (size - offset < level.size)
+				throwCorrupt("level data is truncated");
+
+			offset = std::min(size, (offset + level.size + 3) & ~static_cast<size_t>(3));
+
+			levels.push_back(level);
+		}
+	}
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Utils/MappedFile.hpp"
+
+namespace Graphics
+{
+	// Layout of a baked texture (.ttex), all integers little-endian:
+	//
+	//   header   magic "TUTX", u32 version, u64 source hash, u32 pixel format,
+	//            u32 width, u32 height, u32 level count
+	//   levels   per mip level, largest first: u32 width, u32 height,
+	//            u32 data size, data padded to 4 bytes
+	//
+	// Block-compressed levels hold ceil(width / 4) * ceil(height / 4) blocks in
+	// row order. Rows of uncompressed levels are tightly packed.
+	namespace BakedTextureFormat
+	{
+		constexpr char MAGIC[4] = { 'T', 'U', 'T', 'X' };
+		constexpr std::uint32_t VERSION = 1;
+		constexpr size_t HEADER_SIZE = 32;
+		constexpr size_t LEVEL_HEADER_SIZE = 12;
+	}
+
+	enum class BakedPixelFormat : std::uint32_t
+	{
+		R8,
+		RGB8,
+		RGBA8,
+		// S3TC DXT1, opaque colour in 8 bytes per 4x4 block.
+		BC1,
+		// S3TC DXT5, colour with interpolated alpha in 16 bytes per block.
+		BC3,
+		// RGTC1, one channel in 8 bytes per block.
+		BC4,
+	};
+
+	struct BakedTextureLevel
+	{
+		int width = 0;
+		int height = 0;
+		const std::byte* data = nullptr;
+		size_t size = 0;
+	};
+
+	// All mip levels of an image, ready to hand to the driver level by level.
+	// Either baked in memory or mapped straight from a cache file.
+	class BakedTexture
+	{
+		private:
+			BakedPixelFormat format = BakedPixelFormat::RGBA8;
+			int width = 0;
+			int height = 0;
+			std::uint64_t sourceHash = 0;
+			std::vector<BakedTextureLevel> levels;
+			bool fromCache = false;
+
+			// Backing store for levels: the file image when baked, the mapping when loaded.
+			std::vector<std::byte> bytes;
+			std::unique_ptr<Utils::MappedFile> file;
+
+			void Parse(const std::byte* data, size_t size, const std::string& name);
+		public:
+			BakedTexture() = default;
+			BakedTexture(const BakedTexture& other) = delete;
+			BakedTexture& operator=(const BakedTexture& other) = delete;
+			BakedTexture(BakedTexture&& other) noexcept = default;
+			BakedTexture& operator=(BakedTexture&& other) noexcept = default;
+			~BakedTexture() = default;
+
+			// Builds the mip chain with a box filter. Channels may be 1 to 4; two
+			// channels are stored as grey RGBA. Compression picks BC4 for one
+			// channel, BC1 when every pixel is opaque and BC3 otherwise.
+			static BakedTexture Bake(
+				const unsigned char* pixels, int width, int height, int channels,
+				bool compress, std::uint64_t sourceHash);
+			// Throws when the file is not a baked texture of this version.
+			static BakedTexture Load(const std::string& filePath);
+			// Written atomically, so a concurrent Load maps either the old file or the new one.
+			void Save(const std::string& filePath) const;
+
+			// Returns the baked copy of an image file kept in bakeDirectory, baking and
+			// saving it first when there is none for the file's current contents.
+			static BakedTexture LoadOrBake(
+				const std::string& sourceFilePath, const std::string& bakeDirectory, bool compress);
+
+			[[nodiscard]] static std::string GetCacheFileName(std::uint64_t sourceHash, bool compress);
+			[[nodiscard]] static bool IsCompressed(BakedPixelFormat format);
+
+			[[nodiscard]] BakedPixelFormat GetFormat() const { return format; }
+			[[nodiscard]] int GetWidth() const { return width; }
+			[[nodiscard]] int GetHeight() const { return height; }
+			[[nodiscard]] std::uint64_t GetSourceHash() const { return sourceHash; }
+			[[nodiscard]] const std::vector<BakedTextureLevel>& GetLevels() const { return levels; }
+			[[nodiscard]] size_t GetDataSize() const;
+			[[nodiscard]] bool IsFromCache() const { return fromCache; }
+	};
+}
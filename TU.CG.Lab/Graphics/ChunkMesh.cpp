@@ -0,0 +1,82 @@
+#include "ChunkMesh.hpp"
+
+#include <glad/glad.h>
+
+namespace Graphics
+{
+	ChunkMesh::ChunkMesh(const Voxels::ChunkMeshData& data)
+		: indexCount(static_cast<int>(data.indices.size())), origin(data.coord * Voxels::CHUNK_SIZE)
+	{
+		if (data.IsEmpty())
+			throw std::exception("Chunk mesh data cannot be empty.");
+
+		for (const auto& vertex : data.vertices)
+			bounds.Extend(glm::vec3(origin) + vertex.Position);
+
+		va = std::make_unique<VertexArray>();
+		va->Bind();
+
+		auto vb = std::make_unique<VertexBuffer>(
+			data.vertices.data(), data.vertices.size() * sizeof(Voxels::ChunkVertex));
+
+		vb->Bind();
+
+		vb->SetAttributes({
+			{"aPos", VertexAttributeType::VEC3F},
+			{"aNormal", VertexAttributeType::VEC3F},
+			{"aTexCoords", VertexAttributeType::VEC2F},
+			{"aLayer", VertexAttributeType::INT},
+		});
+
+		auto eb = std::make_unique<ElementBuffer>(
+			data.indices.data(), static_cast<int>(data.indices.size()));
+
+		eb->Bind();
+
+		va->SetVertexBuffer(std::move(vb));
+		va->SetElementBuffer(std::move(eb));
+
+		va->Unbind();
+	}
+
+	ChunkMesh::ChunkMesh(ChunkMesh&& other) noexcept
+		: va(std::move(other.va)), indexCount(other.indexCount), origin(other.origin),
+		bounds(other.bounds)
+	{
+	}
+
+	ChunkMesh& ChunkMesh::operator=(ChunkMesh&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Delete();
+
+			va = std::move(other.va);
+			indexCount = other.indexCount;
+			origin = other.origin;
+			bounds = other.bounds;
+		}
+
+		return *this;
+	}
+
+	ChunkMesh::~ChunkMesh()
+	{
+		Delete();
+	}
+
+	void ChunkMesh::Draw() const
+	{
+		va->Bind();
+
+		glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+
+		va->Unbind();
+	}
+
+	void ChunkMesh::Delete()
+	{
+		indexCount = 0;
+		va = nullptr;
+	}
+}
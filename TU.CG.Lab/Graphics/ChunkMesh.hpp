@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <glm/glm.hpp>
+
+#include "VertexArray.hpp"
+#include "Utils/BoundingBox.hpp"
+#include "Voxels/ChunkMesher.hpp"
+
+namespace Graphics
+{
+	class ChunkMesh
+	{
+		private:
+			std::unique_ptr<VertexArray> va;
+			int indexCount;
+			glm::ivec3 origin;
+			Utils::BoundingBox bounds;
+
+			void Delete();
+		public:
+			explicit ChunkMesh(const Voxels::ChunkMeshData& data);
+			ChunkMesh(const ChunkMesh& other) = delete;
+			ChunkMesh& operator=(const ChunkMesh& other) = delete;
+			ChunkMesh(ChunkMesh&& other) noexcept;
+			ChunkMesh& operator=(ChunkMesh&& other) noexcept;
+			~ChunkMesh();
+
+			// One draw for the whole chunk; materials come from the block texture arrays.
+			void Draw() const;
+
+			[[nodiscard]] glm::ivec3 GetOrigin() const { return origin; }
+			// Bounds of the emitted faces, in world space.
+			[[nodiscard]] const Utils::BoundingBox& GetBounds() const { return bounds; }
+			[[nodiscard]] int GetIndexCount() const { return indexCount; }
+	};
+}
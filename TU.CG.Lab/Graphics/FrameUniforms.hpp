@@ -0,0 +1,30 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Graphics
+{
+	// std140 mirrors of the uniform blocks declared in the shaders. vec3
+	// members are stored as vec4 to match std140's 16 byte alignment.
+
+	constexpr unsigned CAMERA_UNIFORMS_BINDING = 0;
+	constexpr unsigned LIGHT_UNIFORMS_BINDING = 1;
+
+	struct CameraUniforms
+	{
+		glm::mat4 view;
+		glm::mat4 projection;
+		glm::vec4 viewPos;
+	};
+
+	struct LightUniforms
+	{
+		glm::vec4 position;
+		glm::vec4 ambient;
+		glm::vec4 diffuse;
+		glm::vec4 specular;
+	};
+
+	static_assert(sizeof(CameraUniforms) == 144, "CameraUniforms must follow std140 layout.");
+	static_assert(sizeof(LightUniforms) == 64, "LightUniforms must follow std140 layout.");
+}
@@ -0,0 +1,95 @@
+#include "Framebuffer.hpp"
+
+#include <exception>
+#include <glad/glad.h>
+
+namespace Graphics
+{
+	Framebuffer::Framebuffer(const int width, const int height)
+		: width(width), height(height)
+	{
+		if (width <= 0 || height <= 0)
+			throw std::exception("Framebuffer size must be positive.");
+
+		glGenFramebuffers(1, &id);
+		glBindFramebuffer(GL_FRAMEBUFFER, id);
+
+		glGenRenderbuffers(1, &colorRenderbuffer);
+		glBindRenderbuffer(GL_RENDERBUFFER, colorRenderbuffer);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorRenderbuffer);
+
+		glGenRenderbuffers(1, &depthRenderbuffer);
+		glBindRenderbuffer(GL_RENDERBUFFER, depthRenderbuffer);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthRenderbuffer);
+
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+		const auto status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+		if (status != GL_FRAMEBUFFER_COMPLETE)
+		{
+			Delete();
+			throw std::exception("Offscreen framebuffer is incomplete.");
+		}
+	}
+
+	Framebuffer::Framebuffer(Framebuffer&& other) noexcept
+		: id(other.id), colorRenderbuffer(other.colorRenderbuffer), depthRenderbuffer(other.depthRenderbuffer),
+		width(other.width), height(other.height)
+	{
+		other.id = 0;
+		other.colorRenderbuffer = 0;
+		other.depthRenderbuffer = 0;
+	}
+
+	Framebuffer& Framebuffer::operator=(Framebuffer&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Delete();
+
+			id = other.id;
+			colorRenderbuffer = other.colorRenderbuffer;
+			depthRenderbuffer = other.depthRenderbuffer;
+			width = other.width;
+			height = other.height;
+
+			other.id = 0;
+			other.colorRenderbuffer = 0;
+			other.depthRenderbuffer = 0;
+		}
+
+		return *this;
+	}
+
+	Framebuffer::~Framebuffer()
+	{
+		Delete();
+	}
+
+	void Framebuffer::Bind() const
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, id);
+		glViewport(0, 0, width, height);
+	}
+
+	void Framebuffer::Unbind() const
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	}
+
+	void Framebuffer::Delete()
+	{
+		glDeleteRenderbuffers(1, &depthRenderbuffer);
+		glDeleteRenderbuffers(1, &colorRenderbuffer);
+		glDeleteFramebuffers(1, &id);
+
+		id = 0;
+		colorRenderbuffer = 0;
+		depthRenderbuffer = 0;
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+namespace Graphics
+{
+	// Offscreen render target with RGBA8 colour and 24-bit depth renderbuffers.
+	class Framebuffer
+	{
+		private:
+			unsigned id = 0;
+			unsigned colorRenderbuffer = 0;
+			unsigned depthRenderbuffer = 0;
+			int width = 0;
+			int height = 0;
+
+			void Delete();
+		public:
+			Framebuffer(int width, int height);
+			Framebuffer(const Framebuffer& other) = delete;
+			Framebuffer& operator=(const Framebuffer& other) = delete;
+			Framebuffer(Framebuffer&& other) noexcept;
+			Framebuffer& operator=(Framebuffer&& other) noexcept;
+			~Framebuffer();
+
+			// Binds for drawing and sets the viewport to the whole framebuffer.
+			void Bind() const;
+			void Unbind() const;
+
+			[[nodiscard]] int GetWidth() const { return width; }
+			[[nodiscard]] int GetHeight() const { return height; }
+	};
+}
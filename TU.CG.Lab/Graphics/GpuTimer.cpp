@@ -0,0 +1,139 @@
+#include "GpuTimer.hpp"
+
+#include <cstdint>
+#include <glad/glad.h>
+
+namespace Graphics
+{
+	GpuTimer::GpuTimer(const std::vector<std::string>& passNames, const size_t frameLatency, const size_t historySize)
+		: frameLatency(frameLatency)
+	{
+		if (passNames.empty())
+			throw std::exception("A GPU timer needs at least one pass.");
+		if (frameLatency == 0)
+			throw std::exception("GPU timer frame latency must be at least one frame.");
+
+		for (const auto& name : passNames)
+			passes.push_back({ name, Utils::RollingStatistics(historySize) });
+
+		slots.resize(frameLatency * passes.size());
+
+		std::vector<unsigned> queries(slots.size());
+		glGenQueries(static_cast<GLsizei>(queries.size()), queries.data());
+
+		for (size_t i = 0; i < slots.size(); ++i)
+			slots[i].query = queries[i];
+	}
+
+	GpuTimer::GpuTimer(GpuTimer&& other) noexcept
+		: passes(std::move(other.passes)), slots(std::move(other.slots)),
+		frameLatency(other.frameLatency), frame(other.frame), skippedQueries(other.skippedQueries)
+	{
+		other.slots.clear();
+	}
+
+	GpuTimer& GpuTimer::operator=(GpuTimer&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Delete();
+
+			passes = std::move(other.passes);
+			slots = std::move(other.slots);
+			frameLatency = other.frameLatency;
+			frame = other.frame;
+			activeSlot = nullptr;
+			isPassActive = false;
+			skippedQueries = other.skippedQueries;
+
+			other.slots.clear();
+		}
+
+		return *this;
+	}
+
+	GpuTimer::~GpuTimer()
+	{
+		Delete();
+	}
+
+	void GpuTimer::BeginFrame()
+	{
+		if (isPassActive)
+			throw std::exception("GPU timer frame started inside a pass.");
+
+		++frame;
+
+		const auto row = (frame % frameLatency) * passes.size();
+
+		for (size_t pass = 0; pass < passes.size(); ++pass)
+		{
+			auto& slot = slots[row + pass];
+
+			if (!slot.pending)
+				continue;
+
+			GLint available = GL_FALSE;
+			glGetQueryObjectiv(slot.query, GL_QUERY_RESULT_AVAILABLE, &available);
+
+			if (available == GL_FALSE)
+				continue;
+
+			GLuint64 nanoseconds = 0;
+			glGetQueryObjectui64v(slot.query, GL_QUERY_RESULT, &nanoseconds);
+
+			passes[pass].milliseconds.Add(static_cast<double>(nanoseconds) * 1e-6);
+			slot.pending = false;
+		}
+	}
+
+	void GpuTimer::BeginPass(const size_t pass)
+	{
+		if (isPassActive)
+			throw std::exception("GPU timer passes cannot nest.");
+
+		isPassActive = true;
+
+		auto& slot = slots[(frame % frameLatency) * passes.size() + pass];
+
+		if (slot.pending)
+		{
+			activeSlot = nullptr;
+			++skippedQueries;
+			return;
+		}
+
+		activeSlot = &slot;
+		glBeginQuery(GL_TIME_ELAPSED, slot.query);
+	}
+
+	void GpuTimer::EndPass()
+	{
+		if (!isPassActive)
+			throw std::exception("GPU timer pass ended without being started.");
+
+		isPassActive = false;
+
+		if (activeSlot == nullptr)
+			return;
+
+		glEndQuery(GL_TIME_ELAPSED);
+
+		activeSlot->pending = true;
+		activeSlot = nullptr;
+	}
+
+	void GpuTimer::Delete()
+	{
+		std::vector<unsigned> queries;
+		queries.reserve(slots.size());
+
+		for (const auto& slot : slots)
+			queries.push_back(slot.query);
+
+		if (!queries.empty())
+			glDeleteQueries(static_cast<GLsizei>(queries.size()), queries.data());
+
+		slots.clear();
+	}
+}
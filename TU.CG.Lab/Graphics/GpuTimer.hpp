@@ -0,0 +1,60 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Utils/RollingStatistics.hpp"
+
+namespace Graphics
+{
+	// GL_TIME_ELAPSED queries around named render passes. Each pass keeps one
+	// query per frame in flight and reads it frameLatency frames later, so the
+	// CPU never waits on the GPU for a result. Passes must not nest.
+	class GpuTimer
+	{
+		private:
+			struct Pass
+			{
+				std::string name;
+				Utils::RollingStatistics milliseconds;
+			};
+
+			struct Slot
+			{
+				unsigned query = 0;
+				bool pending = false;
+			};
+
+			std::vector<Pass> passes;
+			// frameLatency rows of one slot per pass.
+			std::vector<Slot> slots;
+			size_t frameLatency = 0;
+			size_t frame = 0;
+
+			Slot* activeSlot = nullptr;
+			bool isPassActive = false;
+			size_t skippedQueries = 0;
+
+			void Delete();
+		public:
+			GpuTimer(const std::vector<std::string>& passNames, size_t frameLatency = 4, size_t historySize = 240);
+			GpuTimer(const GpuTimer& other) = delete;
+			GpuTimer& operator=(const GpuTimer& other) = delete;
+			GpuTimer(GpuTimer&& other) noexcept;
+			GpuTimer& operator=(GpuTimer&& other) noexcept;
+			~GpuTimer();
+
+			// Collects results that are ready and moves to the next row of queries.
+			void BeginFrame();
+			// A pass whose query from frameLatency frames ago is still running goes
+			// unmeasured this frame rather than stalling.
+			void BeginPass(size_t pass);
+			void EndPass();
+
+			[[nodiscard]] size_t GetPassCount() const { return passes.size(); }
+			[[nodiscard]] const std::string& GetPassName(const size_t pass) const { return passes[pass].name; }
+			// Milliseconds of GPU time for each measured frame.
+			[[nodiscard]] const Utils::RollingStatistics& GetPassTimes(const size_t pass) const { return passes[pass].milliseconds; }
+			[[nodiscard]] size_t GetSkippedQueries() const { return skippedQueries; }
+	};
+}
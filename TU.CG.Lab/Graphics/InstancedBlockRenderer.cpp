@@ -0,0 +1,54 @@
+#include "InstancedBlockRenderer.hpp"
+
+#include <glad/glad.h>
+
+#include "Voxels/BlockRegistry.hpp"
+
+namespace Graphics
+{
+	InstancedBlockRenderer::InstancedBlockRenderer(std::unique_ptr<VertexBuffer> cubeVb, const int cubeVertexCount)
+		: va(std::make_unique<VertexArray>()), cubeVertexCount(cubeVertexCount)
+	{
+		va->SetVertexBuffer(std::move(cubeVb));
+
+		auto vb = std::make_unique<VertexBuffer>(nullptr, 0, BufferUsage::DYNAMIC_DRAW);
+
+		vb->SetAttributes({
+			{"aLayer", VertexAttributeType::INT, 1},
+			{"aOffset", VertexAttributeType::VEC3F, 1},
+		});
+
+		instanceBuffer = va->AddVertexBuffer(std::move(vb));
+
+		va->Unbind();
+	}
+
+	void InstancedBlockRenderer::SetInstances(const std::vector<BlockInstance>& newInstances)
+	{
+		instances.clear();
+		instances.reserve(newInstances.size());
+
+		for (const auto& instance : newInstances)
+		{
+			instances.push_back({
+				Voxels::BlockRegistry::GetMaterialLayer(static_cast<Voxels::BlockType>(instance.type)),
+				instance.position });
+		}
+
+		if (!instances.empty())
+			instanceBuffer->SetData(instances.data(), instances.size() * sizeof(InstanceData));
+	}
+
+	void InstancedBlockRenderer::Draw() const
+	{
+		if (instances.empty())
+			return;
+
+		va->Bind();
+
+		glDrawArraysInstanced(
+			GL_TRIANGLES, 0, cubeVertexCount, static_cast<int>(instances.size()));
+
+		va->Unbind();
+	}
+}
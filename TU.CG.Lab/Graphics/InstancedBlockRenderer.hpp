@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "VertexArray.hpp"
+#include "Voxels/BlockType.hpp"
+
+namespace Graphics
+{
+	struct BlockInstance
+	{
+		glm::vec3 position;
+		int type;
+	};
+
+	// Draws many copies of a unit cube with one glDrawArraysInstanced, fed by a
+	// per-instance (texture layer, position) stream. The cube gets a VertexArray of
+	// its own, so the instance stream never leaks into other draws of that cube.
+	class InstancedBlockRenderer
+	{
+		private:
+			struct InstanceData
+			{
+				int layer;
+				glm::vec3 offset;
+			};
+
+			std::unique_ptr<VertexArray> va;
+			int cubeVertexCount;
+			VertexBuffer* instanceBuffer;
+
+			std::vector<InstanceData> instances;
+		public:
+			InstancedBlockRenderer(std::unique_ptr<VertexBuffer> cubeVb, int cubeVertexCount);
+			InstancedBlockRenderer(const InstancedBlockRenderer& other) = delete;
+			InstancedBlockRenderer& operator=(const InstancedBlockRenderer& other) = delete;
+			InstancedBlockRenderer(InstancedBlockRenderer&& other) = delete;
+			InstancedBlockRenderer& operator=(InstancedBlockRenderer&& other) = delete;
+			~InstancedBlockRenderer() = default;
+
+			void SetInstances(const std::vector<BlockInstance>& newInstances);
+			void Draw() const;
+
+			[[nodiscard]] size_t GetInstanceCount() const { return instances.size(); }
+	};
+}
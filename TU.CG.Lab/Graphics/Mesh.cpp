@@ -5,10 +5,11 @@
 namespace Graphics
 {
 	Mesh::Mesh(
-		const std::vector<Vertex>& vertices,
-		const std::vector<unsigned>& indices,
-		std::vector<Texture> textures)
-			: textures(std::move(textures))
+		const std::span<const Vertex> vertices,
+		const std::span<const unsigned> indices,
+		std::vector<Texture> textures,
+		const Utils::BoundingBox& bounds)
+			: bounds(bounds), textures(std::move(textures))
 	{
 		if (vertices.empty())
 			throw std::exception("Vertices array cannot be empty.");
@@ -40,7 +41,7 @@ namespace Graphics
 	}
 
 	Mesh::Mesh(Mesh&& other) noexcept
-		: va(std::move(other.va)), textures(std::move(other.textures))
+		: va(std::move(other.va)), bounds(other.bounds), textures(std::move(other.textures))
 	{
 	}
 
@@ -51,6 +52,7 @@ namespace Graphics
 			Delete();
 
 			va = std::move(other.va);
+			bounds = other.bounds;
 			textures = std::move(other.textures);
 		}
 
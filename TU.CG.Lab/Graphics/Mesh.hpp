@@ -1,35 +1,32 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <vector>
-#include <glm/glm.hpp>
 
 #include "ShaderProgram.hpp"
 #include "Texture.hpp"
+#include "Vertex.hpp"
 #include "VertexArray.hpp"
+#include "Utils/BoundingBox.hpp"
 
 namespace Graphics
 {
-	struct Vertex
-	{
-		glm::vec3 Position;
-		glm::vec3 Normal;
-		glm::vec2 TexCoords;
-	};
-
 	class Mesh
 	{
 		private:
 			std::unique_ptr<VertexArray> va;
+			Utils::BoundingBox bounds;
 
 			void Delete();
 		public:
 			std::vector<Texture> textures;
 
 			Mesh(
-				const std::vector<Vertex>& vertices,
-				const std::vector<unsigned>& indices,
-				std::vector<Texture> textures);
+				std::span<const Vertex> vertices,
+				std::span<const unsigned> indices,
+				std::vector<Texture> textures,
+				const Utils::BoundingBox& bounds);
 
 			Mesh(const Mesh& other) = delete;
 			Mesh& operator=(const Mesh& other) = delete;
@@ -38,5 +35,7 @@ namespace Graphics
 			~Mesh();
 
 			void Draw(const ShaderProgram& shader) const;
+
+			[[nodiscard]] const Utils::BoundingBox& GetBounds() const { return bounds; }
 	};
 }
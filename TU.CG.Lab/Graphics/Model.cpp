@@ -7,10 +7,13 @@ namespace Graphics
 	{
 		if (this->meshes.empty())
 			throw std::exception("Meshes array cannot be empty.");
+
+		for (const auto& mesh : this->meshes)
+			bounds.Extend(mesh.GetBounds());
 	}
 
 	Model::Model(Model&& other) noexcept
-		: meshes(std::move(other.meshes))
+		: meshes(std::move(other.meshes)), bounds(other.bounds)
 	{
 	}
 
@@ -21,6 +24,7 @@ namespace Graphics
 			Delete();
 
 			meshes = std::move(other.meshes);
+			bounds = other.bounds;
 		}
 
 		return *this;
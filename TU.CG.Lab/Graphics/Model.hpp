@@ -11,6 +11,7 @@ namespace Graphics
 	{
 		private:
 			std::vector<Mesh> meshes;
+			Utils::BoundingBox bounds;
 
 			void Delete();
 		public:
@@ -22,5 +23,8 @@ namespace Graphics
 			~Model();
 
 			void Draw(const ShaderProgram& shader) const;
+
+			// Bounds of all meshes, in model space.
+			[[nodiscard]] const Utils::BoundingBox& GetBounds() const { return bounds; }
 	};
 }
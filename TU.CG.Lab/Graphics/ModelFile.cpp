@@ -0,0 +1,184 @@
+#include "ModelFile.hpp"
+
+#include <cstring>
+
+#include "Utils/BinaryData.hpp"
+
+namespace Graphics
+{
+	static_assert(sizeof(Vertex) == 32, "the model cache stores Vertex as eight floats");
+
+	void ModelFile::AddMesh(
+		std::vector<Vertex> vertices, std::vector<unsigned> indices,
+		std::vector<std::string> texturePaths)
+	{
+		MeshData mesh;
+
+		for (const auto& vertex : vertices)
+			mesh.bounds.Extend(vertex.Position);
+
+		bounds.Extend(mesh.bounds);
+
+		// The storage vectors may reallocate, but the arrays they own stay put.
+		vertexStorage.push_back(std::move(vertices));
+		indexStorage.push_back(std::move(indices));
+
+		mesh.vertices = vertexStorage.back();
+		mesh.indices = indexStorage.back();
+		mesh.texturePaths = std::move(texturePaths);
+
+		meshes.push_back(std::move(mesh));
+	}
+
+	ModelFile ModelFile::Load(const std::string& filePath)
+	{
+		ModelFile modelFile;
+		modelFile.file = std::make_unique<Utils::MappedFile>(filePath);
+		modelFile.Parse(modelFile.file->GetData(), modelFile.file->GetSize(), filePath);
+		modelFile.fromCache = true;
+
+		return modelFile;
+	}
+
+	void ModelFile::Save(const std::string& filePath) const
+	{
+		std::vector<std::byte> bytes;
+
+		Utils::PutBytes(bytes, ModelFileFormat::MAGIC, sizeof ModelFileFormat::MAGIC);
+		Utils::PutUint(bytes, ModelFileFormat::VERSION, 4);
+		Utils::PutUint(bytes, sourceHash, 8);
+		Utils::PutUint(bytes, meshes.size(), 4);
+		Utils::PutUint(bytes, sizeof(Vertex), 4);
+		Utils::PutUint(bytes, 0, 8);
+
+		for (const auto& mesh : meshes)
+		{
+			Utils::PutUint(bytes, mesh.vertices.size(), 4);
+			Utils::PutUint(bytes, mesh.indices.size(), 4);
+			Utils::PutUint(bytes, mesh.texturePaths.size(), 4);
+
+			for (int axis = 0; axis < 3; ++axis)
+				Utils::PutFloat(bytes, mesh.bounds.min[axis]);
+
+			for (int axis = 0; axis < 3; ++axis)
+				Utils::PutFloat(bytes, mesh.bounds.max[axis]);
+
+			for (const auto& texturePath : mesh.texturePaths)
+			{
+				Utils::PutUint(bytes, texturePath.size(), 4);
+				Utils::PutBytes(bytes, texturePath.data(), texturePath.size());
+			}
+
+			Utils::PadToFour(bytes);
+			Utils::PutBytes(bytes, mesh.vertices.data(), mesh.vertices.size_bytes());
+			Utils::PutBytes(bytes, mesh.indices.data(), mesh.indices.size_bytes());
+		}
+
+		Utils::WriteFileAtomically(filePath, bytes);
+	}
+
+	size_t ModelFile::GetVertexCount() const
+	{
+		size_t count = 0;
+
+		for (const auto& mesh : meshes)
+			count += mesh.vertices.size();
+
+		return count;
+	}
+
+	size_t ModelFile::GetIndexCount() const
+	{
+		size_t count = 0;
+
+		for (const auto& mesh : meshes)
+			count += mesh.indices.size();
+
+		return count;
+	}
+
+	void ModelFile::Parse(const std::byte* data, const size_t size, const std::string& name)
+	{
+		const auto throwCorrupt = [&name](const std::string& reason)
+		{
+			const auto errorMessage = "Invalid model cache " + name + ": " + reason;
+			throw std::exception(errorMessage.c_str());
+		};
+
+		if (size < ModelFileFormat::HEADER_SIZE ||
+			std::memcmp(data, ModelFileFormat::MAGIC, sizeof ModelFileFormat::MAGIC) != 0)
+		{
+			throwCorrupt("not a model cache");
+		}
+
+		if (Utils::GetUint(data + 4, 4) != ModelFileFormat::VERSION)
+			throwCorrupt("unsupported version");
+
+		if (Utils::GetUint(data + 20, 4) != sizeof(Vertex))
+			throwCorrupt("vertex layout does not match this build");
+
+		sourceHash = Utils::GetUint(data + 8, 8);
+
+		const auto meshCount = Utils::GetUint(data + 16, 4);
+
+		meshes.clear();
+		bounds = Utils::BoundingBox();
+
+		size_t offset = ModelFileFormat::HEADER_SIZE;
+
+		for (std::uint64_t i = 0; i < meshCount; ++i)
+		{
+			if (size - offset < ModelFileFormat::MESH_HEADER_SIZE)
+				throwCorrupt("mesh header is truncated");
+
+			const auto header = data + offset;
+			const auto vertexCount = Utils::GetUint(header, 4);
+			const auto indexCount = Utils::GetUint(header + 4, 4);
+			const auto textureCount = Utils::GetUint(header + 8, 4);
+
+			MeshData mesh;
+			mesh.bounds.min = glm::vec3(Utils::GetFloat(header + 12), Utils::GetFloat(header + 16), Utils::GetFloat(header + 20));
+			mesh.bounds.max = glm::vec3(Utils::GetFloat(header + 24), Utils::GetFloat(header + 28), Utils::GetFloat(header + 32));
+
+			offset += ModelFileFormat::MESH_HEADER_SIZE;
+
+			for (std::uint64_t texture = 0; texture < textureCount; ++texture)
+			{
+				if (size - offset < 4)
+					throwCorrupt("texture path is truncated");
+
+				const auto length = static_cast<size_t>(Utils::GetUint(data + offset, 4));
+				offset += 4;
+
+				if (size - offset < length)
+					throwCorrupt("texture path is truncated");
+
+				mesh.texturePaths.emplace_back(reinterpret_cast<const char*>(data + offset), length);
+				offset += length;
+			}
+
+			offset = (offset + 3) & ~static_cast<size_t>(3);
+
+			if (offset > size || (size - offset) / sizeof(Vertex) < vertexCount)
+				throwCorrupt("vertices are truncated");
+
+			mesh.vertices = std::span(reinterpret_cast<const Vertex*>(data + offset), static_cast<size_t>(vertexCount));
+			offset += mesh.vertices.size_bytes();
+
+			if ((size - offset) / sizeof(unsigned) < indexCount)
+				throwCorrupt("indices are truncated");
+
+			mesh.indices = std::span(reinterpret_cast<const unsigned*>(data + offset), static_cast<size_t>(indexCount));
+			offset += mesh.indices.size_bytes();
+
+			for (const auto index : mesh.indices)
+			{
+				if (index >= vertexCount)
+					throwCorrupt("index is out of range");
+			}
+
+			bounds.Extend(mesh.bounds);
+			meshes.push_back(std::move(mesh));
+		}
+	}
+}
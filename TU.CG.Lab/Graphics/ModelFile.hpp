@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Vertex.hpp"
+#include "Utils/BoundingBox.hpp"
+#include "Utils/MappedFile.hpp"
+
+namespace Graphics
+{
+	// Layout of a cached model (.tmdl), all integers little-endian:
+	//
+	//   header   magic "TUMD", u32 version, u64 source hash, u32 mesh count,
+	//            u32 vertex size, u64 reserved
+	//   meshes   per mesh: u32 vertex count, u32 index count, u32 texture count,
+	//            f32 bounds min xyz, f32 bounds max xyz, per texture u32 length
+	//            and the path, padding to 4 bytes, the vertices in the in-memory
+	//            Vertex layout, then u32 indices
+	//
+	// Vertices and indices are used straight from the mapping, so the file is
+	// only valid for builds with the same Vertex layout.
+	namespace ModelFileFormat
+	{
+		constexpr char MAGIC[4] = { 'T', 'U', 'M', 'D' };
+		constexpr std::uint32_t VERSION = 2;
+		constexpr size_t HEADER_SIZE = 32;
+		constexpr size_t MESH_HEADER_SIZE = 36;
+	}
+
+	struct MeshData
+	{
+		std::span<const Vertex> vertices;
+		std::span<const unsigned> indices;
+		// Diffuse maps first, then specular; as the material names them, relative to
+		// the model file's directory. Keeps one cache file valid for every copy of a
+		// model, wherever it lives.
+		std::vector<std::string> texturePaths;
+		Utils::BoundingBox bounds;
+	};
+
+	// The meshes of a model without any GL objects: imported, or mapped from a cache file.
+	class ModelFile
+	{
+		private:
+			std::vector<MeshData> meshes;
+			Utils::BoundingBox bounds;
+			std::uint64_t sourceHash = 0;
+			bool fromCache = false;
+
+			// Backing store of the mesh spans: the imported arrays, or the mapping.
+			std::vector<std::vector<Vertex>> vertexStorage;
+			std::vector<std::vector<unsigned>> indexStorage;
+			std::unique_ptr<Utils::MappedFile> file;
+
+			void Parse(const std::byte* data, size_t size, const std::string& name);
+		public:
+			ModelFile() = default;
+			ModelFile(const ModelFile& other) = delete;
+			ModelFile& operator=(const ModelFile& other) = delete;
+			ModelFile(ModelFile&& other) noexcept = default;
+			ModelFile& operator=(ModelFile&& other) noexcept = default;
+			~ModelFile() = default;
+
+			void AddMesh(
+				std::vector<Vertex> vertices, std::vector<unsigned> indices,
+				std::vector<std::string> texturePaths);
+
+			// Throws when the file is not a model cache of this version.
+			static ModelFile Load(const std::string& filePath);
+			// Replaces filePath in one step; readers see the old file or the new one.
+			void Save(const std::string& filePath) const;
+
+			void SetSourceHash(const std::uint64_t hash) { sourceHash = hash; }
+
+			[[nodiscard]] const std::vector<MeshData>& GetMeshes() const { return meshes; }
+			[[nodiscard]] const Utils::BoundingBox& GetBounds() const { return bounds; }
+			[[nodiscard]] std::uint64_t GetSourceHash() const { return sourceHash; }
+			[[nodiscard]] bool IsFromCache() const { return fromCache; }
+			[[nodiscard]] size_t GetVertexCount() const;
+			[[nodiscard]] size_t GetIndexCount() const;
+	};
+}
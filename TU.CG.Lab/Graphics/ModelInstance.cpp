@@ -0,0 +1,31 @@
+#include "ModelInstance.hpp"
+
+#include <glm/gtc/matrix_inverse.hpp>
+
+namespace Graphics
+{
+	ModelInstance::ModelInstance(std::shared_ptr<const Model> model, const glm::mat4& transform)
+		: model(std::move(model))
+	{
+		if (this->model == nullptr)
+			throw std::exception("Model instance needs a model.");
+
+		SetTransform(transform);
+	}
+
+	void ModelInstance::Draw(
+		const ShaderProgram& shader, const UniformHandle modelUniform, const UniformHandle normalUniform) const
+	{
+		ShaderProgram::SetMat4f(modelUniform, transform);
+		ShaderProgram::SetMat3f(normalUniform, normalMatrix);
+
+		model->Draw(shader);
+	}
+
+	void ModelInstance::SetTransform(const glm::mat4& newTransform)
+	{
+		transform = newTransform;
+		normalMatrix = glm::inverseTranspose(glm::mat3(transform));
+		bounds = model->GetBounds().Transform(transform);
+	}
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <glm/glm.hpp>
+
+#include "Model.hpp"
+#include "ShaderProgram.hpp"
+#include "Utils/BoundingBox.hpp"
+
+namespace Graphics
+{
+	// One placement of a shared model: the model's buffers and textures are
+	// shared, only the transform is per instance.
+	class ModelInstance
+	{
+		private:
+			std::shared_ptr<const Model> model;
+			glm::mat4 transform;
+			// Derived from the transform when it is set, not every frame.
+			glm::mat3 normalMatrix;
+			Utils::BoundingBox bounds;
+		public:
+			explicit ModelInstance(std::shared_ptr<const Model> model, const glm::mat4& transform = glm::mat4(1.0f));
+
+			// Sets the shader's "model" and "normal" uniforms through handles resolved
+			// once by the caller, then draws the model.
+			void Draw(const ShaderProgram& shader, UniformHandle modelUniform, UniformHandle normalUniform) const;
+
+			void SetTransform(const glm::mat4& newTransform);
+
+			[[nodiscard]] const std::shared_ptr<const Model>& GetModel() const { return model; }
+			[[nodiscard]] const glm::mat4& GetTransform() const { return transform; }
+			[[nodiscard]] const glm::mat3& GetNormalMatrix() const { return normalMatrix; }
+			// Bounds of the model in world space.
+			[[nodiscard]] const Utils::BoundingBox& GetBounds() const { return bounds; }
+	};
+}
@@ -2,14 +2,34 @@
 
 #include <assimp/postprocess.h>
 #include <filesystem>
+#include <iostream>
 
 #include "TextureCache.hpp"
+#include "Utils/Hash.hpp"
+#include "Utils/Profiler.hpp"
 
 namespace Graphics
 {
 	std::unique_ptr<Model> ModelLoader::Load(
-		const std::string& modelFilePath, TextureCache& textureCache)
+		const std::string& modelFilePath, TextureCache& textureCache,
+		const std::string& cacheDirectory)
 	{
+		PROFILE_ZONE("ModelLoader::Load");
+
+		const auto modelFile = cacheDirectory.empty() ?
+			Import(modelFilePath) : LoadOrImport(modelFilePath, cacheDirectory);
+
+		const auto modelDirectory = std::filesystem::path(modelFilePath)
+			.parent_path()
+			.string();
+
+		return CreateModel(modelFile, modelDirectory, textureCache);
+	}
+
+	ModelFile ModelLoader::Import(const std::string& modelFilePath)
+	{
+		PROFILE_ZONE("ModelLoader::Import");
+
 		Assimp::Importer importer;
 
 		constexpr auto flags = aiProcess_Triangulate | aiProcess_GenSmoothNormals |
@@ -25,49 +45,102 @@ namespace Graphics
 			throw std::exception(errorMessage.c_str());
 		}
 
-		const auto modelDirectory = std::filesystem::path(modelFilePath)
-			.parent_path()
-			.string();
+		ModelFile modelFile;
+
+		ProcessNode(scene->mRootNode, scene, modelFile);
+
+		return modelFile;
+	}
+
+	ModelFile ModelLoader::LoadOrImport(const std::string& modelFilePath, const std::string& cacheDirectory)
+	{
+		std::uint64_t sourceHash;
+
+		{
+			const Utils::MappedFile source(modelFilePath);
+			sourceHash = Utils::HashBytes(source.GetData(), source.GetSize());
+		}
+
+		const auto cacheFilePath = (std::filesystem::path(cacheDirectory) / (Utils::ToHexString(sourceHash) + ".tmdl")).string();
+
+		if (std::filesystem::exists(cacheFilePath))
+		{
+			// A damaged or outdated cache file is simply imported again.
+			try
+			{
+				auto modelFile = ModelFile::Load(cacheFilePath);
+
+				if (modelFile.GetSourceHash() == sourceHash)
+				{
+					std::cout << "Loaded model " << modelFilePath << " from " << cacheFilePath << std::endl;
+
+					return modelFile;
+				}
+			}
+			catch (const std::exception&)
+			{
+			}
+		}
+
+		auto modelFile = Import(modelFilePath);
+		modelFile.SetSourceHash(sourceHash);
 
+		try
+		{
+			modelFile.Save(cacheFilePath);
+		}
+		catch (const std::exception& exception)
+		{
+			std::cout << "Failed to save model cache " << cacheFilePath << ": " << exception.what() << std::endl;
+		}
+
+		return modelFile;
+	}
+
+	std::unique_ptr<Model> ModelLoader::CreateModel(
+		const ModelFile& modelFile, const std::string& modelDirectory, TextureCache& textureCache)
+	{
 		std::vector<Mesh> meshes;
-		meshes.reserve(scene->mNumMeshes);
+		meshes.reserve(modelFile.GetMeshes().size());
 
-		ProcessNode(scene->mRootNode, scene, meshes, modelDirectory, textureCache);
+		for (const auto& mesh : modelFile.GetMeshes())
+		{
+			std::vector<Texture> textures;
+			textures.reserve(mesh.texturePaths.size());
+
+			for (const auto& texturePath : mesh.texturePaths)
+				textures.push_back(textureCache.GetTexture(modelDirectory + "/" + texturePath));
+
+			meshes.emplace_back(mesh.vertices, mesh.indices, std::move(textures), mesh.bounds);
+		}
 
 		return std::make_unique<Model>(std::move(meshes));
 	}
 
 	void ModelLoader::ProcessNode(
-		const aiNode* node, const aiScene* scene, std::vector<Mesh>& meshes,
-		const std::string& modelDirectory, TextureCache& textureCache)
+		const aiNode* node, const aiScene* scene, ModelFile& modelFile)
 	{
 		for (unsigned i = 0; i < node->mNumMeshes; ++i)
 		{
 			const auto assimpMesh = scene->mMeshes[node->mMeshes[i]];
 
-			auto ourMesh = ProcessMesh(
-				assimpMesh, scene, modelDirectory, textureCache);
-
-			meshes.push_back(std::move(ourMesh));
+			ProcessMesh(assimpMesh, scene, modelFile);
 		}
 
 		for (unsigned i = 0; i < node->mNumChildren; ++i)
 		{
-			ProcessNode(
-				node->mChildren[i], scene, meshes,
-				modelDirectory, textureCache);
+			ProcessNode(node->mChildren[i], scene, modelFile);
 		}
 	}
 
-	Mesh ModelLoader::ProcessMesh(
-		aiMesh* mesh, const aiScene* scene, const std::string& modelDirectory,
-		TextureCache& textureCache)
+	void ModelLoader::ProcessMesh(
+		const aiMesh* mesh, const aiScene* scene, ModelFile& modelFile)
 	{
 		std::vector<Vertex> vertices;
 		vertices.reserve(mesh->mNumVertices);
 
 		std::vector<unsigned> indices;
-		std::vector<Texture> textures;
+		indices.reserve(static_cast<size_t>(mesh->mNumFaces) * 3);
 
 		for (unsigned i = 0; i < mesh->mNumVertices; ++i)
 		{
@@ -105,40 +178,33 @@ namespace Graphics
 				indices.push_back(face.mIndices[j]);
 		}
 
-		auto material = scene->mMaterials[mesh->mMaterialIndex];
+		const auto material = scene->mMaterials[mesh->mMaterialIndex];
 
-		auto diffuseMaps = LoadMaterialTextures(
-			material, aiTextureType_DIFFUSE, modelDirectory, textureCache);
+		auto texturePaths = GetMaterialTexturePaths(material, aiTextureType_DIFFUSE);
 
-		auto specularMaps = LoadMaterialTextures(
-			material, aiTextureType_SPECULAR, modelDirectory, textureCache);
+		const auto specularPaths = GetMaterialTexturePaths(material, aiTextureType_SPECULAR);
 
-		textures.insert(textures.end(), diffuseMaps.begin(), diffuseMaps.end());
-		textures.insert(textures.end(), specularMaps.begin(), specularMaps.end());
+		texturePaths.insert(texturePaths.end(), specularPaths.begin(), specularPaths.end());
 
-		return Mesh(vertices, indices, textures);
+		modelFile.AddMesh(std::move(vertices), std::move(indices), std::move(texturePaths));
 	}
 
-	std::vector<Texture> ModelLoader::LoadMaterialTextures(
-		const aiMaterial* mat, aiTextureType type,
-		const std::string& modelDirectory, TextureCache& textureCache)
+	std::vector<std::string> ModelLoader::GetMaterialTexturePaths(
+		const aiMaterial* mat, aiTextureType type)
 	{
 		const unsigned textureCount = mat->GetTextureCount(type);
 
-		std::vector<Texture> textures;
-		textures.reserve(textureCount);
+		std::vector<std::string> texturePaths;
+		texturePaths.reserve(textureCount);
 
 		for (unsigned i = 0; i < textureCount; ++i)
 		{
 			aiString texturePath;
 			mat->GetTexture(type, i, &texturePath);
 
-			auto texture = textureCache.GetTexture(
-				modelDirectory + "/" + texturePath.C_Str());
-
-			textures.push_back(texture);
+			texturePaths.emplace_back(texturePath.C_Str());
 		}
 
-		return textures;
+		return texturePaths;
 	}
 }
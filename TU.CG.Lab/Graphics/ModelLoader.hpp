@@ -9,26 +9,38 @@
 
 #include "Mesh.hpp"
 #include "Model.hpp"
+#include "ModelFile.hpp"
 #include "Texture.hpp"
 
 namespace Graphics
 {
+	class TextureCache;
+
 	class ModelLoader
 	{
 		private:
-			static void ProcessNode(
-				const aiNode* node, const aiScene* scene, std::vector<Mesh>& meshes,
-				const std::string& modelDirectory, TextureCache& textureCache);
+			static void ProcessNode(const aiNode* node, const aiScene* scene, ModelFile& modelFile);
 
-			static Mesh ProcessMesh(
-				aiMesh* mesh, const aiScene* scene,
-				const std::string& modelDirectory, TextureCache& textureCache);
+			static void ProcessMesh(const aiMesh* mesh, const aiScene* scene, ModelFile& modelFile);
 
-			static std::vector<Texture> LoadMaterialTextures(
-				const aiMaterial* mat, aiTextureType type,
-				const std::string& modelDirectory, TextureCache& textureCache);
+			static std::vector<std::string> GetMaterialTexturePaths(const aiMaterial* mat, aiTextureType type);
 		public:
+			// Reads the model with Assimp. Makes no GL calls.
+			static ModelFile Import(const std::string& modelFilePath);
+
+			// Returns the binary copy kept in cacheDirectory when it was made from the
+			// model file's current contents, importing and writing one otherwise.
+			// Edits to a material file alone are not noticed; clear the cache for those.
+			static ModelFile LoadOrImport(const std::string& modelFilePath, const std::string& cacheDirectory);
+
+			// Creates the GPU meshes, requesting their textures from textureCache. Texture
+			// paths are resolved against modelDirectory, the folder of the model file.
+			static std::unique_ptr<Model> CreateModel(
+				const ModelFile& modelFile, const std::string& modelDirectory, TextureCache& textureCache);
+
+			// An empty cacheDirectory imports with Assimp every time.
 			static std::unique_ptr<Model> Load(
-				const std::string& modelFilePath, TextureCache& textureCache);
+				const std::string& modelFilePath, TextureCache& textureCache,
+				const std::string& cacheDirectory = "");
 	};
 }
@@ -0,0 +1,203 @@
+#include "ShaderCache.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string_view>
+#include <vector>
+#include <glad/glad.h>
+
+#include "Utils/BinaryData.hpp"
+#include "Utils/Hash.hpp"
+#include "Utils/MappedFile.hpp"
+
+namespace Graphics
+{
+	namespace
+	{
+		std::string GetGlString(const GLenum name)
+		{
+			const auto value = reinterpret_cast<const char*>(glGetString(name));
+
+			return value != nullptr ? value : "";
+		}
+	}
+
+	std::shared_ptr<ShaderProgram> ShaderCache::GetProgram(
+		const std::string& vertexShaderPath, const std::string& fragmentShaderPath)
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		++stats.requestedPrograms;
+
+		const auto vertexShaderCode = ShaderProgram::ReadShaderFile(vertexShaderPath);
+		const auto fragmentShaderCode = ShaderProgram::ReadShaderFile(fragmentShaderPath);
+
+		// Separated, so text moving from one stage to the other still changes the key.
+		auto key = vertexShaderCode;
+		key += '\0';
+		key += fragmentShaderCode;
+		key += '\0';
+		key += driverName;
+
+		const auto keyHash = Utils::HashBytes(reinterpret_cast<const std::byte*>(key.data()), key.size());
+
+		auto& cachedProgram = programMap[vertexShaderPath + "|" + fragmentShaderPath];
+
+		if (cachedProgram.program != nullptr && cachedProgram.keyHash == keyHash)
+		{
+			++stats.sharedPrograms;
+
+			std::cout <<
+				"Used cached shader program with file paths = { " <<
+				vertexShaderPath << ", " << fragmentShaderPath <<
+				" }" <<
+				std::endl;
+
+			return cachedProgram.program;
+		}
+
+		std::shared_ptr<ShaderProgram> program;
+		std::string binaryFilePath;
+
+		if (!binaryDirectory.empty())
+		{
+			binaryFilePath = (std::filesystem::path(binaryDirectory) / (Utils::ToHexString(keyHash) + ".tprg")).string();
+
+			if (std::filesystem::exists(binaryFilePath))
+				program = LoadBinary(binaryFilePath, keyHash);
+		}
+
+		if (program == nullptr)
+		{
+			program = std::make_shared<ShaderProgram>(
+				ShaderProgram::FromSource(vertexShaderCode, fragmentShaderCode));
+
+			++stats.compiledPrograms;
+
+			if (!binaryFilePath.empty())
+				SaveBinary(binaryFilePath, keyHash, *program);
+		}
+
+		cachedProgram.keyHash = keyHash;
+		cachedProgram.program = program;
+
+		stats.loadMilliseconds +=
+			std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		return program;
+	}
+
+	void ShaderCache::SetBinaryDirectory(const std::string& directory)
+	{
+		if (!directory.empty() && !ShaderProgram::SupportsBinaries())
+		{
+			std::cout << "Program binaries are not supported; shaders are compiled on every launch." << std::endl;
+
+			binaryDirectory.clear();
+			driverName.clear();
+
+			return;
+		}
+
+		binaryDirectory = directory;
+		driverName = directory.empty() ? "" :
+			GetGlString(GL_VENDOR) + "\n" + GetGlString(GL_RENDERER) + "\n" + GetGlString(GL_VERSION);
+	}
+
+	void ShaderCache::Clear()
+	{
+		// Programs still held elsewhere stay alive until their last user lets go.
+		programMap.clear();
+	}
+
+	std::shared_ptr<ShaderProgram> ShaderCache::LoadBinary(
+		const std::string& filePath, const std::uint64_t keyHash)
+	{
+		const auto throwCorrupt = [&filePath](const std::string& reason)
+		{
+			const auto errorMessage = "Invalid program binary " + filePath + ": " + reason;
+			throw std::exception(errorMessage.c_str());
+		};
+
+		// Any binary that cannot be used is compiled from source again and overwritten.
+		try
+		{
+			const Utils::MappedFile file(filePath);
+			const auto data = file.GetData();
+			const auto size = file.GetSize();
+
+			if (size < ShaderBinaryFormat::HEADER_SIZE ||
+				std::memcmp(data, ShaderBinaryFormat::MAGIC, sizeof ShaderBinaryFormat::MAGIC) != 0)
+			{
+				throwCorrupt("not a program binary");
+			}
+
+			if (Utils::GetUint(data + 4, 4) != ShaderBinaryFormat::VERSION)
+				throwCorrupt("unsupported version");
+
+			if (Utils::GetUint(data + 8, 8) != keyHash)
+				throwCorrupt("made from other sources");
+
+			const auto binaryFormat = static_cast<unsigned>(Utils::GetUint(data + 16, 4));
+			const auto driverLength = static_cast<size_t>(Utils::GetUint(data + 20, 4));
+			const auto binarySize = static_cast<size_t>(Utils::GetUint(data + 24, 4));
+			const auto binaryOffset = ShaderBinaryFormat::HEADER_SIZE + ((driverLength + 3) & ~static_cast<size_t>(3));
+
+			if (binaryOffset > size || size - binaryOffset < binarySize)
+				throwCorrupt("binary is truncated");
+
+			if (std::string_view(reinterpret_cast<const char*>(data + ShaderBinaryFormat::HEADER_SIZE), driverLength) != driverName)
+				throwCorrupt("made by another driver");
+
+			auto program = std::make_shared<ShaderProgram>(
+				ShaderProgram::FromBinary(binaryFormat, data + binaryOffset, binarySize));
+
+			++stats.binaryCacheHits;
+
+			return program;
+		}
+		catch (const std::exception& exception)
+		{
+			++stats.rejectedBinaries;
+
+			std::cout << "Compiling shaders again: " << exception.what() << std::endl;
+		}
+
+		return nullptr;
+	}
+
+	void ShaderCache::SaveBinary(
+		const std::string& filePath, const std::uint64_t keyHash, const ShaderProgram& program) const
+	{
+		unsigned binaryFormat = 0;
+		const auto binary = program.GetBinary(binaryFormat);
+
+		if (binary.empty())
+			return;
+
+		std::vector<std::byte> bytes;
+
+		Utils::PutBytes(bytes, ShaderBinaryFormat::MAGIC, sizeof ShaderBinaryFormat::MAGIC);
+		Utils::PutUint(bytes, ShaderBinaryFormat::VERSION, 4);
+		Utils::PutUint(bytes, keyHash, 8);
+		Utils::PutUint(bytes, binaryFormat, 4);
+		Utils::PutUint(bytes, driverName.size(), 4);
+		Utils::PutUint(bytes, binary.size(), 4);
+		Utils::PutUint(bytes, 0, 4);
+
+		Utils::PutBytes(bytes, driverName.data(), driverName.size());
+		Utils::PadToFour(bytes);
+		Utils::PutBytes(bytes, binary.data(), binary.size());
+
+		try
+		{
+			Utils::WriteFileAtomically(filePath, bytes);
+		}
+		catch (const std::exception& exception)
+		{
+			std::cout << "Failed to save program binary " << filePath << ": " << exception.what() << std::endl;
+		}
+	}
+}
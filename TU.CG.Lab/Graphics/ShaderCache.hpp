@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "ShaderProgram.hpp"
+
+namespace Graphics
+{
+	// Layout of a cached program binary (.tprg), all integers little-endian:
+	//
+	//   header   magic "TUSP", u32 version, u64 key hash, u32 binary format,
+	//            u32 driver string length, u32 binary size, u32 reserved
+	//   driver   vendor, renderer and version strings the binary was made by,
+	//            padded to 4 bytes
+	//   binary   the blob glGetProgramBinary returned
+	//
+	// The key hash covers both sources and the driver string, so an edited
+	// shader or a driver update simply looks for a different file.
+	namespace ShaderBinaryFormat
+	{
+		constexpr char MAGIC[4] = { 'T', 'U', 'S', 'P' };
+		constexpr std::uint32_t VERSION = 1;
+		constexpr size_t HEADER_SIZE = 32;
+	}
+
+	class ShaderCache
+	{
+		public:
+			struct Stats
+			{
+				size_t requestedPrograms = 0;
+				// Handed out again because the sources had not changed.
+				size_t sharedPrograms = 0;
+				// Recreated from a binary on disk, with no GLSL compiled.
+				size_t binaryCacheHits = 0;
+				// Binaries found damaged or refused by the driver, compiled again from source.
+				size_t rejectedBinaries = 0;
+				size_t compiledPrograms = 0;
+				double loadMilliseconds = 0.0;
+			};
+		private:
+			struct CachedProgram
+			{
+				std::uint64_t keyHash = 0;
+				std::shared_ptr<ShaderProgram> program;
+			};
+
+			std::unordered_map<std::string, CachedProgram> programMap;
+
+			// Empty to compile from source on every launch.
+			std::string binaryDirectory;
+			std::string driverName;
+
+			Stats stats;
+
+			std::shared_ptr<ShaderProgram> LoadBinary(const std::string& filePath, std::uint64_t keyHash);
+			void SaveBinary(const std::string& filePath, std::uint64_t keyHash, const ShaderProgram& program) const;
+		public:
+			// Programs are keyed by both paths and checked against the current sources,
+			// so a shader edited on disk is rebuilt on its next request.
+			std::shared_ptr<ShaderProgram> GetProgram(
+				const std::string& vertexShaderPath, const std::string& fragmentShaderPath);
+
+			// Keeps linked program binaries in directory and tries them before compiling.
+			// Must be called on the GL thread; an empty directory turns the binaries off.
+			void SetBinaryDirectory(const std::string& directory);
+
+			[[nodiscard]] const Stats& GetStats() const { return stats; }
+
+			void Clear();
+	};
+}
@@ -3,15 +3,96 @@
 #include <fstream>
 #include <sstream>
 #include <glad/glad.h>
+#include <GLFW/glfw3.h>
 #include <glm/gtc/type_ptr.hpp>
 
+// Program binaries are core only from GL 4.1; glad was generated for 3.3 core,
+// so the values and entry points of ARB_get_program_binary are supplied here.
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
 namespace Graphics
 {
+	namespace
+	{
+		struct ProgramBinaryFunctions
+		{
+			void (APIENTRYP getProgramBinary)(GLuint, GLsizei, GLsizei*, GLenum*, void*) = nullptr;
+			void (APIENTRYP programBinary)(GLuint, GLenum, const void*, GLsizei) = nullptr;
+			void (APIENTRYP programParameteri)(GLuint, GLenum, GLint) = nullptr;
+
+			[[nodiscard]] bool IsLoaded() const
+			{
+				return getProgramBinary != nullptr && programBinary != nullptr && programParameteri != nullptr;
+			}
+		};
+
+		bool HasExtension(const std::string& name)
+		{
+			GLint extensionCount = 0;
+			glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+
+			for (GLint i = 0; i < extensionCount; ++i)
+			{
+				const auto extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+
+				if (extension != nullptr && name == extension)
+					return true;
+			}
+
+			return false;
+		}
+
+		// Resolved on first use, which is always on the GL thread with the context current.
+		const ProgramBinaryFunctions& GetProgramBinaryFunctions()
+		{
+			static const auto functions = []
+			{
+				ProgramBinaryFunctions loaded;
+
+				if (!HasExtension("GL_ARB_get_program_binary"))
+					return loaded;
+
+				// Drivers may expose the extension yet offer no format to store programs in.
+				GLint formatCount = 0;
+				glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+
+				if (formatCount <= 0)
+					return loaded;
+
+				loaded.getProgramBinary = reinterpret_cast<decltype(loaded.getProgramBinary)>(
+					glfwGetProcAddress("glGetProgramBinary"));
+				loaded.programBinary = reinterpret_cast<decltype(loaded.programBinary)>(
+					glfwGetProcAddress("glProgramBinary"));
+				loaded.programParameteri = reinterpret_cast<decltype(loaded.programParameteri)>(
+					glfwGetProcAddress("glProgramParameteri"));
+
+				return loaded;
+			}();
+
+			return functions;
+		}
+	}
+
 	ShaderProgram::ShaderProgram(
 		const std::string& vertexShaderPath, const std::string& fragmentShaderPath)
+		: ShaderProgram(FromSource(ReadShaderFile(vertexShaderPath), ReadShaderFile(fragmentShaderPath)))
 	{
-		const auto vertexShaderCode = ReadShaderFile(vertexShaderPath);
-		const auto fragmentShaderCode = ReadShaderFile(fragmentShaderPath);
+	}
+
+	ShaderProgram ShaderProgram::FromSource(
+		const std::string& vertexShaderCode, const std::string& fragmentShaderCode)
+	{
+		ShaderProgram program;
 
 		const auto vertexShaderId = glCreateShader(GL_VERTEX_SHADER);
 		const auto fragmentShaderId = glCreateShader(GL_FRAGMENT_SHADER);
@@ -32,25 +113,59 @@ namespace Graphics
 			throw std::exception(errorMessage.c_str());
 		}
 
-		if (!LinkProgram(vertexShaderId, fragmentShaderId, errorMessage))
+		if (!program.LinkProgram(vertexShaderId, fragmentShaderId, errorMessage))
 		{
-			glDetachShader(id, vertexShaderId);
-			glDetachShader(id, fragmentShaderId);
+			glDetachShader(program.id, vertexShaderId);
+			glDetachShader(program.id, fragmentShaderId);
 
 			DeleteShaders(vertexShaderId, fragmentShaderId);
-			Delete();
 
 			throw std::exception(errorMessage.c_str());
 		}
 
-		glDetachShader(id, vertexShaderId);
-		glDetachShader(id, fragmentShaderId);
+		glDetachShader(program.id, vertexShaderId);
+		glDetachShader(program.id, fragmentShaderId);
 
 		DeleteShaders(vertexShaderId, fragmentShaderId);
+
+		program.CacheUniformLocations();
+
+		return program;
+	}
+
+	ShaderProgram ShaderProgram::FromBinary(
+		const unsigned binaryFormat, const std::byte* binary, const size_t binarySize)
+	{
+		const auto& functions = GetProgramBinaryFunctions();
+
+		if (!functions.IsLoaded())
+			throw std::exception("Program binaries are not supported by this driver.");
+
+		ShaderProgram program;
+		program.id = glCreateProgram();
+
+		functions.programParameteri(program.id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		functions.programBinary(program.id, binaryFormat, binary, static_cast<GLsizei>(binarySize));
+
+		int status;
+		glGetProgramiv(program.id, GL_LINK_STATUS, &status);
+
+		if (status != GL_TRUE)
+			throw std::exception("The driver rejected the program binary.");
+
+		program.CacheUniformLocations();
+
+		return program;
+	}
+
+	bool ShaderProgram::SupportsBinaries()
+	{
+		return GetProgramBinaryFunctions().IsLoaded();
 	}
 
 	ShaderProgram::ShaderProgram(ShaderProgram&& other) noexcept
-		: id(other.id)
+		: id(other.id), uniformLocations(std::move(other.uniformLocations)),
+		ignoreMissingUniforms(other.ignoreMissingUniforms)
 	{
 		other.id = 0;
 	}
@@ -62,6 +177,8 @@ namespace Graphics
 			Delete();
 
 			id = other.id;
+			uniformLocations = std::move(other.uniformLocations);
+			ignoreMissingUniforms = other.ignoreMissingUniforms;
 
 			other.id = 0;
 		}
@@ -74,6 +191,31 @@ namespace Graphics
 		Delete();
 	}
 
+	std::vector<std::byte> ShaderProgram::GetBinary(unsigned& binaryFormat) const
+	{
+		const auto& functions = GetProgramBinaryFunctions();
+
+		if (!functions.IsLoaded())
+			return {};
+
+		GLint binaryLength = 0;
+		glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+
+		std::vector<std::byte> binary(static_cast<size_t>(binaryLength));
+
+		if (binary.empty())
+			return binary;
+
+		GLsizei writtenLength = 0;
+		GLenum format = 0;
+		functions.getProgramBinary(id, binaryLength, &writtenLength, &format, binary.data());
+
+		binary.resize(static_cast<size_t>(writtenLength));
+		binaryFormat = format;
+
+		return binary;
+	}
+
 	void ShaderProgram::Use() const
 	{
 		glUseProgram(id);
@@ -84,55 +226,106 @@ namespace Graphics
 		glUseProgram(0);
 	}
 
-	void ShaderProgram::SetBool(
-		const std::string& name, const bool value) const
+	void ShaderProgram::BindUniformBlock(
+		const std::string& blockName, const unsigned bindingPoint) const
+	{
+		const auto blockIndex = glGetUniformBlockIndex(id, blockName.c_str());
+
+		if (blockIndex == GL_INVALID_INDEX)
+		{
+			if (ignoreMissingUniforms)
+				return;
+
+			const auto errorMessage = "Uniform block '" + blockName + "' could not be found.";
+			throw std::exception(errorMessage.c_str());
+		}
+
+		glUniformBlockBinding(id, blockIndex, bindingPoint);
+	}
+
+	UniformHandle ShaderProgram::GetUniformHandle(const std::string_view name) const
+	{
+		return UniformHandle{ GetUniformLocation(name) };
+	}
+
+	void ShaderProgram::SetBool(const std::string_view name, const bool value) const
+	{
+		SetBool(GetUniformHandle(name), value);
+	}
+
+	void ShaderProgram::SetInt(const std::string_view name, const int value) const
+	{
+		SetInt(GetUniformHandle(name), value);
+	}
+
+	void ShaderProgram::SetFloat(const std::string_view name, const float value) const
+	{
+		SetFloat(GetUniformHandle(name), value);
+	}
+
+	void ShaderProgram::SetVec2f(const std::string_view name, const glm::vec2& value) const
+	{
+		SetVec2f(GetUniformHandle(name), value);
+	}
+
+	void ShaderProgram::SetVec3f(const std::string_view name, const glm::vec3& value) const
+	{
+		SetVec3f(GetUniformHandle(name), value);
+	}
+
+	void ShaderProgram::SetVec4f(const std::string_view name, const glm::vec4& value) const
+	{
+		SetVec4f(GetUniformHandle(name), value);
+	}
+
+	void ShaderProgram::SetMat3f(const std::string_view name, const glm::mat3& value) const
+	{
+		SetMat3f(GetUniformHandle(name), value);
+	}
+
+	void ShaderProgram::SetMat4f(const std::string_view name, const glm::mat4& value) const
+	{
+		SetMat4f(GetUniformHandle(name), value);
+	}
+
+	void ShaderProgram::SetBool(const UniformHandle handle, const bool value)
 	{
-		const auto uniformLocation = GetUniformLocation(name);
-		glUniform1i(uniformLocation, value);
+		glUniform1i(handle.location, value);
 	}
 
-	void ShaderProgram::SetInt(
-		const std::string& name, const int value) const
+	void ShaderProgram::SetInt(const UniformHandle handle, const int value)
 	{
-		const auto uniformLocation = GetUniformLocation(name);
-		glUniform1i(uniformLocation, value);
+		glUniform1i(handle.location, value);
 	}
 
-	void ShaderProgram::SetFloat(
-		const std::string& name, const float value) const
+	void ShaderProgram::SetFloat(const UniformHandle handle, const float value)
 	{
-		const auto uniformLocation = GetUniformLocation(name);
-		glUniform1f(uniformLocation, value);
+		glUniform1f(handle.location, value);
 	}
 
-	void ShaderProgram::SetVec2f(const std::string& name, const glm::vec2& value) const
+	void ShaderProgram::SetVec2f(const UniformHandle handle, const glm::vec2& value)
 	{
-		const auto uniformLocation = GetUniformLocation(name);
-		glUniform2f(uniformLocation, value.x, value.y);
+		glUniform2f(handle.location, value.x, value.y);
 	}
 
-	void ShaderProgram::SetVec3f(const std::string& name, const glm::vec3& value) const
+	void ShaderProgram::SetVec3f(const UniformHandle handle, const glm::vec3& value)
 	{
-		const auto uniformLocation = GetUniformLocation(name);
-		glUniform3f(uniformLocation, value.x, value.y, value.z);
+		glUniform3f(handle.location, value.x, value.y, value.z);
 	}
 
-	void ShaderProgram::SetVec4f(const std::string& name, const glm::vec4& value) const
+	void ShaderProgram::SetVec4f(const UniformHandle handle, const glm::vec4& value)
 	{
-		const auto uniformLocation = GetUniformLocation(name);
-		glUniform4f(uniformLocation, value.x, value.y, value.z, value.w);
+		glUniform4f(handle.location, value.x, value.y, value.z, value.w);
 	}
 
-	void ShaderProgram::SetMat3f(const std::string& name, const glm::mat3& value) const
+	void ShaderProgram::SetMat3f(const UniformHandle handle, const glm::mat3& value)
 	{
-		const auto uniformLocation = GetUniformLocation(name);
-		glUniformMatrix3fv(uniformLocation, 1, GL_FALSE, glm::value_ptr(value));
+		glUniformMatrix3fv(handle.location, 1, GL_FALSE, glm::value_ptr(value));
 	}
 
-	void ShaderProgram::SetMat4f(const std::string& name, const glm::mat4& value) const
+	void ShaderProgram::SetMat4f(const UniformHandle handle, const glm::mat4& value)
 	{
-		const auto uniformLocation = GetUniformLocation(name);
-		glUniformMatrix4fv(uniformLocation, 1, GL_FALSE, glm::value_ptr(value));
+		glUniformMatrix4fv(handle.location, 1, GL_FALSE, glm::value_ptr(value));
 	}
 
 	void ShaderProgram::DeleteShaders(
@@ -191,6 +384,11 @@ namespace Graphics
 
 		glAttachShader(id, vertexShaderId);
 		glAttachShader(id, fragmentShaderId);
+
+		// Without the hint some drivers hand back no binary for the program.
+		if (const auto& functions = GetProgramBinaryFunctions(); functions.IsLoaded())
+			functions.programParameteri(id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
 		glLinkProgram(id);
 
 		int status;
@@ -210,18 +408,68 @@ namespace Graphics
 		return true;
 	}
 
-	int ShaderProgram::GetUniformLocation(
-		const std::string& name) const
+	void ShaderProgram::CacheUniformLocations()
 	{
-		const auto uniformLocation = glGetUniformLocation(id, name.c_str());
+		uniformLocations.clear();
+
+		int uniformCount = 0;
+		int maxNameLength = 0;
 
-		if (uniformLocation == -1)
+		glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+		glGetProgramiv(id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+		std::string nameBuffer(maxNameLength, '\0');
+
+		for (int i = 0; i < uniformCount; ++i)
 		{
-			const std::string errorMessage = "Uniform '" + name + "' could not be found.";
-			throw std::exception(errorMessage.c_str());
+			int nameLength = 0;
+			int arraySize = 0;
+			unsigned type = 0;
+
+			glGetActiveUniform(
+				id, i, maxNameLength, &nameLength, &arraySize, &type, nameBuffer.data());
+
+			const std::string name(nameBuffer.data(), nameLength);
+			const auto location = glGetUniformLocation(id, name.c_str());
+
+			// Members of uniform blocks have no location of their own.
+			if (location == -1)
+				continue;
+
+			uniformLocations.emplace(name, location);
+
+			// Arrays are reported once as "name[0]"; register the bare name and
+			// every element too.
+			if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+			{
+				const auto baseName = name.substr(0, name.size() - 3);
+
+				uniformLocations.emplace(baseName, location);
+
+				for (int element = 1; element < arraySize; ++element)
+				{
+					const auto elementName = baseName + "[" + std::to_string(element) + "]";
+
+					uniformLocations.emplace(
+						elementName, glGetUniformLocation(id, elementName.c_str()));
+				}
+			}
 		}
+	}
+
+	int ShaderProgram::GetUniformLocation(
+		const std::string_view name) const
+	{
+		const auto umit = uniformLocations.find(name);
+
+		if (umit != uniformLocations.end())
+			return umit->second;
+
+		if (ignoreMissingUniforms)
+			return -1;
 
-		return uniformLocation;
+		const auto errorMessage = "Uniform '" + std::string(name) + "' could not be found.";
+		throw std::exception(errorMessage.c_str());
 	}
 
 	void ShaderProgram::Delete() const
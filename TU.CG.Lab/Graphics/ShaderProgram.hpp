@@ -1,18 +1,41 @@
 #pragma once
 
+#include <cstddef>
 #include <glm/glm.hpp>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace Graphics
 {
+	struct UniformHandle
+	{
+		int location = -1;
+
+		[[nodiscard]] bool IsValid() const { return location != -1; }
+	};
+
 	class ShaderProgram
 	{
 		private:
+			struct UniformNameHash
+			{
+				using is_transparent = void;
+
+				size_t operator()(const std::string_view name) const
+				{
+					return std::hash<std::string_view>()(name);
+				}
+			};
+
 			unsigned id = 0;
+			std::unordered_map<std::string, int, UniformNameHash, std::equal_to<>> uniformLocations;
+			bool ignoreMissingUniforms = false;
 
-			static void DeleteShaders(unsigned vertexShaderId, unsigned fragmentShaderId);
+			ShaderProgram() = default;
 
-			static std::string ReadShaderFile(const std::string& shaderPath);
+			static void DeleteShaders(unsigned vertexShaderId, unsigned fragmentShaderId);
 
 			static bool CompileShader(
 				unsigned shaderId, const std::string& code, std::string& errorMessage);
@@ -20,7 +43,9 @@ namespace Graphics
 			bool LinkProgram(
 				unsigned vertexShaderId, unsigned fragmentShaderId, std::string& errorMessage);
 
-			[[nodiscard]] int GetUniformLocation(const std::string& name) const;
+			void CacheUniformLocations();
+
+			[[nodiscard]] int GetUniformLocation(std::string_view name) const;
 
 			void Delete() const;
 		public:
@@ -28,6 +53,20 @@ namespace Graphics
 				const std::string& vertexShaderPath,
 				const std::string& fragmentShaderPath);
 
+			// Compiles and links GLSL source held in memory.
+			static ShaderProgram FromSource(
+				const std::string& vertexShaderCode,
+				const std::string& fragmentShaderCode);
+			// Recreates a program from GetBinary output. Throws when the driver
+			// rejects the blob, which it may do after any driver update.
+			static ShaderProgram FromBinary(
+				unsigned binaryFormat, const std::byte* binary, size_t binarySize);
+
+			static std::string ReadShaderFile(const std::string& shaderPath);
+
+			// True when the driver can hand out and take back linked programs.
+			[[nodiscard]] static bool SupportsBinaries();
+
 			ShaderProgram(const ShaderProgram& other) = delete;
 			ShaderProgram& operator=(const ShaderProgram& other) = delete;
 
@@ -36,16 +75,40 @@ namespace Graphics
 
 			~ShaderProgram();
 
+			// Returns an empty blob when SupportsBinaries is false.
+			[[nodiscard]] std::vector<std::byte> GetBinary(unsigned& binaryFormat) const;
+
 			void Use() const;
 			void Unuse();
 
-			void SetBool(const std::string& name, bool value) const;
-			void SetInt(const std::string& name, int value) const;
-			void SetFloat(const std::string& name, float value) const;
-			void SetVec2f(const std::string& name, const glm::vec2& value) const;
-			void SetVec3f(const std::string& name, const glm::vec3& value) const;
-			void SetVec4f(const std::string& name, const glm::vec4& value) const;
-			void SetMat3f(const std::string& name, const glm::mat3& value) const;
-			void SetMat4f(const std::string& name, const glm::mat4& value) const;
+			// Points the named uniform block at a UniformBuffer binding point.
+			void BindUniformBlock(const std::string& blockName, unsigned bindingPoint) const;
+
+			// Resolved from the cache filled after linking; no GL query per call.
+			[[nodiscard]] UniformHandle GetUniformHandle(std::string_view name) const;
+
+			void SetBool(std::string_view name, bool value) const;
+			void SetInt(std::string_view name, int value) const;
+			void SetFloat(std::string_view name, float value) const;
+			void SetVec2f(std::string_view name, const glm::vec2& value) const;
+			void SetVec3f(std::string_view name, const glm::vec3& value) const;
+			void SetVec4f(std::string_view name, const glm::vec4& value) const;
+			void SetMat3f(std::string_view name, const glm::mat3& value) const;
+			void SetMat4f(std::string_view name, const glm::mat4& value) const;
+
+			static void SetBool(UniformHandle handle, bool value);
+			static void SetInt(UniformHandle handle, int value);
+			static void SetFloat(UniformHandle handle, float value);
+			static void SetVec2f(UniformHandle handle, const glm::vec2& value);
+			static void SetVec3f(UniformHandle handle, const glm::vec3& value);
+			static void SetVec4f(UniformHandle handle, const glm::vec4& value);
+			static void SetMat3f(UniformHandle handle, const glm::mat3& value);
+			static void SetMat4f(UniformHandle handle, const glm::mat4& value);
+
+			// When set, unknown uniform names resolve to an invalid handle, which
+			// GL ignores, instead of throwing.
+			void SetIgnoreMissingUniforms(const bool value) { ignoreMissingUniforms = value; }
+
+			[[nodiscard]] bool GetIgnoreMissingUniforms() const { return ignoreMissingUniforms; }
 	};
 }
@@ -0,0 +1,18 @@
+#include "TextureArray.hpp"
+
+#include <glad/glad.h>
+
+namespace Graphics
+{
+	TextureArray::TextureArray(
+		const unsigned id, const int width, const int height, const int layerCount, std::string name)
+			: id(id), width(width), height(height), layerCount(layerCount), name(std::move(name))
+	{
+	}
+
+	void TextureArray::BindAndActivate(const unsigned textureSlot) const
+	{
+		glActiveTexture(GL_TEXTURE0 + textureSlot);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+	}
+}
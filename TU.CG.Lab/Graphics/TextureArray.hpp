@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+namespace Graphics
+{
+	// A GL_TEXTURE_2D_ARRAY of equally sized images, sampled by layer index.
+	class TextureArray
+	{
+		private:
+			unsigned id;
+			int width;
+			int height;
+			int layerCount;
+
+			std::string name;
+
+			friend class TextureCache;
+		public:
+			TextureArray(unsigned id, int width, int height, int layerCount, std::string name);
+
+			void BindAndActivate(unsigned textureSlot = 0) const;
+
+			[[nodiscard]] int GetWidth() const { return width; }
+			[[nodiscard]] int GetHeight() const { return height; }
+			[[nodiscard]] int GetLayerCount() const { return layerCount; }
+			[[nodiscard]] std::string GetName() const { return name; }
+	};
+}
@@ -1,20 +1,60 @@
 #include "TextureCache.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <filesystem>
 #include <iostream>
+#include <limits>
 #include <glad/glad.h>
 #include <stb/stb_image.h>
 
+#include "Utils/Profiler.hpp"
+
+// Not part of the core profile glad was generated for; values from the S3TC extension.
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
 namespace Graphics
 {
+	namespace
+	{
+		double GetMillisecondsSince(const std::chrono::steady_clock::time_point start)
+		{
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+	}
+
+	void TextureCache::ImageDeleter::operator()(unsigned char* data) const
+	{
+		stbi_image_free(data);
+	}
+
 	TextureCache::TextureCache()
+		: decodedTextures(std::make_unique<Utils::CompletionQueue<DecodedTexture>>()), uploadTimes(600)
 	{
+		// Global in stb_image, so decodes on the workers see it as well.
 		stbi_set_flip_vertically_on_load(true);
 	}
 
 	TextureCache::TextureCache(TextureCache&& other) noexcept
+		: TextureCache()
 	{
 		textureMap.merge(other.textureMap);
+		textureArrayMap.merge(other.textureArrayMap);
+
+		jobSystem = other.jobSystem;
+		bakeDirectory = other.bakeDirectory;
+		compressBakedTextures = other.compressBakedTextures;
+		std::swap(decodedTextures, other.decodedTextures);
+		std::swap(pendingTextureCount, other.pendingTextureCount);
+		streamingStats = other.streamingStats;
+		batchStart = other.batchStart;
+		std::swap(uploadTimes, other.uploadTimes);
 	}
 
 	TextureCache& TextureCache::operator=(TextureCache&& other) noexcept
@@ -24,6 +64,16 @@ namespace Graphics
 			Clear();
 
 			textureMap.merge(other.textureMap);
+			textureArrayMap.merge(other.textureArrayMap);
+
+			jobSystem = other.jobSystem;
+			bakeDirectory = other.bakeDirectory;
+			compressBakedTextures = other.compressBakedTextures;
+			std::swap(decodedTextures, other.decodedTextures);
+			std::swap(pendingTextureCount, other.pendingTextureCount);
+			streamingStats = other.streamingStats;
+			batchStart = other.batchStart;
+			std::swap(uploadTimes, other.uploadTimes);
 		}
 
 		return *this;
@@ -40,12 +90,13 @@ namespace Graphics
 
 		if (umit == textureMap.end())
 		{
-			auto newTexture = LoadTextureFromFile(filePath);
+			auto newTexture = jobSystem != nullptr ?
+				RequestTexture(filePath) : LoadTextureFromFile(filePath, bakeDirectory, compressBakedTextures);
 
 			textureMap.emplace(filePath, newTexture);
 
 			std::cout <<
-				"Loaded texture with file path = { " <<
+				(jobSystem != nullptr ? "Queued texture with file path = { " : "Loaded texture with file path = { ") <<
 				filePath <<
 				" }" <<
 				std::endl;
@@ -91,62 +142,423 @@ namespace Graphics
 		texture.fileNameWithoutExtension = "";
 	}
 
+	TextureArray TextureCache::GetTextureArray(
+		const std::string& name, const std::vector<std::string>& filePaths)
+	{
+		const auto umit = textureArrayMap.find(name);
+
+		if (umit != textureArrayMap.end())
+			return umit->second;
+
+		auto newTextureArray = LoadTextureArrayFromFiles(name, filePaths);
+
+		textureArrayMap.emplace(name, newTextureArray);
+
+		std::cout <<
+			"Loaded texture array with name = { " <<
+			name <<
+			" } and " <<
+			filePaths.size() <<
+			" layers" <<
+			std::endl;
+
+		return newTextureArray;
+	}
+
+	void TextureCache::UploadPendingTextures(const double budgetMilliseconds)
+	{
+		PROFILE_ZONE("TextureCache::UploadPendingTextures");
+
+		const auto start = std::chrono::steady_clock::now();
+
+		DecodedTexture decoded;
+		size_t uploadCount = 0;
+
+		while (GetMillisecondsSince(start) < budgetMilliseconds && decodedTextures->TryPop(decoded))
+		{
+			--pendingTextureCount;
+
+			// Deleted while it was decoding; its id may already name another texture.
+			const auto umit = textureMap.find(decoded.filePath);
+
+			if (umit == textureMap.end() || umit->second.id != decoded.id)
+				continue;
+
+			if (!decoded.data && !decoded.baked)
+			{
+				const auto errorMessage = "Failed to load texture: " + decoded.filePath +
+					(decoded.error.empty() ? "" : " (" + decoded.error + ")");
+
+				throw std::exception(errorMessage.c_str());
+			}
+
+			const auto uploadStart = std::chrono::steady_clock::now();
+
+			streamingStats.uploadedBytes += UploadTexture(decoded);
+
+			if (decoded.baked && decoded.baked->IsFromCache())
+				++streamingStats.bakedCacheHits;
+			else if (decoded.baked)
+				++streamingStats.bakedCacheMisses;
+
+			streamingStats.maxUploadMilliseconds = std::max(
+				streamingStats.maxUploadMilliseconds, GetMillisecondsSince(uploadStart));
+			streamingStats.decodeMilliseconds += decoded.decodeMilliseconds;
+			++streamingStats.residentTextures;
+			++uploadCount;
+		}
+
+		if (uploadCount == 0)
+			return;
+
+		uploadTimes.Add(GetMillisecondsSince(start));
+
+		if (pendingTextureCount == 0)
+		{
+			streamingStats.lastBatchMilliseconds = GetMillisecondsSince(batchStart);
+
+			std::cout << "All " << streamingStats.residentTextures << " streamed textures resident after " <<
+				streamingStats.lastBatchMilliseconds << " ms" << std::endl;
+		}
+	}
+
+	void TextureCache::FinishPendingTextures()
+	{
+		if (pendingTextureCount == 0)
+			return;
+
+		jobSystem->WaitIdle();
+		UploadPendingTextures(std::numeric_limits<double>::infinity());
+	}
+
 	void TextureCache::Clear()
 	{
-		if (!textureMap.empty())
+		// Workers still decoding would push into the queue after it was drained.
+		if (pendingTextureCount > 0)
+		{
+			jobSystem->WaitIdle();
+
+			DecodedTexture decoded;
+
+			while (decodedTextures->TryPop(decoded))
+			{
+			}
+
+			pendingTextureCount = 0;
+		}
+
+		if (!textureMap.empty() || !textureArrayMap.empty())
 			std::cout << "Cleared a Texture Cache." << std::endl;
 
 		for (const auto& umit : textureMap)
 			glDeleteTextures(1, &umit.second.id);
 
+		for (const auto& umit : textureArrayMap)
+			glDeleteTextures(1, &umit.second.id);
+
 		textureMap.clear();
+		textureArrayMap.clear();
 	}
 
-	Texture TextureCache::LoadTextureFromFile(const std::string& filePath)
+	void TextureCache::SetBakeDirectory(const std::string& directory)
+	{
+		bakeDirectory = directory;
+		// BC4 is core, but BC1 and BC3 still come from the S3TC extension.
+		compressBakedTextures = !directory.empty() && SupportsS3tc();
+	}
+
+	size_t TextureCache::BakeAll(const std::string& contentDirectory, const std::string& directory)
+	{
+		// Baked the way they are loaded, compressed as on any driver with S3TC.
+		stbi_set_flip_vertically_on_load(true);
+
+		size_t bakedCount = 0;
+
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(contentDirectory))
+		{
+			auto extension = entry.path().extension().string();
+			std::transform(extension.begin(), extension.end(), extension.begin(), [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+			if (!entry.is_regular_file() || (extension != ".png" && extension != ".jpg" && extension != ".jpeg"))
+				continue;
+
+			const auto baked = BakedTexture::LoadOrBake(entry.path().string(), directory, true);
+
+			std::cout << (baked.IsFromCache() ? "Up to date: " : "Baked: ") << entry.path().string() <<
+				" (" << baked.GetLevels().size() << " levels, " << baked.GetDataSize() << " bytes)" << std::endl;
+
+			++bakedCount;
+		}
+
+		return bakedCount;
+	}
+
+	Texture TextureCache::LoadTextureFromFile(
+		const std::string& filePath, const std::string& bakeDirectory, const bool compress)
+	{
+		PROFILE_ZONE("TextureCache::LoadTextureFromFile");
+
+		auto decoded = DecodeTexture(0, filePath, bakeDirectory, compress);
+
+		if (!decoded.data && !decoded.baked)
+		{
+			const auto errorMessage = "Failed to load texture: " + filePath +
+				(decoded.error.empty() ? "" : " (" + decoded.error + ")");
+
+			throw std::exception(errorMessage.c_str());
+		}
+
+		decoded.id = CreateTexture();
+		UploadTexture(decoded);
+
+		return Texture(
+			decoded.id, decoded.width, decoded.height, filePath,
+			std::filesystem::path(filePath).stem().string());
+	}
+
+	Texture TextureCache::RequestTexture(const std::string& filePath)
 	{
-		unsigned textureId;
 		int width, height, channels;
 
-		unsigned char* data = stbi_load(
-			filePath.c_str(), &width, &height, &channels, 0);
+		// Only the header is read here, so the handle carries the real size from the start.
+		if (!stbi_info(filePath.c_str(), &width, &height, &channels))
+		{
+			const auto errorMessage = "Failed to load texture: " + filePath;
+			throw std::exception(errorMessage.c_str());
+		}
+
+		const auto textureId = CreateTexture();
+
+		if (pendingTextureCount == 0)
+			batchStart = std::chrono::steady_clock::now();
+
+		++pendingTextureCount;
+		++streamingStats.requestedTextures;
+
+		jobSystem->Submit(
+			[queue = decodedTextures.get(), textureId, filePath, bakeDirectory = bakeDirectory, compress = compressBakedTextures]
+			{
+				PROFILE_ZONE("TextureCache::DecodeTexture");
+
+				queue->Push(DecodeTexture(textureId, filePath, bakeDirectory, compress));
+			});
+
+		return Texture(
+			textureId, width, height, filePath,
+			std::filesystem::path(filePath).stem().string());
+	}
+
+	unsigned TextureCache::CreateTexture()
+	{
+		// Mid grey until the decoded image is uploaded over it.
+		constexpr unsigned char placeholder[] = { 128, 128, 128, 255 };
+
+		unsigned textureId;
+
+		glGenTextures(1, &textureId);
+		glBindTexture(GL_TEXTURE_2D, textureId);
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+		glTexImage2D(
+			GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, placeholder);
 
-		const std::string fileNameWithoutExtension =
-			std::filesystem::path(filePath).stem().string();
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		return textureId;
+	}
 
-		if (data)
+	TextureCache::DecodedTexture TextureCache::DecodeTexture(
+		const unsigned id, const std::string& filePath, const std::string& bakeDirectory, const bool compress)
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		DecodedTexture decoded;
+		decoded.id = id;
+		decoded.filePath = filePath;
+
+		// Failures are left for the GL thread to report, since workers cannot throw to anyone.
+		if (!bakeDirectory.empty())
 		{
-			glGenTextures(1, &textureId);
-			glBindTexture(GL_TEXTURE_2D, textureId);
+			try
+			{
+				decoded.baked = BakedTexture::LoadOrBake(filePath, bakeDirectory, compress);
+				decoded.width = decoded.baked->GetWidth();
+				decoded.height = decoded.baked->GetHeight();
+			}
+			catch (const std::exception& exception)
+			{
+				decoded.error = exception.what();
+			}
+		}
+		else
+		{
+			decoded.data.reset(stbi_load(
+				filePath.c_str(), &decoded.width, &decoded.height, &decoded.channels, 0));
+		}
 
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		decoded.decodeMilliseconds = GetMillisecondsSince(start);
+
+		return decoded;
+	}
 
+	size_t TextureCache::UploadTexture(const DecodedTexture& decoded)
+	{
+		// Same id as the placeholder, so every copy of the Texture handle sees the new image.
+		glBindTexture(GL_TEXTURE_2D, decoded.id);
+
+		size_t uploadedBytes = 0;
+
+		if (decoded.baked)
+		{
+			constexpr GLenum compressedFormats[] =
+			{
+				GL_COMPRESSED_RGB_S3TC_DXT1_EXT, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, GL_COMPRESSED_RED_RGTC1,
+			};
+
+			constexpr GLenum formats[] = { GL_RED, GL_RGB, GL_RGBA };
+			constexpr GLint internalFormats[] = { GL_R8, GL_RGB8, GL_RGBA8 };
+
+			const auto format = decoded.baked->GetFormat();
+			const auto& levels = decoded.baked->GetLevels();
+			const auto formatIndex = static_cast<size_t>(format);
+
+			// Baked rows are tightly packed.
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+			for (size_t level = 0; level < levels.size(); ++level)
+			{
+				const auto& bakedLevel = levels[level];
+
+				if (BakedTexture::IsCompressed(format))
+				{
+					glCompressedTexImage2D(
+						GL_TEXTURE_2D, static_cast<GLint>(level), compressedFormats[formatIndex - 3],
+						bakedLevel.width, bakedLevel.height, 0, static_cast<GLsizei>(bakedLevel.size), bakedLevel.data);
+				}
+				else
+				{
+					glTexImage2D(
+						GL_TEXTURE_2D, static_cast<GLint>(level), internalFormats[formatIndex],
+						bakedLevel.width, bakedLevel.height, 0, formats[formatIndex], GL_UNSIGNED_BYTE, bakedLevel.data);
+				}
+
+				uploadedBytes += bakedLevel.size;
+			}
+
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levels.size()) - 1);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		}
+		else
+		{
 			auto format = GL_RGBA;
 
-			if (channels == 1)
+			if (decoded.channels == 1)
 				format = GL_RED;
-			else if (channels == 3)
+			else if (decoded.channels == 3)
 				format = GL_RGB;
 
 			glTexImage2D(
-				GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+				GL_TEXTURE_2D, 0, format, decoded.width, decoded.height, 0,
+				format, GL_UNSIGNED_BYTE, decoded.data.get());
 
 			glGenerateMipmap(GL_TEXTURE_2D);
 
-			glBindTexture(GL_TEXTURE_2D, 0);
-			stbi_image_free(data);
+			// The driver's mip chain adds about a third.
+			uploadedBytes = static_cast<size_t>(decoded.width) * decoded.height * decoded.channels * 4 / 3;
 		}
-		else
+
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		return uploadedBytes;
+	}
+
+	bool TextureCache::SupportsS3tc()
+	{
+		GLint extensionCount = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+
+		for (GLint i = 0; i < extensionCount; ++i)
 		{
-			stbi_image_free(data);
+			const auto extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
 
-			const auto errorMessage = "Failed to load texture: " + filePath;
+			if (extension != nullptr && std::string(extension) == "GL_EXT_texture_compression_s3tc")
+				return true;
+		}
+
+		return false;
+	}
+
+	TextureArray TextureCache::LoadTextureArrayFromFiles(
+		const std::string& name, const std::vector<std::string>& filePaths)
+	{
+		if (filePaths.empty())
+		{
+			const auto errorMessage = "Texture array has no layers: " + name;
 			throw std::exception(errorMessage.c_str());
 		}
 
-		return Texture(
-			textureId, width, height, filePath, fileNameWithoutExtension);
+		int width = 0, height = 0;
+		std::vector<unsigned char> pixels;
+
+		// Decoded on the CPU into one contiguous buffer, so the whole array is
+		// uploaded with a single glTexImage3D.
+		for (const auto& filePath : filePaths)
+		{
+			int layerWidth, layerHeight, channels;
+
+			unsigned char* data = stbi_load(
+				filePath.c_str(), &layerWidth, &layerHeight, &channels, 4);
+
+			if (!data)
+			{
+				const auto errorMessage = "Failed to load texture: " + filePath;
+				throw std::exception(errorMessage.c_str());
+			}
+
+			if (pixels.empty())
+			{
+				width = layerWidth;
+				height = layerHeight;
+				pixels.reserve(static_cast<size_t>(width) * height * 4 * filePaths.size());
+			}
+			else if (layerWidth != width || layerHeight != height)
+			{
+				stbi_image_free(data);
+
+				const auto errorMessage = "Texture " + filePath +
+					" does not match the size of the first layer of texture array " + name;
+
+				throw std::exception(errorMessage.c_str());
+			}
+
+			pixels.insert(pixels.end(), data, data + static_cast<size_t>(width) * height * 4);
+			stbi_image_free(data);
+		}
+
+		const auto layerCount = static_cast<int>(filePaths.size());
+
+		unsigned textureId;
+
+		glGenTextures(1, &textureId);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, textureId);
+
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+		glTexImage3D(
+			GL_TEXTURE_2D_ARRAY, 0, GL_RGBA, width, height, layerCount, 0,
+			GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+		glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+
+		glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+		return TextureArray(textureId, width, height, layerCount, name);
 	}
 }
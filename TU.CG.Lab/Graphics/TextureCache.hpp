@@ -1,18 +1,88 @@
 #pragma once
 
+#include <chrono>
+#include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "BakedTexture.hpp"
 #include "Texture.hpp"
+#include "TextureArray.hpp"
+#include "Utils/CompletionQueue.hpp"
+#include "Utils/JobSystem.hpp"
+#include "Utils/RollingStatistics.hpp"
 
 namespace Graphics
 {
 	class TextureCache
 	{
+		public:
+			struct StreamingStats
+			{
+				size_t requestedTextures = 0;
+				size_t residentTextures = 0;
+				// Summed over the workers, so it can exceed the wall time.
+				double decodeMilliseconds = 0.0;
+				double maxUploadMilliseconds = 0.0;
+				// Baked textures found on disk, and ones baked because none were.
+				size_t bakedCacheHits = 0;
+				size_t bakedCacheMisses = 0;
+				// Texel data handed to the driver, mip levels included.
+				size_t uploadedBytes = 0;
+				// From the first request of a batch until its last texture was uploaded.
+				double lastBatchMilliseconds = 0.0;
+			};
 		private:
+			struct ImageDeleter
+			{
+				void operator()(unsigned char* data) const;
+			};
+
+			struct DecodedTexture
+			{
+				unsigned id = 0;
+				std::string filePath;
+				int width = 0;
+				int height = 0;
+				int channels = 0;
+				std::unique_ptr<unsigned char, ImageDeleter> data;
+				// Set instead of data when baked textures are in use.
+				std::optional<BakedTexture> baked;
+				std::string error;
+				double decodeMilliseconds = 0.0;
+			};
+
 			std::unordered_map<std::string, Texture> textureMap;
+			std::unordered_map<std::string, TextureArray> textureArrayMap;
+
+			// Decodes run here when set; without one, GetTexture loads synchronously.
+			Utils::JobSystem* jobSystem = nullptr;
+			// Owned through a pointer so in-flight jobs keep a valid target when the cache moves.
+			std::unique_ptr<Utils::CompletionQueue<DecodedTexture>> decodedTextures;
+			size_t pendingTextureCount = 0;
+
+			// Empty to decode the source images every time.
+			std::string bakeDirectory;
+			bool compressBakedTextures = false;
+
+			StreamingStats streamingStats;
+			std::chrono::steady_clock::time_point batchStart;
+			Utils::RollingStatistics uploadTimes;
 
-			static Texture LoadTextureFromFile(const std::string& filePath);
+			static Texture LoadTextureFromFile(
+				const std::string& filePath, const std::string& bakeDirectory, bool compress);
+			static TextureArray LoadTextureArrayFromFiles(
+				const std::string& name, const std::vector<std::string>& filePaths);
+			static unsigned CreateTexture();
+			static DecodedTexture DecodeTexture(
+				unsigned id, const std::string& filePath, const std::string& bakeDirectory, bool compress);
+			// Returns the number of texel bytes uploaded.
+			static size_t UploadTexture(const DecodedTexture& decoded);
+			static bool SupportsS3tc();
+
+			Texture RequestTexture(const std::string& filePath);
 		public:
 			TextureCache();
 			TextureCache(const TextureCache& other) = delete;
@@ -21,9 +91,36 @@ namespace Graphics
 			TextureCache& operator=(TextureCache&& other) noexcept;
 			~TextureCache();
 
+			// With a job system the texture comes back at once, showing a placeholder
+			// until UploadPendingTextures swaps the decoded image into the same id.
 			Texture GetTexture(const std::string& filePath);
 			void DeleteTexture(Texture& texture);
 
+			// Packs the images into one array, layer i holding filePaths[i]. All
+			// images must share one size; they are stored as RGBA.
+			TextureArray GetTextureArray(const std::string& name, const std::vector<std::string>& filePaths);
+
+			// Must be called on the GL thread; stops once budgetMilliseconds has passed.
+			void UploadPendingTextures(double budgetMilliseconds);
+			// Blocks until every requested texture is decoded and uploaded.
+			void FinishPendingTextures();
+
+			// The cache must be cleared before the job system it uses goes away.
+			void SetJobSystem(Utils::JobSystem* newJobSystem) { jobSystem = newJobSystem; }
+			// Loads textures from baked mip chains kept in directory, baking any that are
+			// missing on first use. Block-compressed when the driver supports S3TC.
+			// Must be called on the GL thread; an empty directory turns baking off.
+			void SetBakeDirectory(const std::string& directory);
+
+			// Bakes every image under contentDirectory ahead of time; needs no GL context.
+			// Returns the number of images baked or already up to date.
+			static size_t BakeAll(const std::string& contentDirectory, const std::string& directory);
+
+			[[nodiscard]] size_t GetPendingTextureCount() const { return pendingTextureCount; }
+			[[nodiscard]] const StreamingStats& GetStreamingStats() const { return streamingStats; }
+			// Time spent uploading per call that uploaded anything; spikes show up as hitches.
+			[[nodiscard]] const Utils::RollingStatistics& GetUploadTimes() const { return uploadTimes; }
+
 			void Clear();
 	};
 }
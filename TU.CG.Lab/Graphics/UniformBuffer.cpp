@@ -0,0 +1,82 @@
+#include "UniformBuffer.hpp"
+
+#include <string>
+#include <glad/glad.h>
+
+namespace Graphics
+{
+	UniformBuffer::UniformBuffer(const size_t size, const unsigned bindingPoint)
+		: size(size), bindingPoint(bindingPoint)
+	{
+		glGenBuffers(1, &id);
+
+		Bind();
+
+		glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+
+		Unbind();
+
+		glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, id);
+	}
+
+	UniformBuffer::UniformBuffer(UniformBuffer&& other) noexcept
+		: id(other.id), size(other.size), bindingPoint(other.bindingPoint)
+	{
+		other.id = 0;
+		other.size = 0;
+	}
+
+	UniformBuffer& UniformBuffer::operator=(UniformBuffer&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Delete();
+
+			id = other.id;
+			size = other.size;
+			bindingPoint = other.bindingPoint;
+
+			other.id = 0;
+			other.size = 0;
+		}
+
+		return *this;
+	}
+
+	UniformBuffer::~UniformBuffer()
+	{
+		Delete();
+	}
+
+	void UniformBuffer::Bind() const
+	{
+		glBindBuffer(GL_UNIFORM_BUFFER, id);
+	}
+
+	void UniformBuffer::Unbind() const
+	{
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	void UniformBuffer::SetData(const void* data, const size_t dataSize, const size_t offset) const
+	{
+		if (offset + dataSize > size)
+		{
+			const auto errorMessage = "Uniform buffer write of " + std::to_string(dataSize) +
+				" bytes at offset " + std::to_string(offset) + " exceeds its size.";
+
+			throw std::exception(errorMessage.c_str());
+		}
+
+		Bind();
+
+		glBufferSubData(GL_UNIFORM_BUFFER, offset, dataSize, data);
+
+		Unbind();
+	}
+
+	void UniformBuffer::Delete() const
+	{
+		glDeleteBuffers(1, &id);
+	}
+}
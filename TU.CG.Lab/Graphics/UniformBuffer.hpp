@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Graphics
+{
+	class UniformBuffer
+	{
+		private:
+			unsigned id = 0;
+			size_t size = 0;
+			unsigned bindingPoint = 0;
+
+			void Delete() const;
+		public:
+			UniformBuffer(size_t size, unsigned bindingPoint);
+			UniformBuffer(const UniformBuffer& other) = delete;
+			UniformBuffer& operator=(const UniformBuffer& other) = delete;
+			UniformBuffer(UniformBuffer&& other) noexcept;
+			UniformBuffer& operator=(UniformBuffer&& other) noexcept;
+			~UniformBuffer();
+
+			void Bind() const;
+			void Unbind() const;
+			void SetData(const void* data, size_t dataSize, size_t offset = 0) const;
+
+			template <typename T>
+			void SetData(const T& data) const
+			{
+				SetData(&data, sizeof(T));
+			}
+
+			[[nodiscard]] size_t GetSize() const { return size; }
+			[[nodiscard]] unsigned GetBindingPoint() const { return bindingPoint; }
+	};
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Graphics
+{
+	struct Vertex
+	{
+		glm::vec3 Position;
+		glm::vec3 Normal;
+		glm::vec2 TexCoords;
+	};
+}
@@ -10,9 +10,12 @@ namespace Graphics
 	}
 
 	VertexArray::VertexArray(VertexArray&& other) noexcept
-		: id(other.id), vbo(std::move(other.vbo)), ebo(std::move(other.ebo))
+		: id(other.id), vbo(std::move(other.vbo)), ebo(std::move(other.ebo)),
+		additionalVbos(std::move(other.additionalVbos)),
+		nextAttributeLocation(other.nextAttributeLocation)
 	{
 		other.id = 0;
+		other.nextAttributeLocation = 0;
 	}
 
 	VertexArray& VertexArray::operator=(VertexArray&& other) noexcept
@@ -24,8 +27,11 @@ namespace Graphics
 			id = other.id;
 			vbo = std::move(other.vbo);
 			ebo = std::move(other.ebo);
+			additionalVbos = std::move(other.additionalVbos);
+			nextAttributeLocation = other.nextAttributeLocation;
 
 			other.id = 0;
+			other.nextAttributeLocation = 0;
 		}
 
 		return* this;
@@ -54,9 +60,25 @@ namespace Graphics
 		Bind();
 
 		vbo = std::move(vb);
+		additionalVbos.clear();
 
 		vbo->Bind();
-		vbo->Configure();
+		nextAttributeLocation = vbo->Configure();
+	}
+
+	VertexBuffer* VertexArray::AddVertexBuffer(std::unique_ptr<VertexBuffer> vb)
+	{
+		if (vb == nullptr)
+			throw std::exception("Vertex Buffer cannot be null.");
+
+		Bind();
+
+		vb->Bind();
+		nextAttributeLocation = vb->Configure(nextAttributeLocation);
+
+		additionalVbos.push_back(std::move(vb));
+
+		return additionalVbos.back().get();
 	}
 
 	void VertexArray::SetElementBuffer(std::unique_ptr<ElementBuffer> eb)
@@ -77,5 +99,6 @@ namespace Graphics
 
 		vbo = nullptr;
 		ebo = nullptr;
+		additionalVbos.clear();
 	}
 }
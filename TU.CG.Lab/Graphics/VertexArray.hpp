@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "ElementBuffer.hpp"
 #include "VertexBuffer.hpp"
@@ -14,6 +15,8 @@ namespace Graphics
 
 			std::unique_ptr<VertexBuffer> vbo;
 			std::unique_ptr<ElementBuffer> ebo;
+			std::vector<std::unique_ptr<VertexBuffer>> additionalVbos;
+			unsigned nextAttributeLocation = 0;
 
 			void Delete();
 		public:
@@ -28,8 +31,12 @@ namespace Graphics
 			void Unbind();
 
 			void SetVertexBuffer(std::unique_ptr<VertexBuffer> vb);
+			// Attaches another stream (e.g. per-instance data) after the existing
+			// attribute locations.
+			VertexBuffer* AddVertexBuffer(std::unique_ptr<VertexBuffer> vb);
 			void SetElementBuffer(std::unique_ptr<ElementBuffer> eb);
 
 			[[nodiscard]] ElementBuffer* GetEbo() const { return ebo.get(); }
+			[[nodiscard]] unsigned GetNextAttributeLocation() const { return nextAttributeLocation; }
 	};
 }
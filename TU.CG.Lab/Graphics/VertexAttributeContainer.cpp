@@ -4,8 +4,10 @@
 
 namespace Graphics
 {
-	VertexAttribute::VertexAttribute(std::string name, const VertexAttributeType type)
-		: name(std::move(name)), type(type), size(GetSizeOfType(type)), offset(0)
+	VertexAttribute::VertexAttribute(
+		std::string name, const VertexAttributeType type, const unsigned divisor)
+			: name(std::move(name)), type(type), size(GetSizeOfType(type)), offset(0),
+			divisor(divisor)
 	{
 	}
 
@@ -34,6 +36,11 @@ namespace Graphics
 			case VertexAttributeType::MAT3F:
 			case VertexAttributeType::MAT4F:
 				return GetCompontentCount(type) * sizeof(float);
+			case VertexAttributeType::INT:
+			case VertexAttributeType::IVEC2:
+			case VertexAttributeType::IVEC3:
+			case VertexAttributeType::IVEC4:
+				return GetCompontentCount(type) * sizeof(int);
 		}
 
 		const std::string errorMessage = "Unhandled Vertex attribute type " +
@@ -47,12 +54,16 @@ namespace Graphics
 		switch (type)
 		{
 			case VertexAttributeType::FLOAT:
+			case VertexAttributeType::INT:
 				return 1;
 			case VertexAttributeType::VEC2F:
+			case VertexAttributeType::IVEC2:
 				return 2;
 			case VertexAttributeType::VEC3F:
+			case VertexAttributeType::IVEC3:
 				return 3;
 			case VertexAttributeType::VEC4F:
+			case VertexAttributeType::IVEC4:
 				return 4;
 			case VertexAttributeType::MAT3F:
 				return 9;
@@ -77,6 +88,11 @@ namespace Graphics
 			case VertexAttributeType::MAT3F:
 			case VertexAttributeType::MAT4F:
 				return GL_FLOAT;
+			case VertexAttributeType::INT:
+			case VertexAttributeType::IVEC2:
+			case VertexAttributeType::IVEC3:
+			case VertexAttributeType::IVEC4:
+				return GL_INT;
 		}
 
 		const std::string errorMessage = "Unhandled Vertex attribute type " +
@@ -84,4 +100,23 @@ namespace Graphics
 
 		throw std::exception(errorMessage.c_str());
 	}
+
+	int GetLocationCount(const VertexAttributeType type)
+	{
+		// Matrices take one attribute location per column.
+		switch (type)
+		{
+			case VertexAttributeType::MAT3F:
+				return 3;
+			case VertexAttributeType::MAT4F:
+				return 4;
+			default:
+				return 1;
+		}
+	}
+
+	bool IsIntegerType(const VertexAttributeType type)
+	{
+		return GetComponentGLType(type) == GL_INT;
+	}
 }
@@ -13,6 +13,10 @@ namespace Graphics
 		VEC4F,
 		MAT3F,
 		MAT4F,
+		INT,
+		IVEC2,
+		IVEC3,
+		IVEC4,
 	};
 
 	struct VertexAttribute
@@ -21,8 +25,10 @@ namespace Graphics
 		VertexAttributeType type;
 		size_t size;
 		unsigned offset;
+		// 0 advances per vertex, N advances once every N instances.
+		unsigned divisor;
 
-		VertexAttribute(std::string name, VertexAttributeType type);
+		VertexAttribute(std::string name, VertexAttributeType type, unsigned divisor = 0);
 	};
 
 	class VertexAttributeContainer
@@ -49,4 +55,6 @@ namespace Graphics
 	extern size_t GetSizeOfType(VertexAttributeType type);
 	extern int GetCompontentCount(VertexAttributeType type);
 	extern int GetComponentGLType(VertexAttributeType type);
+	extern int GetLocationCount(VertexAttributeType type);
+	extern bool IsIntegerType(VertexAttributeType type);
 }
@@ -4,21 +4,40 @@
 
 namespace Graphics
 {
-	VertexBuffer::VertexBuffer(const void* data, const size_t size)
+	namespace
+	{
+		GLenum GetGLUsage(const BufferUsage usage)
+		{
+			switch (usage)
+			{
+				case BufferUsage::DYNAMIC_DRAW:
+					return GL_DYNAMIC_DRAW;
+				case BufferUsage::STREAM_DRAW:
+					return GL_STREAM_DRAW;
+				default:
+					return GL_STATIC_DRAW;
+			}
+		}
+	}
+
+	VertexBuffer::VertexBuffer(const void* data, const size_t size, const BufferUsage usage)
+		: size(size), usage(usage)
 	{
 		glGenBuffers(1, &id);
 
 		Bind();
 
-		glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+		glBufferData(GL_ARRAY_BUFFER, size, data, GetGLUsage(usage));
 
 		Unbind();
 	}
 
 	VertexBuffer::VertexBuffer(VertexBuffer&& other) noexcept
-		: id(other.id), attributes(std::move(other.attributes))
+		: id(other.id), size(other.size), usage(other.usage),
+		attributes(std::move(other.attributes))
 	{
 		other.id = 0;
+		other.size = 0;
 		other.attributes = VertexAttributeContainer();
 	}
 
@@ -29,9 +48,12 @@ namespace Graphics
 			Delete();
 
 			id = other.id;
+			size = other.size;
+			usage = other.usage;
 			attributes = other.attributes;
 
 			other.id = 0;
+			other.size = 0;
 			other.attributes = VertexAttributeContainer();
 		}
 
@@ -53,22 +75,45 @@ namespace Graphics
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
-	void VertexBuffer::Configure()
+	unsigned VertexBuffer::Configure(const unsigned firstLocation, const size_t baseOffset)
 	{
-		auto i = 0;
+		auto location = firstLocation;
+		const auto stride = static_cast<int>(attributes.GetStride());
 
 		for (const auto& attribute : attributes)
 		{
-			const auto count = GetCompontentCount(attribute.type);
+			const auto locationCount = GetLocationCount(attribute.type);
+			const auto count = GetCompontentCount(attribute.type) / locationCount;
 			const auto glType = GetComponentGLType(attribute.type);
-			const auto stride = attributes.GetStride();
+			const auto columnSize = attribute.size / locationCount;
+
+			for (int column = 0; column < locationCount; ++column)
+			{
+				const auto pointer = reinterpret_cast<void*>(
+					baseOffset + attribute.offset + column * columnSize);
 
-			glVertexAttribPointer(
-				i, count, glType, GL_FALSE, stride,
-				reinterpret_cast<void*>(attribute.offset));
+				if (IsIntegerType(attribute.type))
+					glVertexAttribIPointer(location, count, glType, stride, pointer);
+				else
+					glVertexAttribPointer(location, count, glType, GL_FALSE, stride, pointer);
 
-			glEnableVertexAttribArray(i++);
+				glVertexAttribDivisor(location, attribute.divisor);
+				glEnableVertexAttribArray(location++);
+			}
 		}
+
+		return location;
+	}
+
+	void VertexBuffer::SetData(const void* data, const size_t newSize)
+	{
+		size = newSize;
+
+		Bind();
+
+		glBufferData(GL_ARRAY_BUFFER, size, data, GetGLUsage(usage));
+
+		Unbind();
 	}
 
 	void VertexBuffer::Delete() const
@@ -4,15 +4,24 @@
 
 namespace Graphics
 {
+	enum class BufferUsage
+	{
+		STATIC_DRAW,
+		DYNAMIC_DRAW,
+		STREAM_DRAW,
+	};
+
 	class VertexBuffer
 	{
 		private:
 			unsigned id = 0;
+			size_t size = 0;
+			BufferUsage usage = BufferUsage::STATIC_DRAW;
 			VertexAttributeContainer attributes;
 
 			void Delete() const;
 		public:
-			VertexBuffer(const void* data, size_t size);
+			VertexBuffer(const void* data, size_t size, BufferUsage usage = BufferUsage::STATIC_DRAW);
 			VertexBuffer(const VertexBuffer& other) = delete;
 			VertexBuffer& operator=(const VertexBuffer& other) = delete;
 			VertexBuffer(VertexBuffer&& other) noexcept;
@@ -21,7 +30,15 @@ namespace Graphics
 
 			void Bind() const;
 			void Unbind();
-			void Configure();
+			// Sets up the attributes from firstLocation on, reading from baseOffset
+			// bytes into the buffer. Returns the first location left unused.
+			unsigned Configure(unsigned firstLocation = 0, size_t baseOffset = 0);
+
+			// Replaces the contents, reallocating so in-flight draws are not stalled.
+			void SetData(const void* data, size_t newSize);
+
+			[[nodiscard]] size_t GetSize() const { return size; }
+			[[nodiscard]] const VertexAttributeContainer& GetAttributes() const { return attributes; }
 
 			void SetAttributes(const VertexAttributeContainer& newAttributes)
 			{
@@ -4,6 +4,9 @@ namespace Input
 {
 	void InputManager::PressKey(const Keys key)
 	{
+		if (!IsKeyDown(key))
+			pressedKeys.insert(key);
+
 		keyMap[key] = true;
 	}
 
@@ -14,6 +17,9 @@ namespace Input
 
 	void InputManager::PressButton(const MouseButtons button)
 	{
+		if (!IsButtonDown(button))
+			pressedButtons.insert(button);
+
 		buttonMap[button] = true;
 	}
 
@@ -47,8 +53,20 @@ namespace Input
 		return false;
 	}
 
+	bool InputManager::IsKeyPressed(const Keys key) const
+	{
+		return pressedKeys.contains(key);
+	}
+
+	bool InputManager::IsButtonPressed(const MouseButtons button) const
+	{
+		return pressedButtons.contains(button);
+	}
+
 	void InputManager::ResetState()
 	{
 		scrollValue = 0.0f;
+		pressedKeys.clear();
+		pressedButtons.clear();
 	}
 }
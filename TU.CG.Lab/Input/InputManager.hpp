@@ -2,6 +2,7 @@
 
 #include <glm/glm.hpp>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "Keys.hpp"
 #include "MouseButtons.hpp"
@@ -13,6 +14,9 @@ namespace Input
 		private:
 			std::unordered_map<Keys, bool> keyMap;
 			std::unordered_map<MouseButtons, bool> buttonMap;
+			// Keys and buttons that went down since the last ResetState.
+			std::unordered_set<Keys> pressedKeys;
+			std::unordered_set<MouseButtons> pressedButtons;
 
 			glm::vec2 cursorPosition = glm::vec2(0.0f, 0.0f);
 			float scrollValue = 0.0f;
@@ -25,7 +29,8 @@ namespace Input
 
 			bool IsKeyDown(Keys key);
 			bool IsButtonDown(MouseButtons button);
-		    // TODO: Possible optimizations: IsKeyPressed, IsButtonPressed
+			bool IsKeyPressed(Keys key) const;
+			bool IsButtonPressed(MouseButtons button) const;
 
 			void ResetState();
 
@@ -0,0 +1,150 @@
+#include "PlayerBody.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Physics
+{
+	namespace
+	{
+		// Boxes closer than this to a block face count as touching it.
+		constexpr float CONTACT_EPSILON = 1e-4f;
+
+		int FloorToInt(const float value)
+		{
+			return static_cast<int>(std::floor(value));
+		}
+
+		int CeilToInt(const float value)
+		{
+			return static_cast<int>(std::ceil(value));
+		}
+	}
+
+	PlayerBody::PlayerBody(const glm::vec3& position, const PlayerBodySettings& settings)
+		: settings(settings), position(position)
+	{
+	}
+
+	glm::vec3 PlayerBody::GetMin() const
+	{
+		return position - glm::vec3(settings.halfWidth, 0.0f, settings.halfWidth);
+	}
+
+	glm::vec3 PlayerBody::GetMax() const
+	{
+		return position + glm::vec3(settings.halfWidth, settings.height, settings.halfWidth);
+	}
+
+	void PlayerBody::Step(const Voxels::IBlockVolume& volume, const float deltaTime)
+	{
+		const auto previousVelocityY = velocity.y;
+		velocity.y = std::max(velocity.y - settings.gravity * deltaTime, -settings.maxFallSpeed);
+
+		// Averaging the two velocities integrates constant gravity exactly, so
+		// jump heights and fall times match at any frame rate.
+		auto displacement = velocity * deltaTime;
+		displacement.y = 0.5f * (previousVelocityY + velocity.y) * deltaTime;
+
+		// Vertical first, so walking off a ledge and landing resolve before sliding.
+		const auto moveY = Sweep(volume, 1, displacement.y);
+		position.y += moveY;
+
+		if (displacement.y < 0.0f)
+			onGround = moveY > displacement.y;
+		else if (displacement.y > 0.0f)
+			onGround = false;
+
+		if (moveY != displacement.y)
+			velocity.y = 0.0f;
+
+		for (const auto axis : { 0, 2 })
+		{
+			const auto move = Sweep(volume, axis, displacement[axis]);
+			position[axis] += move;
+
+			if (move != displacement[axis])
+				velocity[axis] = 0.0f;
+		}
+	}
+
+	bool PlayerBody::Jump()
+	{
+		if (!onGround)
+			return false;
+
+		velocity.y = settings.jumpSpeed;
+		onGround = false;
+
+		return true;
+	}
+
+	bool PlayerBody::IsTouching(const Voxels::IBlockVolume& volume, const int axis, const int direction) const
+	{
+		const auto probe = static_cast<float>(direction) * 2.0f * CONTACT_EPSILON;
+
+		return Sweep(volume, axis, probe) != probe;
+	}
+
+	float PlayerBody::Sweep(const Voxels::IBlockVolume& volume, const int axis, const float distance) const
+	{
+		if (distance == 0.0f)
+			return 0.0f;
+
+		// Blocks are centred on integer positions; shifted by half a block,
+		// block b spans [b, b + 1] on every axis.
+		const auto min = GetMin() + 0.5f;
+		const auto max = GetMax() + 0.5f;
+
+		const auto u = (axis + 1) % 3;
+		const auto v = (axis + 2) % 3;
+
+		// Blocks the box overlaps across the move; merely touching does not count.
+		const auto uFirst = FloorToInt(min[u] + CONTACT_EPSILON);
+		const auto uLast = CeilToInt(max[u] - CONTACT_EPSILON) - 1;
+		const auto vFirst = FloorToInt(min[v] + CONTACT_EPSILON);
+		const auto vLast = CeilToInt(max[v] - CONTACT_EPSILON) - 1;
+
+		const auto isLayerSolid = [&](const int layer)
+		{
+			glm::ivec3 block;
+			block[axis] = layer;
+
+			for (block[u] = uFirst; block[u] <= uLast; ++block[u])
+				for (block[v] = vFirst; block[v] <= vLast; ++block[v])
+				{
+					if (volume.IsSolid(block.x, block.y, block.z))
+						return true;
+				}
+
+			return false;
+		};
+
+		// Walk the layers of blocks ahead of the leading face, nearest first,
+		// and stop at the first one with anything solid in the way.
+		if (distance > 0.0f)
+		{
+			const auto first = CeilToInt(max[axis] - CONTACT_EPSILON);
+			const auto last = CeilToInt(max[axis] + distance) - 1;
+
+			for (int layer = first; layer <= last; ++layer)
+			{
+				if (isLayerSolid(layer))
+					return std::max(static_cast<float>(layer) - max[axis], 0.0f);
+			}
+		}
+		else
+		{
+			const auto first = FloorToInt(min[axis] + CONTACT_EPSILON) - 1;
+			const auto last = FloorToInt(min[axis] + distance);
+
+			for (int layer = first; layer >= last; --layer)
+			{
+				if (isLayerSolid(layer))
+					return std::min(static_cast<float>(layer + 1) - min[axis], 0.0f);
+			}
+		}
+
+		return distance;
+	}
+}
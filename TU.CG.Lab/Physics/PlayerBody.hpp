@@ -0,0 +1,64 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include "Voxels/IBlockVolume.hpp"
+
+namespace Physics
+{
+	struct PlayerBodySettings
+	{
+		// Half the width and depth, and the full height of the box above the feet.
+		float halfWidth = 0.3f;
+		float height = 1.8f;
+		float eyeHeight = 1.5f;
+
+		// Units per second (squared for gravity).
+		float gravity = 25.0f;
+		float jumpSpeed = 8.0f;
+		float maxFallSpeed = 50.0f;
+	};
+
+	// An axis-aligned box moved through the block grid one axis at a time. Each
+	// move is swept against every block it would pass through, so the result does
+	// not depend on the frame rate and fast bodies cannot tunnel through walls.
+	class PlayerBody
+	{
+		private:
+			PlayerBodySettings settings;
+
+			// Centre of the bottom face of the box.
+			glm::vec3 position;
+			glm::vec3 velocity = glm::vec3(0.0f);
+			bool onGround = false;
+
+			float Sweep(const Voxels::IBlockVolume& volume, int axis, float distance) const;
+		public:
+			explicit PlayerBody(const glm::vec3& position, const PlayerBodySettings& settings = PlayerBodySettings());
+
+			// Applies gravity and moves by the velocity for deltaTime seconds.
+			void Step(const Voxels::IBlockVolume& volume, float deltaTime);
+
+			// Starts a jump when standing on the ground; returns whether it did.
+			bool Jump();
+
+			void SetPosition(const glm::vec3& newPosition) { position = newPosition; }
+			void SetVelocity(const glm::vec3& newVelocity) { velocity = newVelocity; }
+			void SetHorizontalVelocity(const glm::vec2& newVelocity)
+			{
+				velocity.x = newVelocity.x;
+				velocity.z = newVelocity.y;
+			}
+
+			// Whether the box touches the volume on the given axis side; direction is -1 or 1.
+			[[nodiscard]] bool IsTouching(const Voxels::IBlockVolume& volume, int axis, int direction) const;
+
+			[[nodiscard]] glm::vec3 GetPosition() const { return position; }
+			[[nodiscard]] glm::vec3 GetEyePosition() const { return position + glm::vec3(0.0f, settings.eyeHeight, 0.0f); }
+			[[nodiscard]] glm::vec3 GetVelocity() const { return velocity; }
+			[[nodiscard]] glm::vec3 GetMin() const;
+			[[nodiscard]] glm::vec3 GetMax() const;
+			[[nodiscard]] bool IsOnGround() const { return onGround; }
+			[[nodiscard]] const PlayerBodySettings& GetSettings() const { return settings; }
+	};
+}
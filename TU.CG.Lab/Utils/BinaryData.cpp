@@ -0,0 +1,96 @@
+#include "BinaryData.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+namespace Utils
+{
+	void PutUint(std::vector<std::byte>& buffer, const std::uint64_t value, const int byteCount)
+	{
+		for (int i = 0; i < byteCount; ++i)
+			buffer.push_back(static_cast<std::byte>(value >> (8 * i)));
+	}
+
+	void PutFloat(std::vector<std::byte>& buffer, const float value)
+	{
+		std::uint32_t bits;
+		std::memcpy(&bits, &value, 4);
+
+		PutUint(buffer, bits, 4);
+	}
+
+	void PutBytes(std::vector<std::byte>& buffer, const void* data, const size_t size)
+	{
+		const auto bytes = static_cast<const std::byte*>(data);
+		buffer.insert(buffer.end(), bytes, bytes + size);
+	}
+
+	void PadToFour(std::vector<std::byte>& buffer)
+	{
+		buffer.resize((buffer.size() + 3) & ~static_cast<size_t>(3));
+	}
+
+	std::uint64_t GetUint(const std::byte* data, const int byteCount)
+	{
+		std::uint64_t value = 0;
+
+		for (int i = 0; i < byteCount; ++i)
+			value |= static_cast<std::uint64_t>(data[i]) << (8 * i);
+
+		return value;
+	}
+
+	float GetFloat(const std::byte* data)
+	{
+		const auto bits = static_cast<std::uint32_t>(GetUint(data, 4));
+
+		float value;
+		std::memcpy(&value, &bits, 4);
+
+		return value;
+	}
+
+	void WriteFileAtomically(const std::string& filePath, const std::span<const std::byte> bytes)
+	{
+		// Unique per thread, so two workers writing the same file do not share one.
+		const auto temporaryFilePath = filePath + "." +
+			std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+
+		try
+		{
+			const auto directory = std::filesystem::path(filePath).parent_path();
+
+			if (!directory.empty())
+				std::filesystem::create_directories(directory);
+
+			std::ofstream stream(temporaryFilePath, std::ios::binary | std::ios::trunc);
+
+			if (!stream)
+			{
+				const auto errorMessage = "Failed to open for writing: " + temporaryFilePath;
+				throw std::exception(errorMessage.c_str());
+			}
+
+			stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+			stream.close();
+
+			if (stream.fail())
+			{
+				const auto errorMessage = "Failed to write: " + temporaryFilePath;
+				throw std::exception(errorMessage.c_str());
+			}
+
+			std::filesystem::rename(temporaryFilePath, filePath);
+		}
+		catch (const std::exception&)
+		{
+			std::error_code errorCode;
+			std::filesystem::remove(temporaryFilePath, errorCode);
+
+			throw;
+		}
+	}
+}
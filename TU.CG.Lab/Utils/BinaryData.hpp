@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Utils
+{
+	// Little-endian fields for the binary file formats, independent of the host's byte order.
+	void PutUint(std::vector<std::byte>& buffer, std::uint64_t value, int byteCount);
+	void PutFloat(std::vector<std::byte>& buffer, float value);
+	void PutBytes(std::vector<std::byte>& buffer, const void* data, size_t size);
+	// Zero-fills the buffer up to the next multiple of four bytes.
+	void PadToFour(std::vector<std::byte>& buffer);
+
+	[[nodiscard]] std::uint64_t GetUint(const std::byte* data, int byteCount);
+	[[nodiscard]] float GetFloat(const std::byte* data);
+
+	// Writes bytes under a temporary name next to filePath, then renames it into
+	// place, so no reader ever maps half a file. Creates missing directories and
+	// throws on failure, leaving no temporary file behind.
+	void WriteFileAtomically(const std::string& filePath, std::span<const std::byte> bytes);
+}
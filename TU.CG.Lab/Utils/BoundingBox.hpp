@@ -0,0 +1,52 @@
+#pragma once
+
+#include <limits>
+#include <glm/glm.hpp>
+
+namespace Utils
+{
+	// Axis-aligned box; an empty box has min > max and grows with Extend.
+	struct BoundingBox
+	{
+		glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+		glm::vec3 max = glm::vec3(std::numeric_limits<float>::lowest());
+
+		BoundingBox() = default;
+		BoundingBox(const glm::vec3& min, const glm::vec3& max) : min(min), max(max) {}
+
+		void Extend(const glm::vec3& point)
+		{
+			min = glm::min(min, point);
+			max = glm::max(max, point);
+		}
+
+		void Extend(const BoundingBox& other)
+		{
+			min = glm::min(min, other.min);
+			max = glm::max(max, other.max);
+		}
+
+		[[nodiscard]] bool IsEmpty() const
+		{
+			return min.x > max.x || min.y > max.y || min.z > max.z;
+		}
+
+		// Box around the transformed corners, for placing local bounds in the world.
+		[[nodiscard]] BoundingBox Transform(const glm::mat4& matrix) const
+		{
+			BoundingBox result;
+
+			for (int i = 0; i < 8; ++i)
+			{
+				const glm::vec3 corner(
+					i & 1 ? max.x : min.x,
+					i & 2 ? max.y : min.y,
+					i & 4 ? max.z : min.z);
+
+				result.Extend(glm::vec3(matrix * glm::vec4(corner, 1.0f)));
+			}
+
+			return result;
+		}
+	};
+}
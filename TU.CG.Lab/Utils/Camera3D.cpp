@@ -4,119 +4,99 @@
 #include <glm/ext/matrix_transform.hpp>
 #include <cmath>
 
+#include "Profiler.hpp"
+
 namespace Utils
 {
 	Camera3D::Camera3D(
 		const glm::vec3 position, const glm::vec3 worldUp, const float maxZoom)
 		:
-		position(5.0f, 2.0f, 7.0f), front(0.0f, 0.0f, -1.0f), up(), right(), worldUp(worldUp),
+		position(5.0f, 2.0f, 7.0f), previousPosition(position), renderPosition(position), front(0.0f, 0.0f, -1.0f), up(), right(), worldUp(worldUp),
 		yaw(-90.0f), pitch(0.0f), movementSpeed(movementSpeedWalk), mouseSensitivity(0.1f),
 		previousCursorPosition(0.0f), zoom(maxZoom), maxZoom(maxZoom),
-		isUserControlEnabled(true)
+		isUserControlEnabled(true), body(glm::vec3(0.0f)), spawnPosition(this->position)
 	{
+		SetPosition(this->position);
 	}
 
 	glm::mat4 Camera3D::GetViewMatrix() const
 	{
-		return glm::lookAt(position, position + front, up);
+		return glm::lookAt(renderPosition, renderPosition + front, up);
 	}
 
-	bool Camera3D::AllowedPos(glm::vec3 pos) {
-		//map
-
-		int posX = round(pos.x);
-		int posY = round(pos.y);
-		int posZ = round(pos.z);
-
-		if (map[(int)posX][(int)posZ][(int)posY] != 0)
-			return false;
-
-		if (map[(int)posX][(int)posZ][(int)posY - 1] != 0)
-			return false;
-
-		if (pos.x > 1 && pos.x < 31 && pos.z > 1 && pos.z < 31)
-			return true;
+	void Camera3D::SetPosition(const glm::vec3& newPosition)
+	{
+		position = newPosition;
+		previousPosition = newPosition;
+		renderPosition = newPosition;
 
-		return false;
+		body.SetPosition(position - glm::vec3(0.0f, body.GetSettings().eyeHeight, 0.0f));
+		body.SetVelocity(glm::vec3(0.0f));
 	}
 
-	void Camera3D::SetMap(int data[32][32][32]) {
-		for (int x = 0; x < 32; x++) {
-			for (int y = 0; y < 32; y++) {
-				for (int z = 0; z < 32; z++) {
-					map[x][y][z] = data[x][y][z];
-				}
-			}
+	void Camera3D::Move(const float deltaTime, Input::InputManager& inputManager)
+	{
+		// Walking stays on the ground plane wherever the camera looks.
+		const auto forward = glm::normalize(glm::vec2(front.x, front.z));
+		const glm::vec2 sideways(-forward.y, forward.x);
+
+		auto velocity = glm::vec2(0.0f);
+
+		if (inputManager.IsKeyDown(Input::Keys::W))
+			velocity += forward * movementSpeed;
+		if (inputManager.IsKeyDown(Input::Keys::S))
+			velocity -= forward * movementSpeed;
+		if (inputManager.IsKeyDown(Input::Keys::A))
+			velocity -= sideways * movementSpeedWalk;
+		if (inputManager.IsKeyDown(Input::Keys::D))
+			velocity += sideways * movementSpeedWalk;
+
+		if (world == nullptr)
+		{
+			position += glm::vec3(velocity.x, 0.0f, velocity.y) * deltaTime;
+			body.SetPosition(position - glm::vec3(0.0f, body.GetSettings().eyeHeight, 0.0f));
+			return;
 		}
-	}
 
-	float Camera3D::GetY(glm::vec3 pos) {
-		int posX = round(pos.x);
-		int posY = round(pos.y);
-		int posZ = round(pos.z);
+		body.SetHorizontalVelocity(velocity);
+
+		if (inputManager.IsKeyDown(Input::Keys::SPACE))
+			body.Jump();
 
-		if (map[(int)posX][(int)posZ][(int)posY - 2] == 0) {
-			falling = true;
-			return pos.y -= 0.1f;
+		body.Step(*world, deltaTime);
+
+		if (body.GetPosition().y < respawnHeight)
+		{
+			SetPosition(spawnPosition);
+			return;
 		}
 
-		falling = false;
-		return pos.y;
+		position = body.GetEyePosition();
 	}
 
 	void Camera3D::Update(const float deltaTime, Input::InputManager& inputManager)
 	{
+		PROFILE_ZONE("Camera3D::Update");
+
 		if (!isUserControlEnabled)
 			return;
 
-		const auto velocityLeftRight = movementSpeedWalk * deltaTime;
-		const auto velocityForwardBackward = movementSpeed * deltaTime;
-		const auto forwardBackwardMovement = front * velocityForwardBackward;
-		const auto leftRightMovement = (right * velocityLeftRight);
-
-		position.y = GetY(position);
-
-		if (inputManager.IsKeyDown(Input::Keys::W)) {
-			//glm::vec3 nextPos = position + forwardBackwardMovement;
-			auto nextPos = position;
-			nextPos.x = position.x + forwardBackwardMovement.x;
-			nextPos.z = position.z + forwardBackwardMovement.z;
-
-			if (AllowedPos(nextPos))
-				position = nextPos;
-		}
-		if (inputManager.IsKeyDown(Input::Keys::S)) {
-			auto nextPos = position;
-			nextPos.x = position.x - forwardBackwardMovement.x;
-			nextPos.z = position.z - forwardBackwardMovement.z;
-
-			if (AllowedPos(nextPos))
-				position = nextPos;
-		}
-		if (inputManager.IsKeyDown(Input::Keys::A)) {
-			glm::vec3 nextPos = position - leftRightMovement;
-			if (AllowedPos(nextPos))
-				position = nextPos;
-		}
-		if (inputManager.IsKeyDown(Input::Keys::D)) {
-			glm::vec3 nextPos = position + leftRightMovement;
-			if (AllowedPos(nextPos))
-				position = nextPos;
-		}
-
-		if (inputManager.IsKeyDown(Input::Keys::SPACE) && !falling) {
-			glm::vec3 nextPos = position;
-			nextPos.y += 1;
-
-			if (AllowedPos(nextPos))
-				position = nextPos;
-		}
-
 		if (inputManager.IsKeyDown(Input::Keys::LEFT_CONTROL))
 			movementSpeed = movementSpeedRun;
 		else
 			movementSpeed = movementSpeedWalk;
 
+		// Teleports through SetPosition overwrite this, so they are not blended.
+		previousPosition = position;
+
+		Move(deltaTime, inputManager);
+	}
+
+	void Camera3D::UpdateLook(Input::InputManager& inputManager)
+	{
+		if (!isUserControlEnabled)
+			return;
+
 		const auto currentCursorPos = inputManager.GetCursorPosition();
 
 		auto xOffset = currentCursorPos.x - previousCursorPosition.x;
@@ -132,6 +112,29 @@ namespace Utils
 
 		pitch = std::clamp(pitch, -89.0f, 89.0f);
 
+		UpdateVectors();
+
+		zoom -= inputManager.GetScrollValue();
+		zoom = std::clamp(zoom, 1.0f, maxZoom);
+	}
+
+	void Camera3D::SetOrientation(const float newYaw, const float newPitch)
+	{
+		yaw = newYaw;
+		pitch = std::clamp(newPitch, -89.0f, 89.0f);
+
+		UpdateVectors();
+	}
+
+	void Camera3D::SetPose(const CameraPose& pose)
+	{
+		SetPosition(pose.position);
+		SetOrientation(pose.yaw, pose.pitch);
+		zoom = std::clamp(pose.zoom, 1.0f, maxZoom);
+	}
+
+	void Camera3D::UpdateVectors()
+	{
 		const auto yawRadians = glm::radians(yaw);
 		const auto pitchRadians = glm::radians(pitch);
 
@@ -142,8 +145,10 @@ namespace Utils
 		front = glm::normalize(front);
 		right = glm::normalize(glm::cross(front, worldUp));
 		up = glm::normalize(glm::cross(right, front));
+	}
 
-		zoom -= inputManager.GetScrollValue();
-		zoom = std::clamp(zoom, 1.0f, maxZoom);
+	void Camera3D::Interpolate(const float alpha)
+	{
+		renderPosition = glm::mix(previousPosition, position, alpha);
 	}
 }
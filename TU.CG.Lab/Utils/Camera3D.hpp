@@ -2,7 +2,10 @@
 
 #include <glm/glm.hpp>
 
+#include "CameraPath.hpp"
 #include "Input/InputManager.hpp"
+#include "Physics/PlayerBody.hpp"
+#include "Voxels/IBlockVolume.hpp"
 
 namespace Utils
 {
@@ -10,6 +13,9 @@ namespace Utils
 	{
 		private:
 			glm::vec3 position;
+			// Position at the start of the last tick, and the blend drawn this frame.
+			glm::vec3 previousPosition;
+			glm::vec3 renderPosition;
 			glm::vec3 front;
 			glm::vec3 up;
 			glm::vec3 right;
@@ -29,32 +35,51 @@ namespace Utils
 			const float maxZoom;
 
 			bool isUserControlEnabled;
-			int map[32][32][32];
-			bool falling = false;
+			// Without a world the camera flies freely; with one it walks as the body.
+			const Voxels::IBlockVolume* world = nullptr;
+			Physics::PlayerBody body;
+			glm::vec3 spawnPosition;
+			float respawnHeight = -32.0f;
+
+			void Move(float deltaTime, Input::InputManager& inputManager);
+			void UpdateVectors();
 		public:
 			Camera3D(glm::vec3 position, glm::vec3 worldUp, float maxZoom);
 
+			// Movement, run once per simulation tick.
 			void Update(float deltaTime, Input::InputManager& inputManager);
+			// Mouse look and zoom, run once per rendered frame.
+			void UpdateLook(Input::InputManager& inputManager);
+			// Places the drawn camera between the last two ticks; alpha runs from 0 to 1.
+			void Interpolate(float alpha);
 
 			void SetIsUserControlEnabled(const bool value) { isUserControlEnabled = value; }
-			void SetPosition(const glm::vec3& newPosition) { position = newPosition; }
+			void SetPosition(const glm::vec3& newPosition);
 			void SetFront(const glm::vec3& newFront) { front = newFront; }
 			void SetWorldUp(const glm::vec3& newWorldUp) { worldUp = newWorldUp; }
 			void SetZoom(const float newZoom) { zoom = newZoom; }
+			// Degrees; pitch is clamped like mouse look.
+			void SetOrientation(float newYaw, float newPitch);
+			// Moves and aims the camera at once, as a teleport.
+			void SetPose(const CameraPose& pose);
 			void SetMovementSpeed(const float newMovementSpeed) { movementSpeed = newMovementSpeed; }
 			void SetMouseSensitivity(const float newMouseSensitivity) { mouseSensitivity = newMouseSensitivity; }
-			bool AllowedPos(glm::vec3 pos);
-			void SetMap(int data[32][32][32]);
-			float GetY(glm::vec3 pos);
+			void SetWorld(const Voxels::IBlockVolume* newWorld) { world = newWorld; }
+			void SetSpawnPosition(const glm::vec3& newSpawnPosition) { spawnPosition = newSpawnPosition; }
 
 			[[nodiscard]] glm::mat4 GetViewMatrix() const;
 
 			[[nodiscard]] bool GetIsUserControlEnabled() const { return isUserControlEnabled; }
 			[[nodiscard]] glm::vec3 GetPosition() const { return position; }
+			[[nodiscard]] glm::vec3 GetRenderPosition() const { return renderPosition; }
 			[[nodiscard]] glm::vec3 GetFront() const { return front; }
 			[[nodiscard]] glm::vec3 GetWorldUp() const { return worldUp; }
 			[[nodiscard]] float GetZoom() const { return zoom; }
+			[[nodiscard]] float GetYaw() const { return yaw; }
+			[[nodiscard]] float GetPitch() const { return pitch; }
+			[[nodiscard]] CameraPose GetPose() const { return { position, yaw, pitch, zoom }; }
 			[[nodiscard]] float GetMovementSpeed() const { return movementSpeed; }
 			[[nodiscard]] float GetMouseSensitivity() const { return mouseSensitivity; }
+			[[nodiscard]] const Physics::PlayerBody& GetBody() const { return body; }
 	};
 }
@@ -0,0 +1,197 @@
+#include "CameraPath.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace Utils
+{
+	namespace
+	{
+		constexpr int CHANNEL_COUNT = 6;
+
+		void ToChannels(const CameraPose& pose, float* channels)
+		{
+			channels[0] = pose.position.x;
+			channels[1] = pose.position.y;
+			channels[2] = pose.position.z;
+			channels[3] = pose.yaw;
+			channels[4] = pose.pitch;
+			channels[5] = pose.zoom;
+		}
+
+		CameraPose FromChannels(const float* channels)
+		{
+			CameraPose pose;
+			pose.position = glm::vec3(channels[0], channels[1], channels[2]);
+			pose.yaw = channels[3];
+			pose.pitch = channels[4];
+			pose.zoom = channels[5];
+
+			return pose;
+		}
+	}
+
+	void CameraPath::AddKeyframe(const double time, const CameraPose& pose)
+	{
+		if (!keyframes.empty() && time <= keyframes.back().time)
+			throw std::exception("Camera path keyframes must be added in increasing time.");
+
+		keyframes.push_back({ time, pose });
+	}
+
+	CameraPose CameraPath::Sample(const double time) const
+	{
+		if (keyframes.empty())
+			return CameraPose();
+
+		if (time <= keyframes.front().time)
+			return keyframes.front().pose;
+		if (time >= keyframes.back().time)
+			return keyframes.back().pose;
+
+		const auto next = std::upper_bound(keyframes.begin(), keyframes.end(), time,
+			[](const double value, const CameraKeyframe& keyframe) { return value < keyframe.time; });
+
+		const auto i1 = static_cast<size_t>(next - keyframes.begin());
+		const auto i0 = i1 - 1;
+		const auto iBefore = i0 == 0 ? i0 : i0 - 1;
+		const auto iAfter = i1 + 1 < keyframes.size() ? i1 + 1 : i1;
+
+		const auto t0 = keyframes[i0].time;
+		const auto t1 = keyframes[i1].time;
+		const auto duration = t1 - t0;
+		const auto s = (time - t0) / duration;
+
+		// Cubic Hermite with finite-difference tangents; unlike uniform Catmull-Rom
+		// this stays smooth when keyframes are unevenly spaced in time.
+		const auto h00 = 2.0 * s * s * s - 3.0 * s * s + 1.0;
+		const auto h10 = s * s * s - 2.0 * s * s + s;
+		const auto h01 = -2.0 * s * s * s + 3.0 * s * s;
+		const auto h11 = s * s * s - s * s;
+
+		float before[CHANNEL_COUNT], from[CHANNEL_COUNT], to[CHANNEL_COUNT], after[CHANNEL_COUNT], result[CHANNEL_COUNT];
+
+		ToChannels(keyframes[iBefore].pose, before);
+		ToChannels(keyframes[i0].pose, from);
+		ToChannels(keyframes[i1].pose, to);
+		ToChannels(keyframes[iAfter].pose, after);
+
+		const auto fromSpan = keyframes[i1].time - keyframes[iBefore].time;
+		const auto toSpan = keyframes[iAfter].time - keyframes[i0].time;
+
+		for (int channel = 0; channel < CHANNEL_COUNT; ++channel)
+		{
+			const auto fromTangent = (to[channel] - before[channel]) / fromSpan * duration;
+			const auto toTangent = (after[channel] - from[channel]) / toSpan * duration;
+
+			result[channel] = static_cast<float>(
+				h00 * from[channel] + h10 * fromTangent + h01 * to[channel] + h11 * toTangent);
+		}
+
+		return FromChannels(result);
+	}
+
+	double CameraPath::GetStartTime() const
+	{
+		return keyframes.empty() ? 0.0 : keyframes.front().time;
+	}
+
+	double CameraPath::GetEndTime() const
+	{
+		return keyframes.empty() ? 0.0 : keyframes.back().time;
+	}
+
+	CameraPath CameraPath::Load(const std::string& filePath)
+	{
+		std::ifstream stream(filePath);
+
+		if (!stream)
+		{
+			const auto errorMessage = "Failed to open camera path: " + filePath;
+			throw std::exception(errorMessage.c_str());
+		}
+
+		CameraPath path;
+		std::string line;
+		int lineNumber = 0;
+
+		while (std::getline(stream, line))
+		{
+			++lineNumber;
+
+			const auto first = line.find_first_not_of(" \t\r");
+
+			if (first == std::string::npos || line[first] == '#')
+				continue;
+
+			std::istringstream lineStream(line);
+
+			double time = 0.0;
+			float channels[CHANNEL_COUNT];
+
+			lineStream >> time;
+
+			for (auto& channel : channels)
+				lineStream >> channel;
+
+			if (lineStream.fail() || (!path.IsEmpty() && time <= path.GetEndTime()))
+			{
+				const auto errorMessage = "Invalid camera path " + filePath + " at line " + std::to_string(lineNumber) +
+					": expected increasing 'time x y z yaw pitch zoom'";
+				throw std::exception(errorMessage.c_str());
+			}
+
+			path.AddKeyframe(time, FromChannels(channels));
+		}
+
+		return path;
+	}
+
+	void CameraPath::Save(const std::string& filePath) const
+	{
+		std::ofstream stream(filePath);
+
+		if (!stream)
+		{
+			const auto errorMessage = "Failed to open camera path for writing: " + filePath;
+			throw std::exception(errorMessage.c_str());
+		}
+
+		stream << "# time x y z yaw pitch zoom" << std::endl;
+		stream << std::setprecision(9);
+
+		for (const auto& [time, pose] : keyframes)
+		{
+			stream << time << ' ' <<
+				pose.position.x << ' ' << pose.position.y << ' ' << pose.position.z << ' ' <<
+				pose.yaw << ' ' << pose.pitch << ' ' << pose.zoom << '\n';
+		}
+
+		if (stream.fail())
+		{
+			const auto errorMessage = "Failed to write camera path: " + filePath;
+			throw std::exception(errorMessage.c_str());
+		}
+	}
+
+	CameraPathRecorder::CameraPathRecorder(const double interval)
+		: interval(interval)
+	{
+		if (interval <= 0.0)
+			throw std::exception("Camera path recording interval must be positive.");
+	}
+
+	void CameraPathRecorder::Record(const double time, const CameraPose& pose)
+	{
+		if (!path.IsEmpty() && time < nextTime)
+			return;
+
+		if (!path.IsEmpty() && time <= path.GetEndTime())
+			return;
+
+		path.AddKeyframe(time, pose);
+		nextTime = time + interval;
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Utils
+{
+	// Angles in degrees, as Camera3D uses them.
+	struct CameraPose
+	{
+		glm::vec3 position = glm::vec3(0.0f);
+		float yaw = -90.0f;
+		float pitch = 0.0f;
+		float zoom = 45.0f;
+	};
+
+	struct CameraKeyframe
+	{
+		double time = 0.0;
+		CameraPose pose;
+	};
+
+	// Keyframed camera motion over time, blended with a Catmull-Rom style cubic
+	// that passes through every keyframe. Saved as text, one keyframe per line:
+	// time x y z yaw pitch zoom. Lines starting with # are comments.
+	class CameraPath
+	{
+		private:
+			std::vector<CameraKeyframe> keyframes;
+		public:
+			// Keyframes must be added in strictly increasing time.
+			void AddKeyframe(double time, const CameraPose& pose);
+			void Clear() { keyframes.clear(); }
+
+			// Times outside the path hold the first or last pose.
+			[[nodiscard]] CameraPose Sample(double time) const;
+
+			[[nodiscard]] bool IsEmpty() const { return keyframes.empty(); }
+			[[nodiscard]] size_t GetKeyframeCount() const { return keyframes.size(); }
+			[[nodiscard]] const std::vector<CameraKeyframe>& GetKeyframes() const { return keyframes; }
+			[[nodiscard]] double GetStartTime() const;
+			[[nodiscard]] double GetEndTime() const;
+
+			[[nodiscard]] static CameraPath Load(const std::string& filePath);
+			void Save(const std::string& filePath) const;
+	};
+
+	// Samples a live camera into a path, keeping at most one pose per interval.
+	class CameraPathRecorder
+	{
+		private:
+			CameraPath path;
+			double interval;
+			double nextTime = 0.0;
+		public:
+			explicit CameraPathRecorder(double interval = 0.1);
+
+			void Record(double time, const CameraPose& pose);
+
+			[[nodiscard]] const CameraPath& GetPath() const { return path; }
+	};
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+
+namespace Utils
+{
+	// Results produced on worker threads, consumed by the thread owning the GL context.
+	template <typename T>
+	class CompletionQueue
+	{
+		private:
+			mutable std::mutex mutex;
+			std::deque<T> items;
+		public:
+			void Push(T item)
+			{
+				std::lock_guard lock(mutex);
+				items.push_back(std::move(item));
+			}
+
+			bool TryPop(T& item)
+			{
+				std::lock_guard lock(mutex);
+
+				if (items.empty())
+					return false;
+
+				item = std::move(items.front());
+				items.pop_front();
+
+				return true;
+			}
+
+			[[nodiscard]] size_t GetSize() const
+			{
+				std::lock_guard lock(mutex);
+				return items.size();
+			}
+	};
+}
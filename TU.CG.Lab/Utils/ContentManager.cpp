@@ -1,5 +1,7 @@
 #include "ContentManager.hpp"
 
+#include <iostream>
+
 #include "Graphics/ModelLoader.hpp"
 
 namespace Utils
@@ -14,23 +16,85 @@ namespace Utils
 		textureCache.DeleteTexture(texture);
 	}
 
-	std::unique_ptr<Graphics::Model> ContentManager::GetModel(const std::string& filePath)
+	Graphics::TextureArray ContentManager::GetTextureArray(
+		const std::string& name, const std::vector<std::string>& filePaths)
+	{
+		return textureCache.GetTextureArray(name, filePaths);
+	}
+
+	void ContentManager::SetJobSystem(JobSystem* jobSystem)
+	{
+		textureCache.SetJobSystem(jobSystem);
+	}
+
+	void ContentManager::SetTextureBakeDirectory(const std::string& directory)
+	{
+		textureCache.SetBakeDirectory(directory);
+	}
+
+	void ContentManager::UploadPendingTextures(const double budgetMilliseconds)
+	{
+		textureCache.UploadPendingTextures(budgetMilliseconds);
+	}
+
+	void ContentManager::FinishPendingTextures()
+	{
+		textureCache.FinishPendingTextures();
+	}
+
+	std::shared_ptr<const Graphics::Model> ContentManager::GetModel(const std::string& filePath)
+	{
+		auto& cachedModel = modelMap[filePath];
+
+		if (auto model = cachedModel.lock())
+		{
+			std::cout <<
+				"Used cached model with file path = { " <<
+				filePath <<
+				" }" <<
+				std::endl;
+
+			return model;
+		}
+
+		std::shared_ptr<const Graphics::Model> model =
+			Graphics::ModelLoader::Load(filePath, textureCache, modelCacheDirectory);
+
+		cachedModel = model;
+
+		return model;
+	}
+
+	size_t ContentManager::GetLoadedModelCount() const
 	{
-		return Graphics::ModelLoader::Load(filePath, textureCache);
+		size_t count = 0;
+
+		for (const auto& [filePath, model] : modelMap)
+		{
+			if (!model.expired())
+				++count;
+		}
+
+		return count;
 	}
 
-	std::unique_ptr<Graphics::ShaderProgram> ContentManager::GetShader(
+	std::shared_ptr<Graphics::ShaderProgram> ContentManager::GetShader(
 		const std::string& vertexShaderPath,
-		const std::string& fragmentShaderPath) const
+		const std::string& fragmentShaderPath)
 	{
-		// TODO: Possible optimization: shader cache
+		return shaderCache.GetProgram(vertexShaderPath, fragmentShaderPath);
+	}
 
-		return std::make_unique<Graphics::ShaderProgram>(
-			vertexShaderPath, fragmentShaderPath);
+	void ContentManager::SetShaderBinaryDirectory(const std::string& directory)
+	{
+		shaderCache.SetBinaryDirectory(directory);
 	}
 
 	void ContentManager::Clear()
 	{
+		// Models still held keep their buffers; only their textures go with the cache.
+		modelMap.clear();
+		shaderCache.Clear();
 		textureCache.Clear();
 	}
 }
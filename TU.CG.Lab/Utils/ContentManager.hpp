@@ -1,11 +1,17 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "Graphics/Model.hpp"
+#include "Graphics/ShaderCache.hpp"
 #include "Graphics/ShaderProgram.hpp"
 #include "Graphics/Texture.hpp"
+#include "Graphics/TextureArray.hpp"
 #include "Graphics/TextureCache.hpp"
+#include "JobSystem.hpp"
 
 namespace Utils
 {
@@ -13,15 +19,40 @@ namespace Utils
 	{
 		private:
 			Graphics::TextureCache textureCache;
+			Graphics::ShaderCache shaderCache;
+			// Empty to import models with Assimp on every load.
+			std::string modelCacheDirectory;
+			// Weak, so a model is freed with its last user and loaded again on the next request.
+			std::unordered_map<std::string, std::weak_ptr<const Graphics::Model>> modelMap;
 		public:
 			Graphics::Texture GetTexture(const std::string& filePath);
 			void DeleteTexture(Graphics::Texture& texture);
 
-			std::unique_ptr<Graphics::Model> GetModel(const std::string& filePath);
+			Graphics::TextureArray GetTextureArray(
+				const std::string& name, const std::vector<std::string>& filePaths);
 
-			[[nodiscard]] std::unique_ptr<Graphics::ShaderProgram> GetShader(
+			// Textures decode on the job system's workers once one is set; the
+			// uploads happen in these two calls on the GL thread.
+			void SetJobSystem(JobSystem* jobSystem);
+			void SetTextureBakeDirectory(const std::string& directory);
+			void UploadPendingTextures(double budgetMilliseconds);
+			void FinishPendingTextures();
+
+			[[nodiscard]] const Graphics::TextureCache& GetTextureCache() const { return textureCache; }
+
+			// Every caller asking for the same path shares one model, its buffers and its textures.
+			std::shared_ptr<const Graphics::Model> GetModel(const std::string& filePath);
+			void SetModelCacheDirectory(const std::string& directory) { modelCacheDirectory = directory; }
+			// Models still held by someone.
+			[[nodiscard]] size_t GetLoadedModelCount() const;
+
+			// Callers asking for the same pair of unchanged sources share one program.
+			std::shared_ptr<Graphics::ShaderProgram> GetShader(
 				const std::string& vertexShaderPath,
-				const std::string& fragmentShaderPath) const;
+				const std::string& fragmentShaderPath);
+			void SetShaderBinaryDirectory(const std::string& directory);
+
+			[[nodiscard]] const Graphics::ShaderCache& GetShaderCache() const { return shaderCache; }
 
 			void Clear();
 	};
@@ -0,0 +1,42 @@
+#include "FixedTimestep.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+
+namespace Utils
+{
+	FixedTimestep::FixedTimestep(const double ticksPerSecond, const int maxTicksPerFrame)
+		: tickNanoseconds(0), maxTicksPerFrame(maxTicksPerFrame)
+	{
+		if (ticksPerSecond <= 0.0)
+			throw std::exception("Tick rate must be positive.");
+		if (maxTicksPerFrame <= 0)
+			throw std::exception("Max ticks per frame must be positive.");
+
+		tickNanoseconds = std::max<std::int64_t>(std::llround(1e9 / ticksPerSecond), 1);
+	}
+
+	int FixedTimestep::Advance(const double frameSeconds)
+	{
+		accumulatorNanoseconds += std::max<std::int64_t>(std::llround(frameSeconds * 1e9), 0);
+
+		auto ticks = accumulatorNanoseconds / tickNanoseconds;
+		accumulatorNanoseconds -= ticks * tickNanoseconds;
+
+		if (ticks > maxTicksPerFrame)
+		{
+			droppedTicks += ticks - maxTicksPerFrame;
+			ticks = maxTicksPerFrame;
+		}
+
+		tickCount += ticks;
+
+		return static_cast<int>(ticks);
+	}
+
+	float FixedTimestep::GetAlpha() const
+	{
+		return static_cast<float>(static_cast<double>(accumulatorNanoseconds) / static_cast<double>(tickNanoseconds));
+	}
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Utils
+{
+	// Turns variable frame times into a whole number of fixed simulation ticks.
+	// Time is kept in integer nanoseconds, so it does not drift over long sessions.
+	class FixedTimestep
+	{
+		private:
+			std::int64_t tickNanoseconds;
+			std::int64_t accumulatorNanoseconds = 0;
+			std::uint64_t tickCount = 0;
+			int maxTicksPerFrame;
+			std::uint64_t droppedTicks = 0;
+		public:
+			explicit FixedTimestep(double ticksPerSecond, int maxTicksPerFrame = 8);
+
+			// Adds the frame's time and returns how many ticks to simulate. Time past
+			// maxTicksPerFrame is dropped, so a long hitch does not snowball.
+			int Advance(double frameSeconds);
+
+			// How far the simulation has got into the next tick, from 0 to 1; used to
+			// blend the previous and current state when rendering.
+			[[nodiscard]] float GetAlpha() const;
+
+			[[nodiscard]] double GetTickSeconds() const { return static_cast<double>(tickNanoseconds) * 1e-9; }
+			[[nodiscard]] double GetSimulationTime() const { return static_cast<double>(tickCount * tickNanoseconds) * 1e-9; }
+			[[nodiscard]] std::uint64_t GetTickCount() const { return tickCount; }
+			[[nodiscard]] std::uint64_t GetDroppedTicks() const { return droppedTicks; }
+	};
+}
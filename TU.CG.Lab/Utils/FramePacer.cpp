@@ -0,0 +1,56 @@
+#include "FramePacer.hpp"
+
+#include <thread>
+
+namespace Utils
+{
+	FramePacer::FramePacer()
+#ifdef _WIN32
+		// Windows sleeps round up to the timer resolution, often 15.6 ms.
+		: spinThreshold(std::chrono::milliseconds(2)), nextFrame(Clock::now())
+#else
+		: spinThreshold(std::chrono::microseconds(500)), nextFrame(Clock::now())
+#endif
+	{
+	}
+
+	void FramePacer::SetTargetFrameRate(const double framesPerSecond)
+	{
+		if (framesPerSecond <= 0.0)
+			framePeriod = Clock::duration::zero();
+		else
+			framePeriod = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / framesPerSecond));
+
+		nextFrame = Clock::now() + framePeriod;
+	}
+
+	void FramePacer::Wait()
+	{
+		if (!IsCapped())
+			return;
+
+		auto now = Clock::now();
+
+		if (nextFrame - now > spinThreshold)
+			std::this_thread::sleep_for(nextFrame - now - spinThreshold);
+
+		while ((now = Clock::now()) < nextFrame)
+			std::this_thread::yield();
+
+		// Deadlines advance by whole periods so the rate holds on average; after a
+		// frame that ran more than a period late, restart from now instead of
+		// rushing to catch up.
+		nextFrame += framePeriod;
+
+		if (nextFrame < now)
+			nextFrame = now + framePeriod;
+	}
+
+	double FramePacer::GetTargetFrameRate() const
+	{
+		if (!IsCapped())
+			return 0.0;
+
+		return 1.0 / std::chrono::duration<double>(framePeriod).count();
+	}
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+
+namespace Utils
+{
+	// Holds frames to a target rate. Most of the wait is slept; the last stretch
+	// is spun, since sleeps can overshoot by a scheduler quantum.
+	class FramePacer
+	{
+		private:
+			using Clock = std::chrono::steady_clock;
+
+			Clock::duration framePeriod = Clock::duration::zero();
+			Clock::duration spinThreshold;
+			Clock::time_point nextFrame;
+		public:
+			FramePacer();
+
+			// 0 or less removes the cap.
+			void SetTargetFrameRate(double framesPerSecond);
+			void SetSpinThreshold(const Clock::duration threshold) { spinThreshold = threshold; }
+
+			// Blocks until the current frame's period is over.
+			void Wait();
+
+			[[nodiscard]] bool IsCapped() const { return framePeriod > Clock::duration::zero(); }
+			[[nodiscard]] double GetTargetFrameRate() const;
+	};
+}
@@ -0,0 +1,130 @@
+#include "Frustum.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define FRUSTUM_USE_SSE 1
+#endif
+
+namespace Utils
+{
+	void BoundingBoxList::Add(const BoundingBox& box)
+	{
+		minX.push_back(box.min.x);
+		minY.push_back(box.min.y);
+		minZ.push_back(box.min.z);
+		maxX.push_back(box.max.x);
+		maxY.push_back(box.max.y);
+		maxZ.push_back(box.max.z);
+	}
+
+	void BoundingBoxList::Clear()
+	{
+		for (auto* coordinates : { &minX, &minY, &minZ, &maxX, &maxY, &maxZ })
+			coordinates->clear();
+	}
+
+	void BoundingBoxList::Reserve(const size_t count)
+	{
+		for (auto* coordinates : { &minX, &minY, &minZ, &maxX, &maxY, &maxZ })
+			coordinates->reserve(count);
+	}
+
+	BoundingBox BoundingBoxList::Get(const size_t index) const
+	{
+		return {
+			glm::vec3(minX[index], minY[index], minZ[index]),
+			glm::vec3(maxX[index], maxY[index], maxZ[index])
+		};
+	}
+
+	Frustum::Frustum(const glm::mat4& viewProjection)
+	{
+		// Gribb-Hartmann: each plane is the last row plus or minus another row.
+		const auto row = [&viewProjection](const int i)
+		{
+			return glm::vec4(
+				viewProjection[0][i], viewProjection[1][i],
+				viewProjection[2][i], viewProjection[3][i]);
+		};
+
+		planes[0] = row(3) + row(0);
+		planes[1] = row(3) - row(0);
+		planes[2] = row(3) + row(1);
+		planes[3] = row(3) - row(1);
+		planes[4] = row(3) + row(2);
+		planes[5] = row(3) - row(2);
+
+		for (auto& plane : planes)
+			plane /= glm::length(glm::vec3(plane));
+	}
+
+	bool Frustum::Intersects(const BoundingBox& box) const
+	{
+		for (const auto& plane : planes)
+		{
+			// The corner furthest along the plane normal.
+			const glm::vec3 positive(
+				plane.x >= 0.0f ? box.max.x : box.min.x,
+				plane.y >= 0.0f ? box.max.y : box.min.y,
+				plane.z >= 0.0f ? box.max.z : box.min.z);
+
+			if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f)
+				return false;
+		}
+
+		return true;
+	}
+
+	size_t Frustum::CullBatch(const BoundingBoxList& boxes, std::vector<unsigned char>& visible) const
+	{
+		const auto count = boxes.GetSize();
+		visible.resize(count);
+
+		size_t visibleCount = 0;
+		size_t i = 0;
+
+#ifdef FRUSTUM_USE_SSE
+		// Four boxes per iteration. The corner selection depends only on the
+		// plane, so it picks whole min or max arrays instead of per-lane blends.
+		for (; i + 4 <= count; i += 4)
+		{
+			auto inside = _mm_cmpeq_ps(_mm_setzero_ps(), _mm_setzero_ps());
+
+			for (const auto& plane : planes)
+			{
+				const auto x = _mm_loadu_ps((plane.x >= 0.0f ? boxes.maxX : boxes.minX).data() + i);
+				const auto y = _mm_loadu_ps((plane.y >= 0.0f ? boxes.maxY : boxes.minY).data() + i);
+				const auto z = _mm_loadu_ps((plane.z >= 0.0f ? boxes.maxZ : boxes.minZ).data() + i);
+
+				auto distance = _mm_add_ps(
+					_mm_mul_ps(x, _mm_set1_ps(plane.x)), _mm_mul_ps(y, _mm_set1_ps(plane.y)));
+
+				distance = _mm_add_ps(distance, _mm_mul_ps(z, _mm_set1_ps(plane.z)));
+				distance = _mm_add_ps(distance, _mm_set1_ps(plane.w));
+
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+			}
+
+			const auto mask = _mm_movemask_ps(inside);
+
+			for (int lane = 0; lane < 4; ++lane)
+			{
+				const auto isVisible = static_cast<unsigned char>((mask >> lane) & 1);
+
+				visible[i + lane] = isVisible;
+				visibleCount += isVisible;
+			}
+		}
+#endif
+
+		for (; i < count; ++i)
+		{
+			const auto isVisible = static_cast<unsigned char>(Intersects(boxes.Get(i)));
+
+			visible[i] = isVisible;
+			visibleCount += isVisible;
+		}
+
+		return visibleCount;
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "BoundingBox.hpp"
+
+namespace Utils
+{
+	// Boxes stored as separate coordinate arrays, so Frustum::CullBatch can
+	// test several of them per instruction.
+	class BoundingBoxList
+	{
+		private:
+			std::vector<float> minX, minY, minZ;
+			std::vector<float> maxX, maxY, maxZ;
+
+			friend class Frustum;
+		public:
+			void Add(const BoundingBox& box);
+			void Clear();
+			void Reserve(size_t count);
+
+			[[nodiscard]] size_t GetSize() const { return minX.size(); }
+			[[nodiscard]] BoundingBox Get(size_t index) const;
+	};
+
+	class Frustum
+	{
+		private:
+			// Normalised planes (normal, distance) with normals pointing inwards.
+			std::array<glm::vec4, 6> planes;
+		public:
+			// Extracts the planes of projection * view.
+			explicit Frustum(const glm::mat4& viewProjection);
+
+			// False only when the box lies entirely outside one of the planes;
+			// boxes straddling a corner may pass.
+			[[nodiscard]] bool Intersects(const BoundingBox& box) const;
+
+			// Writes 1 or 0 per box into visible and returns the number of
+			// visible boxes. Same result as Intersects for every box.
+			size_t CullBatch(const BoundingBoxList& boxes, std::vector<unsigned char>& visible) const;
+
+			[[nodiscard]] const std::array<glm::vec4, 6>& GetPlanes() const { return planes; }
+	};
+}
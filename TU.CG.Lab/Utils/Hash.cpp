@@ -0,0 +1,39 @@
+#include "Hash.hpp"
+
+#include <cstring>
+
+namespace Utils
+{
+	std::uint64_t HashBytes(const std::byte* data, const size_t size)
+	{
+		constexpr std::uint64_t prime = 0x100000001b3;
+
+		std::uint64_t hash = 0xcbf29ce484222325 ^ size;
+		size_t i = 0;
+
+		for (; i + 8 <= size; i += 8)
+		{
+			std::uint64_t word;
+			std::memcpy(&word, data + i, 8);
+
+			hash = (hash ^ word) * prime;
+		}
+
+		for (; i < size; ++i)
+			hash = (hash ^ static_cast<std::uint64_t>(data[i])) * prime;
+
+		return hash;
+	}
+
+	std::string ToHexString(const std::uint64_t value)
+	{
+		constexpr char digits[] = "0123456789abcdef";
+
+		std::string text;
+
+		for (int shift = 60; shift >= 0; shift -= 4)
+			text.push_back(digits[value >> shift & 15]);
+
+		return text;
+	}
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Utils
+{
+	// FNV-1a over 8-byte words; fast enough to key caches by file contents.
+	[[nodiscard]] std::uint64_t HashBytes(const std::byte* data, size_t size);
+	// Sixteen lowercase hex digits, for naming cache files.
+	[[nodiscard]] std::string ToHexString(std::uint64_t value);
+}
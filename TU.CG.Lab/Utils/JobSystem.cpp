@@ -0,0 +1,151 @@
+#include "JobSystem.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace Utils
+{
+	namespace
+	{
+		thread_local const JobSystem* currentJobSystem = nullptr;
+		thread_local unsigned currentWorkerIndex = 0;
+	}
+
+	JobSystem::JobSystem(unsigned threadCount)
+	{
+		if (threadCount == 0)
+			threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+		workers.reserve(threadCount);
+		threads.reserve(threadCount);
+
+		for (unsigned i = 0; i < threadCount; ++i)
+			workers.push_back(std::make_unique<Worker>());
+
+		for (unsigned i = 0; i < threadCount; ++i)
+			threads.emplace_back(&JobSystem::WorkerLoop, this, i);
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard lock(sleepMutex);
+			isStopping = true;
+		}
+
+		wakeCondition.notify_all();
+
+		for (auto& thread : threads)
+			thread.join();
+	}
+
+	void JobSystem::Submit(std::function<void()> job)
+	{
+		// Jobs spawned by a worker stay on its own deque for locality.
+		const auto index = currentJobSystem == this
+			? currentWorkerIndex
+			: nextWorker++ % static_cast<unsigned>(workers.size());
+
+		++pendingJobs;
+
+		// Counted before the push so a concurrent pop can never drive it below zero.
+		{
+			std::lock_guard lock(sleepMutex);
+			++queuedJobs;
+		}
+
+		{
+			auto& worker = *workers[index];
+			std::lock_guard lock(worker.mutex);
+			worker.jobs.push_back(std::move(job));
+		}
+
+		wakeCondition.notify_one();
+	}
+
+	void JobSystem::WaitIdle()
+	{
+		std::unique_lock lock(sleepMutex);
+		idleCondition.wait(lock, [this] { return pendingJobs == 0; });
+	}
+
+	void JobSystem::WorkerLoop(const unsigned index)
+	{
+		currentJobSystem = this;
+		currentWorkerIndex = index;
+
+		std::function<void()> job;
+
+		while (true)
+		{
+			if (TryPop(index, job) || TrySteal(index, job))
+			{
+				RunJob(job);
+				job = nullptr;
+
+				if (--pendingJobs == 0)
+				{
+					std::lock_guard lock(sleepMutex);
+					idleCondition.notify_all();
+				}
+
+				continue;
+			}
+
+			std::unique_lock lock(sleepMutex);
+			wakeCondition.wait(lock, [this] { return isStopping || queuedJobs > 0; });
+
+			if (isStopping && queuedJobs == 0)
+				return;
+		}
+	}
+
+	bool JobSystem::TryPop(const unsigned index, std::function<void()>& job)
+	{
+		auto& worker = *workers[index];
+		std::lock_guard lock(worker.mutex);
+
+		if (worker.jobs.empty())
+			return false;
+
+		job = std::move(worker.jobs.back());
+		worker.jobs.pop_back();
+		--queuedJobs;
+
+		return true;
+	}
+
+	bool JobSystem::TrySteal(const unsigned thief, std::function<void()>& job)
+	{
+		const auto workerCount = static_cast<unsigned>(workers.size());
+
+		for (unsigned offset = 1; offset < workerCount; ++offset)
+		{
+			auto& victim = *workers[(thief + offset) % workerCount];
+			std::unique_lock lock(victim.mutex, std::try_to_lock);
+
+			if (!lock.owns_lock() || victim.jobs.empty())
+				continue;
+
+			job = std::move(victim.jobs.front());
+			victim.jobs.pop_front();
+			--queuedJobs;
+
+			return true;
+		}
+
+		return false;
+	}
+
+	void JobSystem::RunJob(const std::function<void()>& job)
+	{
+		try
+		{
+			job();
+		}
+		catch (std::exception& ex)
+		{
+			std::cout << "Job failed: " << ex.what() << std::endl;
+		}
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Utils
+{
+	// Fixed pool of workers, each with its own deque. Workers pop their own
+	// newest job and steal the oldest job from others when they run dry.
+	class JobSystem
+	{
+		private:
+			struct Worker
+			{
+				std::deque<std::function<void()>> jobs;
+				std::mutex mutex;
+			};
+
+			std::vector<std::unique_ptr<Worker>> workers;
+			std::vector<std::thread> threads;
+
+			std::mutex sleepMutex;
+			std::condition_variable wakeCondition;
+			std::condition_variable idleCondition;
+
+			std::atomic<size_t> queuedJobs = 0;
+			std::atomic<size_t> pendingJobs = 0;
+			std::atomic<unsigned> nextWorker = 0;
+			bool isStopping = false;
+
+			void WorkerLoop(unsigned index);
+			bool TryPop(unsigned index, std::function<void()>& job);
+			bool TrySteal(unsigned thief, std::function<void()>& job);
+			void RunJob(const std::function<void()>& job);
+		public:
+			// A thread count of 0 uses one worker per hardware thread.
+			explicit JobSystem(unsigned threadCount = 0);
+			JobSystem(const JobSystem& other) = delete;
+			JobSystem& operator=(const JobSystem& other) = delete;
+			JobSystem(JobSystem&& other) = delete;
+			JobSystem& operator=(JobSystem&& other) = delete;
+			~JobSystem();
+
+			void Submit(std::function<void()> job);
+			void WaitIdle();
+
+			[[nodiscard]] unsigned GetThreadCount() const { return static_cast<unsigned>(threads.size()); }
+			[[nodiscard]] size_t GetPendingJobCount() const { return pendingJobs; }
+	};
+}
@@ -0,0 +1,65 @@
+#include "Json.hpp"
+
+#include <iomanip>
+
+namespace Utils
+{
+	void WriteJsonString(std::ostream& stream, const std::string_view text)
+	{
+		stream << '"';
+
+		for (const auto character : text)
+		{
+			switch (character)
+			{
+				case '"':
+				{
+					stream << "\\\"";
+					break;
+				}
+				case '\\':
+				{
+					stream << "\\\\";
+					break;
+				}
+				case '\n':
+				{
+					stream << "\\n";
+					break;
+				}
+				case '\r':
+				{
+					stream << "\\r";
+					break;
+				}
+				case '\t':
+				{
+					stream << "\\t";
+					break;
+				}
+				default:
+				{
+					if (static_cast<unsigned char>(character) < 0x20)
+					{
+						const auto flags = stream.flags();
+						const auto fill = stream.fill();
+
+						stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') <<
+							static_cast<int>(character);
+
+						stream.flags(flags);
+						stream.fill(fill);
+					}
+					else
+					{
+						stream << character;
+					}
+
+					break;
+				}
+			}
+		}
+
+		stream << '"';
+	}
+}
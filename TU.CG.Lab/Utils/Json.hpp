@@ -0,0 +1,11 @@
+#pragma once
+
+#include <ostream>
+#include <string_view>
+
+namespace Utils
+{
+	// Writes text as a quoted JSON string, escaping quotes, backslashes (as in
+	// Windows paths) and control characters.
+	void WriteJsonString(std::ostream& stream, std::string_view text);
+}
@@ -0,0 +1,149 @@
+#include "MappedFile.hpp"
+
+#include <exception>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Utils
+{
+	MappedFile::MappedFile(const std::string& filePath)
+	{
+		const auto errorMessage = "Failed to map file: " + filePath;
+
+#ifdef _WIN32
+		fileHandle = CreateFileA(
+			filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			fileHandle = nullptr;
+			throw std::exception(errorMessage.c_str());
+		}
+
+		LARGE_INTEGER fileSize;
+
+		if (!GetFileSizeEx(fileHandle, &fileSize))
+		{
+			Delete();
+			throw std::exception(errorMessage.c_str());
+		}
+
+		size = static_cast<size_t>(fileSize.QuadPart);
+
+		// Empty files cannot be mapped; they are exposed as a null range.
+		if (size == 0)
+			return;
+
+		mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (mappingHandle == nullptr)
+		{
+			Delete();
+			throw std::exception(errorMessage.c_str());
+		}
+
+		data = static_cast<const std::byte*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+#else
+		const auto descriptor = open(filePath.c_str(), O_RDONLY);
+
+		if (descriptor < 0)
+			throw std::exception(errorMessage.c_str());
+
+		struct stat status {};
+
+		if (fstat(descriptor, &status) != 0)
+		{
+			close(descriptor);
+			throw std::exception(errorMessage.c_str());
+		}
+
+		size = static_cast<size_t>(status.st_size);
+
+		if (size == 0)
+		{
+			close(descriptor);
+			return;
+		}
+
+		auto* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+		// The mapping keeps its own reference to the file.
+		close(descriptor);
+
+		if (mapping != MAP_FAILED)
+			data = static_cast<const std::byte*>(mapping);
+#endif
+
+		if (data == nullptr)
+		{
+			Delete();
+			throw std::exception(errorMessage.c_str());
+		}
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+		: data(std::exchange(other.data, nullptr)), size(std::exchange(other.size, 0))
+#ifdef _WIN32
+		, fileHandle(std::exchange(other.fileHandle, nullptr)),
+		mappingHandle(std::exchange(other.mappingHandle, nullptr))
+#endif
+	{
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Delete();
+
+			data = std::exchange(other.data, nullptr);
+			size = std::exchange(other.size, 0);
+
+#ifdef _WIN32
+			fileHandle = std::exchange(other.fileHandle, nullptr);
+			mappingHandle = std::exchange(other.mappingHandle, nullptr);
+#endif
+		}
+
+		return *this;
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Delete();
+	}
+
+	void MappedFile::Delete()
+	{
+#ifdef _WIN32
+		if (data != nullptr)
+			UnmapViewOfFile(data);
+
+		if (mappingHandle != nullptr)
+			CloseHandle(mappingHandle);
+
+		if (fileHandle != nullptr)
+			CloseHandle(fileHandle);
+
+		mappingHandle = nullptr;
+		fileHandle = nullptr;
+#else
+		if (data != nullptr)
+			munmap(const_cast<std::byte*>(data), size);
+#endif
+
+		data = nullptr;
+		size = 0;
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace Utils
+{
+	// Read-only memory mapping of a whole file.
+	class MappedFile
+	{
+		private:
+			const std::byte* data = nullptr;
+			size_t size = 0;
+
+#ifdef _WIN32
+			void* fileHandle = nullptr;
+			void* mappingHandle = nullptr;
+#endif
+
+			void Delete();
+		public:
+			explicit MappedFile(const std::string& filePath);
+			MappedFile(const MappedFile& other) = delete;
+			MappedFile& operator=(const MappedFile& other) = delete;
+			MappedFile(MappedFile&& other) noexcept;
+			MappedFile& operator=(MappedFile&& other) noexcept;
+			~MappedFile();
+
+			[[nodiscard]] const std::byte* GetData() const { return data; }
+			[[nodiscard]] size_t GetSize() const { return size; }
+	};
+}
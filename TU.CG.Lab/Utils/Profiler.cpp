@@ -0,0 +1,202 @@
+#include "Profiler.hpp"
+
+#if PROFILER_ENABLED
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Json.hpp"
+
+namespace Utils
+{
+	namespace
+	{
+		struct ProfileEvent
+		{
+			const char* name;
+			std::int64_t start;
+			std::int64_t end;
+			std::uint64_t frame;
+		};
+
+		// Written by its own thread and read only when exporting, so the lock is
+		// almost never contended.
+		struct ThreadBuffer
+		{
+			std::mutex mutex;
+			std::vector<ProfileEvent> events;
+			size_t next = 0;
+			size_t count = 0;
+			unsigned threadId = 0;
+		};
+
+		struct ProfilerState
+		{
+			const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+			std::atomic<std::uint64_t> frameIndex = 0;
+
+			std::mutex mutex;
+			// Shared with the owning thread, so buffers outlive threads that exit.
+			std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+			bool captureRequested = false;
+			std::uint64_t captureFirstFrame = 0;
+			std::uint64_t captureFrameCount = 0;
+			std::string captureFilePath;
+		};
+
+		ProfilerState& GetState()
+		{
+			static ProfilerState state;
+			return state;
+		}
+
+		ThreadBuffer& GetThreadBuffer()
+		{
+			thread_local std::shared_ptr<ThreadBuffer> buffer;
+
+			if (buffer == nullptr)
+			{
+				auto& state = GetState();
+
+				buffer = std::make_shared<ThreadBuffer>();
+				buffer->events.resize(Profiler::EVENTS_PER_THREAD);
+
+				const std::scoped_lock lock(state.mutex);
+				buffer->threadId = static_cast<unsigned>(state.buffers.size());
+				state.buffers.push_back(buffer);
+			}
+
+			return *buffer;
+		}
+	}
+
+	void Profiler::BeginFrame()
+	{
+		auto& state = GetState();
+		const auto frame = ++state.frameIndex;
+
+		if (state.captureRequested && frame >= state.captureFirstFrame + state.captureFrameCount)
+		{
+			state.captureRequested = false;
+
+			const auto lastFrame = state.captureFirstFrame + state.captureFrameCount - 1;
+			const auto zoneCount = WriteChromeTrace(state.captureFilePath, state.captureFirstFrame, lastFrame);
+
+			std::cout << "Wrote " << zoneCount << " profiler zones for frames " << state.captureFirstFrame <<
+				"-" << lastFrame << " to " << state.captureFilePath << std::endl;
+		}
+	}
+
+	std::uint64_t Profiler::GetFrameIndex()
+	{
+		return GetState().frameIndex.load(std::memory_order_relaxed);
+	}
+
+	void Profiler::CaptureFrames(const std::uint64_t firstFrame, const std::uint64_t frameCount, const std::string& filePath)
+	{
+		if (frameCount == 0)
+			throw std::exception("Profiler capture needs at least one frame.");
+
+		auto& state = GetState();
+
+		state.captureRequested = true;
+		state.captureFirstFrame = firstFrame;
+		state.captureFrameCount = frameCount;
+		state.captureFilePath = filePath;
+	}
+
+	size_t Profiler::WriteChromeTrace(const std::string& filePath, const std::uint64_t firstFrame, const std::uint64_t lastFrame)
+	{
+		std::ofstream stream(filePath);
+
+		if (!stream)
+		{
+			const auto errorMessage = "Failed to open profiler trace for writing: " + filePath;
+			throw std::exception(errorMessage.c_str());
+		}
+
+		auto& state = GetState();
+
+		std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+		{
+			const std::scoped_lock lock(state.mutex);
+			buffers = state.buffers;
+		}
+
+		std::vector<ProfileEvent> events;
+		size_t zoneCount = 0;
+
+		stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+		stream << std::fixed << std::setprecision(3);
+
+		for (const auto& buffer : buffers)
+		{
+			{
+				const std::scoped_lock lock(buffer->mutex);
+
+				events.clear();
+
+				const auto capacity = buffer->events.size();
+				const auto oldest = (buffer->next + capacity - buffer->count) % capacity;
+
+				for (size_t i = 0; i < buffer->count; ++i)
+				{
+					const auto& event = buffer->events[(oldest + i) % capacity];
+
+					if (event.frame >= firstFrame && event.frame <= lastFrame)
+						events.push_back(event);
+				}
+			}
+
+			for (const auto& event : events)
+			{
+				stream << (zoneCount == 0 ? "\n" : ",\n") << "{\"name\":";
+				WriteJsonString(stream, event.name);
+				stream <<
+					",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId <<
+					",\"ts\":" << static_cast<double>(event.start) * 1e-3 <<
+					",\"dur\":" << static_cast<double>(event.end - event.start) * 1e-3 <<
+					",\"args\":{\"frame\":" << event.frame << "}}";
+
+				++zoneCount;
+			}
+		}
+
+		stream << "\n]}\n";
+
+		if (stream.fail())
+		{
+			const auto errorMessage = "Failed to write profiler trace: " + filePath;
+			throw std::exception(errorMessage.c_str());
+		}
+
+		return zoneCount;
+	}
+
+	std::int64_t Profiler::GetTimestamp()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - GetState().epoch).count();
+	}
+
+	void Profiler::Record(const char* name, const std::int64_t start, const std::int64_t end, const std::uint64_t frame)
+	{
+		auto& buffer = GetThreadBuffer();
+
+		const std::scoped_lock lock(buffer.mutex);
+
+		buffer.events[buffer.next] = { name, start, end, frame };
+		buffer.next = (buffer.next + 1) & (EVENTS_PER_THREAD - 1);
+		buffer.count = std::min(buffer.count + 1, EVENTS_PER_THREAD);
+	}
+}
+
+#endif
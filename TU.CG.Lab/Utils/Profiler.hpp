@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Set to 0 to compile every zone and the profiler itself out of the build.
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+namespace Utils
+{
+#if PROFILER_ENABLED
+	// Collects scoped CPU zones into a ring buffer per thread and writes them out
+	// as Chrome trace events (chrome://tracing, Perfetto). Timestamps are steady
+	// clock nanoseconds since the profiler started.
+	class Profiler
+	{
+		public:
+			// Zones recorded per thread before the oldest are overwritten; a power of two.
+			static constexpr size_t EVENTS_PER_THREAD = 1 << 16;
+
+			// Marks the start of a new frame; zones are tagged with the frame they start in.
+			static void BeginFrame();
+			[[nodiscard]] static std::uint64_t GetFrameIndex();
+
+			// Writes frames [firstFrame, firstFrame + frameCount) to filePath as soon
+			// as the last of them has ended.
+			static void CaptureFrames(std::uint64_t firstFrame, std::uint64_t frameCount, const std::string& filePath);
+
+			// Writes every zone still buffered from frames [firstFrame, lastFrame].
+			// Returns the number of zones written.
+			static size_t WriteChromeTrace(const std::string& filePath, std::uint64_t firstFrame, std::uint64_t lastFrame);
+
+			[[nodiscard]] static std::int64_t GetTimestamp();
+			static void Record(const char* name, std::int64_t start, std::int64_t end, std::uint64_t frame);
+	};
+
+	// Records the time from construction to destruction under a static name.
+	class ProfileZone
+	{
+		private:
+			const char* name;
+			std::int64_t start;
+			// Taken here, so a zone spanning BeginFrame still belongs to the frame it started in.
+			std::uint64_t frame;
+		public:
+			explicit ProfileZone(const char* name)
+				: name(name), start(Profiler::GetTimestamp()), frame(Profiler::GetFrameIndex()) {}
+			ProfileZone(const ProfileZone& other) = delete;
+			ProfileZone& operator=(const ProfileZone& other) = delete;
+			ProfileZone(ProfileZone&& other) = delete;
+			ProfileZone& operator=(ProfileZone&& other) = delete;
+			~ProfileZone() { Profiler::Record(name, start, Profiler::GetTimestamp(), frame); }
+	};
+#else
+	class Profiler
+	{
+		public:
+			static void BeginFrame() {}
+			[[nodiscard]] static std::uint64_t GetFrameIndex() { return 0; }
+			static void CaptureFrames(std::uint64_t, std::uint64_t, const std::string&) {}
+			static size_t WriteChromeTrace(const std::string&, std::uint64_t, std::uint64_t) { return 0; }
+	};
+#endif
+}
+
+#if PROFILER_ENABLED
+#define PROFILE_JOIN_INNER(a, b) a##b
+#define PROFILE_JOIN(a, b) PROFILE_JOIN_INNER(a, b)
+// Profiles the rest of the enclosing scope; name must outlive the program (a literal).
+#define PROFILE_ZONE(name) const Utils::ProfileZone PROFILE_JOIN(profileZone, __LINE__)(name)
+#else
+#define PROFILE_ZONE(name)
+#endif
@@ -0,0 +1,80 @@
+#include "RollingStatistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <numeric>
+
+namespace Utils
+{
+	RollingStatistics::RollingStatistics(const size_t capacity)
+		: samples(capacity, 0.0)
+	{
+		if (capacity == 0)
+			throw std::exception("Rolling statistics need room for at least one sample.");
+
+		sorted.reserve(capacity);
+	}
+
+	void RollingStatistics::Add(const double sample)
+	{
+		samples[next] = sample;
+		next = (next + 1) % samples.size();
+		count = std::min(count + 1, samples.size());
+		++totalCount;
+	}
+
+	void RollingStatistics::Clear()
+	{
+		next = 0;
+		count = 0;
+		totalCount = 0;
+	}
+
+	double RollingStatistics::GetLast() const
+	{
+		if (count == 0)
+			return 0.0;
+
+		return samples[(next + samples.size() - 1) % samples.size()];
+	}
+
+	double RollingStatistics::GetAverage() const
+	{
+		if (count == 0)
+			return 0.0;
+
+		return std::accumulate(samples.begin(), samples.begin() + count, 0.0) / static_cast<double>(count);
+	}
+
+	double RollingStatistics::GetMin() const
+	{
+		if (count == 0)
+			return 0.0;
+
+		return *std::min_element(samples.begin(), samples.begin() + count);
+	}
+
+	double RollingStatistics::GetMax() const
+	{
+		if (count == 0)
+			return 0.0;
+
+		return *std::max_element(samples.begin(), samples.begin() + count);
+	}
+
+	double RollingStatistics::GetPercentile(const double percentile) const
+	{
+		if (count == 0)
+			return 0.0;
+
+		sorted.assign(samples.begin(), samples.begin() + count);
+
+		const auto rank = static_cast<size_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * count));
+		const auto index = rank == 0 ? 0 : rank - 1;
+
+		std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+
+		return sorted[index];
+	}
+}
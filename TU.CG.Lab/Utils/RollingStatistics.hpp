@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Utils
+{
+	// Summary statistics over the most recent samples; older ones fall out of the window.
+	class RollingStatistics
+	{
+		private:
+			std::vector<double> samples;
+			size_t next = 0;
+			size_t count = 0;
+			size_t totalCount = 0;
+
+			// Reused by GetPercentile so queries do not allocate.
+			mutable std::vector<double> sorted;
+		public:
+			explicit RollingStatistics(size_t capacity);
+
+			void Add(double sample);
+			void Clear();
+
+			[[nodiscard]] double GetLast() const;
+			[[nodiscard]] double GetAverage() const;
+			[[nodiscard]] double GetMin() const;
+			[[nodiscard]] double GetMax() const;
+			// percentile runs from 0 to 100; nearest-rank over the current window.
+			[[nodiscard]] double GetPercentile(double percentile) const;
+
+			[[nodiscard]] size_t GetCount() const { return count; }
+			[[nodiscard]] size_t GetTotalCount() const { return totalCount; }
+			[[nodiscard]] size_t GetCapacity() const { return samples.size(); }
+	};
+}
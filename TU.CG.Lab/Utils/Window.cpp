@@ -7,7 +7,7 @@
 
 namespace Utils
 {
-	Window::Window(const char* title, const int width, const int height)
+	Window::Window(const char* title, const int width, const int height, const bool visible)
 	{
 		if (width <= 0)
 			throw std::exception("Screen width must be a positive integer.");
@@ -20,6 +20,7 @@ namespace Utils
 		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
 		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 		glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+		glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
 
 		window = glfwCreateWindow(width, height, "TU.CG.Lab", nullptr, nullptr);
 
@@ -38,6 +39,8 @@ namespace Utils
 		}
 
 		glViewport(0, 0, width, height);
+
+		SetVSyncMode(vSyncMode);
 	}
 
 	Window::~Window()
@@ -50,9 +53,55 @@ namespace Utils
 		glfwMakeContextCurrent(window);
 	}
 
-	void Window::SwapBuffers() const
+	void Window::SwapBuffers()
 	{
 		glfwSwapBuffers(window);
+
+		framePacer.Wait();
+
+		const auto now = std::chrono::steady_clock::now();
+
+		if (hasSwapped)
+			frameTimes.Add(std::chrono::duration<double, std::milli>(now - lastSwap).count());
+
+		lastSwap = now;
+		hasSwapped = true;
+	}
+
+	void Window::SetVSyncMode(VSyncMode mode)
+	{
+		if (mode == VSyncMode::ADAPTIVE &&
+			!glfwExtensionSupported("WGL_EXT_swap_control_tear") &&
+			!glfwExtensionSupported("GLX_EXT_swap_control_tear"))
+		{
+			mode = VSyncMode::ON;
+		}
+
+		switch (mode)
+		{
+			case VSyncMode::OFF:
+			{
+				glfwSwapInterval(0);
+				break;
+			}
+			case VSyncMode::ON:
+			{
+				glfwSwapInterval(1);
+				break;
+			}
+			case VSyncMode::ADAPTIVE:
+			{
+				glfwSwapInterval(-1);
+				break;
+			}
+		}
+
+		vSyncMode = mode;
+	}
+
+	void Window::SetFrameCap(const double framesPerSecond)
+	{
+		framePacer.SetTargetFrameRate(framesPerSecond);
 	}
 
 	void Window::PollEvents()
@@ -83,9 +132,9 @@ namespace Utils
 		glfwSetWindowShouldClose(window, value);
 	}
 
-	float Window::GetElapsedTime() const
+	double Window::GetElapsedTime() const
 	{
-		return static_cast<float>(glfwGetTime());
+		return glfwGetTime();
 	}
 
 	glm::vec2 Window::GetSize() const
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <chrono>
 #include <exception>
 #include <glm/glm.hpp>
 
+#include "FramePacer.hpp"
+#include "RollingStatistics.hpp"
+
 namespace Applications
 {
 	class IApplication;
@@ -12,11 +16,26 @@ struct GLFWwindow;
 
 namespace Utils
 {
+	enum class VSyncMode
+	{
+		OFF,
+		ON,
+		// Syncs when on time and tears instead of waiting a whole extra interval when late.
+		ADAPTIVE,
+	};
+
 	class Window
 	{
 		private:
 			GLFWwindow* window;
 
+			VSyncMode vSyncMode = VSyncMode::ON;
+			FramePacer framePacer;
+			// Milliseconds between consecutive SwapBuffers calls.
+			RollingStatistics frameTimes{ 600 };
+			std::chrono::steady_clock::time_point lastSwap;
+			bool hasSwapped = false;
+
 			static void FramebufferSizeCallback(GLFWwindow* window, int width, int height);
 			static void KeyCallback(GLFWwindow* window, int key, int scanCode, int action, int mods);
 			static void CursorPosCallback(GLFWwindow* window, double x, double y);
@@ -25,7 +44,8 @@ namespace Utils
 
 			static std::exception GetUserPointerNullException();
 		public:
-			Window(const char* title, int width, int height);
+			// A hidden window still gets a GL context; render offscreen to use it.
+			Window(const char* title, int width, int height, bool visible = true);
 			Window(const Window& other) = delete;
 			Window& operator=(const Window& other) = delete;
 			Window(Window&& other) = delete;
@@ -33,14 +53,25 @@ namespace Utils
 			~Window();
 
 			void InitOpenGL() const;
-			void SwapBuffers() const;
+			// Presents the frame, waits out the frame cap and records the frame time.
+			void SwapBuffers();
 			void PollEvents();
 			void ActivateInputFor(Applications::IApplication* app) const;
 
 			[[nodiscard]] bool GetShouldClose() const;
 			void SetShouldClose(bool value) const;
 
-			[[nodiscard]] float GetElapsedTime() const;
+			// Seconds since GLFW started, in double precision so it stays exact over long sessions.
+			[[nodiscard]] double GetElapsedTime() const;
+
+			// Adaptive falls back to on when the driver lacks swap_control_tear.
+			void SetVSyncMode(VSyncMode mode);
+			// Frames per second; 0 removes the cap.
+			void SetFrameCap(double framesPerSecond);
+
+			[[nodiscard]] VSyncMode GetVSyncMode() const { return vSyncMode; }
+			[[nodiscard]] double GetFrameCap() const { return framePacer.GetTargetFrameRate(); }
+			[[nodiscard]] const RollingStatistics& GetFrameTimes() const { return frameTimes; }
 			[[nodiscard]] glm::vec2 GetSize() const;
 	};
 }
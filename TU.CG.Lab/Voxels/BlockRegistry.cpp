@@ -0,0 +1,24 @@
+#include "BlockRegistry.hpp"
+
+namespace Voxels
+{
+	int BlockRegistry::GetMaterialLayer(const BlockType type)
+	{
+		switch (type)
+		{
+			case Blocks::REDSTONE:
+				return 1;
+			case Blocks::GOLD:
+				return 2;
+			default:
+				return 0;
+		}
+	}
+
+	const std::vector<std::string>& BlockRegistry::GetMaterialNames()
+	{
+		static const std::vector<std::string> materialNames = { "stone", "redstone", "gold" };
+
+		return materialNames;
+	}
+}
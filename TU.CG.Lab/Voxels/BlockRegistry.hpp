@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "BlockType.hpp"
+
+namespace Voxels
+{
+	class BlockRegistry
+	{
+		public:
+			// Layer of the block's material in the block texture arrays. Types
+			// without a material of their own fall back to stone.
+			[[nodiscard]] static int GetMaterialLayer(BlockType type);
+
+			// Material names in layer order; each names a pair of textures,
+			// "<name>.png" and "<name>_specular.png".
+			[[nodiscard]] static const std::vector<std::string>& GetMaterialNames();
+	};
+}
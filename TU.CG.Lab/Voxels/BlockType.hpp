@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Voxels
+{
+	using BlockType = std::uint8_t;
+
+	namespace Blocks
+	{
+		constexpr BlockType AIR = 0;
+		constexpr BlockType STONE = 1;
+		constexpr BlockType REDSTONE = 2;
+		constexpr BlockType GOLD = 3;
+	}
+}
@@ -0,0 +1,1602 @@
+#include "BuiltinMap.hpp"
+
+namespace Voxels
+{
+	void BuiltinMap::Build(World& world)
+	{
+		// The map was authored as map[x][y][z] with z pointing up, while the
+		// world is addressed as (x, y, z) with y pointing up.
+
+		world.Clear();
+
+		for (int x = 0; x < SIZE_X; x++) {
+			for (int y = 0; y < SIZE_Y; y++) {
+				for (int z = 0; z < SIZE_Z; z++) {
+					world.SetBlock(x, z, y, Blocks::STONE);
+				}
+			}
+		}
+
+		for (int x = 1; x < SIZE_X - 1; x++) {
+			for (int y = 1; y < SIZE_Y - 1; y++) {
+				for (int z = 1; z < SIZE_Z - 1; z++) {
+					world.SetBlock(x, z, y, Blocks::AIR);
+				}
+			}
+		}
+
+		world.SetBlock(1, 1, 1, 1);
+		world.SetBlock(1, 1, 2, 1);
+		world.SetBlock(1, 1, 3, 1);
+		world.SetBlock(1, 1, 4, 1);
+		world.SetBlock(1, 1, 5, 1);
+		world.SetBlock(1, 1, 6, 1);
+		world.SetBlock(1, 1, 7, 1);
+		world.SetBlock(1, 1, 8, 1);
+		world.SetBlock(1, 1, 9, 1);
+		world.SetBlock(1, 1, 18, 1);
+		world.SetBlock(1, 1, 19, 1);
+		world.SetBlock(1, 1, 20, 1);
+		world.SetBlock(1, 1, 21, 1);
+		world.SetBlock(1, 1, 22, 1);
+		world.SetBlock(1, 1, 23, 1);
+		world.SetBlock(1, 1, 24, 1);
+		world.SetBlock(1, 1, 25, 1);
+		world.SetBlock(1, 1, 26, 1);
+		world.SetBlock(1, 1, 27, 1);
+		world.SetBlock(1, 1, 28, 1);
+		world.SetBlock(1, 1, 29, 1);
+		world.SetBlock(1, 1, 30, 1);
+		world.SetBlock(2, 1, 1, 1);
+		world.SetBlock(2, 1, 2, 1);
+		world.SetBlock(2, 1, 3, 1);
+		world.SetBlock(2, 1, 4, 1);
+		world.SetBlock(2, 1, 5, 1);
+		world.SetBlock(2, 1, 6, 1);
+		world.SetBlock(2, 1, 7, 1);
+		world.SetBlock(2, 1, 19, 1);
+		world.SetBlock(2, 1, 20, 1);
+		world.SetBlock(2, 1, 21, 1);
+		world.SetBlock(2, 1, 22, 1);
+		world.SetBlock(2, 1, 23, 1);
+		world.SetBlock(2, 1, 24, 1);
+		world.SetBlock(2, 1, 25, 1);
+		world.SetBlock(2, 1, 26, 1);
+		world.SetBlock(2, 1, 27, 1);
+		world.SetBlock(2, 1, 28, 1);
+		world.SetBlock(2, 1, 29, 1);
+		world.SetBlock(2, 1, 30, 1);
+		world.SetBlock(3, 1, 1, 1);
+		world.SetBlock(3, 1, 2, 1);
+		world.SetBlock(3, 1, 3, 1);
+		world.SetBlock(3, 1, 4, 1);
+		world.SetBlock(3, 1, 5, 1);
+		world.SetBlock(3, 1, 22, 1);
+		world.SetBlock(3, 1, 23, 1);
+		world.SetBlock(3, 1, 24, 1);
+		world.SetBlock(3, 1, 25, 1);
+		world.SetBlock(3, 1, 26, 1);
+		world.SetBlock(3, 1, 27, 1);
+		world.SetBlock(3, 1, 28, 1);
+		world.SetBlock(3, 1, 29, 1);
+		world.SetBlock(3, 1, 30, 1);
+		world.SetBlock(4, 1, 1, 1);
+		world.SetBlock(4, 1, 2, 1);
+		world.SetBlock(4, 1, 3, 1);
+		world.SetBlock(4, 1, 4, 1);
+		world.SetBlock(4, 1, 23, 1);
+		world.SetBlock(4, 1, 24, 1);
+		world.SetBlock(4, 1, 25, 1);
+		world.SetBlock(4, 1, 26, 1);
+		world.SetBlock(4, 1, 27, 1);
+		world.SetBlock(4, 1, 28, 1);
+		world.SetBlock(4, 1, 29, 1);
+		world.SetBlock(4, 1, 30, 1);
+		world.SetBlock(5, 1, 1, 1);
+		world.SetBlock(5, 1, 2, 1);
+		world.SetBlock(5, 1, 3, 1);
+		world.SetBlock(5, 1, 23, 1);
+		world.SetBlock(5, 1, 24, 1);
+		world.SetBlock(5, 1, 25, 1);
+		world.SetBlock(5, 1, 26, 1);
+		world.SetBlock(5, 1, 27, 1);
+		world.SetBlock(5, 1, 28, 1);
+		world.SetBlock(5, 1, 29, 1);
+		world.SetBlock(5, 1, 30, 1);
+		world.SetBlock(6, 1, 1, 1);
+		world.SetBlock(6, 1, 2, 1);
+		world.SetBlock(6, 1, 24, 1);
+		world.SetBlock(6, 1, 25, 1);
+		world.SetBlock(6, 1, 26, 1);
+		world.SetBlock(6, 1, 27, 1);
+		world.SetBlock(6, 1, 28, 1);
+		world.SetBlock(6, 1, 29, 1);
+		world.SetBlock(6, 1, 30, 1);
+		world.SetBlock(7, 1, 1, 1);
+		world.SetBlock(7, 1, 25, 1);
+		world.SetBlock(7, 1, 26, 1);
+		world.SetBlock(7, 1, 27, 1);
+		world.SetBlock(7, 1, 28, 1);
+		world.SetBlock(7, 1, 29, 1);
+		world.SetBlock(7, 1, 30, 1);
+		world.SetBlock(8, 1, 1, 1);
+		world.SetBlock(8, 1, 25, 1);
+		world.SetBlock(8, 1, 26, 1);
+		world.SetBlock(8, 1, 27, 1);
+		world.SetBlock(8, 1, 28, 1);
+		world.SetBlock(8, 1, 29, 1);
+		world.SetBlock(8, 1, 30, 1);
+		world.SetBlock(9, 1, 1, 1);
+		world.SetBlock(9, 1, 18, 1);
+		world.SetBlock(9, 1, 19, 1);
+		world.SetBlock(9, 1, 26, 1);
+		world.SetBlock(9, 1, 27, 1);
+		world.SetBlock(9, 1, 28, 1);
+		world.SetBlock(9, 1, 29, 1);
+		world.SetBlock(9, 1, 30, 1);
+		world.SetBlock(10, 1, 15, 1);
+		world.SetBlock(10, 1, 16, 1);
+		world.SetBlock(10, 1, 17, 1);
+		world.SetBlock(10, 1, 18, 1);
+		world.SetBlock(10, 1, 19, 1);
+		world.SetBlock(10, 1, 26, 1);
+		world.SetBlock(10, 1, 27, 1);
+		world.SetBlock(10, 1, 28, 1);
+		world.SetBlock(10, 1, 29, 1);
+		world.SetBlock(10, 1, 30, 1);
+		world.SetBlock(11, 1, 11, 1);
+		world.SetBlock(11, 1, 12, 1);
+		world.SetBlock(11, 1, 13, 1);
+		world.SetBlock(11, 1, 14, 1);
+		world.SetBlock(11, 1, 15, 1);
+		world.SetBlock(11, 1, 16, 1);
+		world.SetBlock(11, 1, 17, 1);
+		world.SetBlock(11, 1, 18, 1);
+		world.SetBlock(11, 1, 19, 1);
+		world.SetBlock(11, 1, 27, 1);
+		world.SetBlock(11, 1, 28, 1);
+		world.SetBlock(11, 1, 29, 1);
+		world.SetBlock(11, 1, 30, 1);
+		world.SetBlock(12, 1, 9, 1);
+		world.SetBlock(12, 1, 10, 1);
+		world.SetBlock(12, 1, 11, 1);
+		world.SetBlock(12, 1, 12, 1);
+		world.SetBlock(12, 1, 13, 1);
+		world.SetBlock(12, 1, 14, 1);
+		world.SetBlock(12, 1, 15, 1);
+		world.SetBlock(12, 1, 16, 1);
+		world.SetBlock(12, 1, 17, 1);
+		world.SetBlock(12, 1, 18, 1);
+		world.SetBlock(12, 1, 19, 1);
+		world.SetBlock(12, 1, 20, 1);
+		world.SetBlock(12, 1, 27, 1);
+		world.SetBlock(12, 1, 28, 1);
+		world.SetBlock(12, 1, 29, 1);
+		world.SetBlock(12, 1, 30, 1);
+		world.SetBlock(13, 1, 8, 1);
+		world.SetBlock(13, 1, 9, 1);
+		world.SetBlock(13, 1, 19, 1);
+		world.SetBlock(13, 1, 20, 1);
+		world.SetBlock(13, 1, 27, 1);
+		world.SetBlock(13, 1, 28, 1);
+		world.SetBlock(13, 1, 29, 1);
+		world.SetBlock(13, 1, 30, 1);
+		world.SetBlock(14, 1, 7, 1);
+		world.SetBlock(14, 1, 8, 1);
+		world.SetBlock(14, 1, 20, 1);
+		world.SetBlock(14, 1, 21, 1);
+		world.SetBlock(14, 1, 28, 1);
+		world.SetBlock(14, 1, 29, 1);
+		world.SetBlock(14, 1, 30, 1);
+		world.SetBlock(15, 1, 7, 1);
+		world.SetBlock(15, 1, 20, 1);
+		world.SetBlock(15, 1, 21, 1);
+		world.SetBlock(15, 1, 28, 1);
+		world.SetBlock(15, 1, 29, 1);
+		world.SetBlock(15, 1, 30, 1);
+		world.SetBlock(16, 1, 7, 1);
+		world.SetBlock(16, 1, 21, 1);
+		world.SetBlock(16, 1, 22, 1);
+		world.SetBlock(16, 1, 29, 1);
+		world.SetBlock(16, 1, 30, 1);
+		world.SetBlock(17, 1, 7, 1);
+		world.SetBlock(17, 1, 8, 1);
+		world.SetBlock(17, 1, 21, 1);
+		world.SetBlock(17, 1, 22, 1);
+		world.SetBlock(17, 1, 29, 1);
+		world.SetBlock(17, 1, 30, 1);
+		world.SetBlock(18, 1, 8, 1);
+		world.SetBlock(18, 1, 9, 1);
+		world.SetBlock(18, 1, 22, 1);
+		world.SetBlock(18, 1, 30, 1);
+		world.SetBlock(19, 1, 1, 1);
+		world.SetBlock(19, 1, 9, 1);
+		world.SetBlock(19, 1, 10, 1);
+		world.SetBlock(19, 1, 11, 1);
+		world.SetBlock(19, 1, 22, 1);
+		world.SetBlock(19, 1, 30, 1);
+		world.SetBlock(20, 1, 1, 1);
+		world.SetBlock(20, 1, 11, 1);
+		world.SetBlock(20, 1, 12, 1);
+		world.SetBlock(20, 1, 13, 1);
+		world.SetBlock(20, 1, 14, 1);
+		world.SetBlock(20, 1, 15, 1);
+		world.SetBlock(20, 1, 16, 1);
+		world.SetBlock(20, 1, 20, 1);
+		world.SetBlock(20, 1, 21, 1);
+		world.SetBlock(20, 1, 22, 1);
+		world.SetBlock(20, 1, 23, 1);
+		world.SetBlock(21, 1, 1, 1);
+		world.SetBlock(21, 1, 16, 1);
+		world.SetBlock(21, 1, 17, 1);
+		world.SetBlock(21, 1, 18, 1);
+		world.SetBlock(21, 1, 19, 1);
+		world.SetBlock(21, 1, 20, 1);
+		world.SetBlock(22, 1, 1, 1);
+		world.SetBlock(23, 1, 1, 1);
+		world.SetBlock(23, 1, 30, 1);
+		world.SetBlock(24, 1, 1, 1);
+		world.SetBlock(24, 1, 2, 1);
+		world.SetBlock(24, 1, 30, 1);
+		world.SetBlock(25, 1, 1, 1);
+		world.SetBlock(25, 1, 2, 1);
+		world.SetBlock(25, 1, 3, 1);
+		world.SetBlock(25, 1, 30, 1);
+		world.SetBlock(26, 1, 1, 1);
+		world.SetBlock(26, 1, 2, 1);
+		world.SetBlock(26, 1, 3, 1);
+		world.SetBlock(26, 1, 4, 1);
+		world.SetBlock(26, 1, 5, 1);
+		world.SetBlock(26, 1, 29, 1);
+		world.SetBlock(26, 1, 30, 1);
+		world.SetBlock(27, 1, 1, 1);
+		world.SetBlock(27, 1, 2, 1);
+		world.SetBlock(27, 1, 3, 1);
+		world.SetBlock(27, 1, 4, 1);
+		world.SetBlock(27, 1, 5, 1);
+		world.SetBlock(27, 1, 6, 1);
+		world.SetBlock(27, 1, 7, 1);
+		world.SetBlock(27, 1, 8, 1);
+		world.SetBlock(27, 1, 29, 1);
+		world.SetBlock(27, 1, 30, 1);
+		world.SetBlock(28, 1, 1, 1);
+		world.SetBlock(28, 1, 2, 1);
+		world.SetBlock(28, 1, 3, 1);
+		world.SetBlock(28, 1, 4, 1);
+		world.SetBlock(28, 1, 5, 1);
+		world.SetBlock(28, 1, 6, 1);
+		world.SetBlock(28, 1, 7, 1);
+		world.SetBlock(28, 1, 8, 1);
+		world.SetBlock(28, 1, 9, 1);
+		world.SetBlock(28, 1, 10, 1);
+		world.SetBlock(28, 1, 28, 1);
+		world.SetBlock(28, 1, 29, 1);
+		world.SetBlock(28, 1, 30, 1);
+		world.SetBlock(29, 1, 1, 1);
+		world.SetBlock(29, 1, 10, 1);
+		world.SetBlock(29, 1, 11, 1);
+		world.SetBlock(29, 1, 12, 1);
+		world.SetBlock(29, 1, 13, 1);
+		world.SetBlock(29, 1, 14, 1);
+		world.SetBlock(29, 1, 15, 1);
+		world.SetBlock(29, 1, 16, 1);
+		world.SetBlock(29, 1, 17, 1);
+		world.SetBlock(29, 1, 18, 1);
+		world.SetBlock(29, 1, 28, 1);
+		world.SetBlock(29, 1, 29, 1);
+		world.SetBlock(29, 1, 30, 1);
+		world.SetBlock(30, 1, 1, 1);
+		world.SetBlock(30, 1, 13, 1);
+		world.SetBlock(30, 1, 14, 1);
+		world.SetBlock(30, 1, 18, 1);
+		world.SetBlock(30, 1, 19, 1);
+		world.SetBlock(30, 1, 24, 1);
+		world.SetBlock(30, 1, 25, 1);
+		world.SetBlock(30, 1, 26, 1);
+		world.SetBlock(30, 1, 27, 1);
+		world.SetBlock(30, 1, 28, 1);
+		world.SetBlock(30, 1, 29, 1);
+		world.SetBlock(30, 1, 30, 1);
+
+		world.SetBlock(1, 2, 1, 1);
+		world.SetBlock(1, 2, 2, 1);
+		world.SetBlock(1, 2, 3, 1);
+		world.SetBlock(1, 2, 4, 1);
+		world.SetBlock(1, 2, 5, 1);
+		world.SetBlock(1, 2, 6, 1);
+		world.SetBlock(1, 2, 7, 1);
+		world.SetBlock(1, 2, 8, 1);
+		world.SetBlock(1, 2, 9, 1);
+		world.SetBlock(1, 2, 19, 1);
+		world.SetBlock(1, 2, 20, 1);
+		world.SetBlock(1, 2, 21, 1);
+		world.SetBlock(1, 2, 22, 1);
+		world.SetBlock(1, 2, 23, 1);
+		world.SetBlock(1, 2, 24, 1);
+		world.SetBlock(1, 2, 25, 1);
+		world.SetBlock(1, 2, 26, 1);
+		world.SetBlock(1, 2, 27, 1);
+		world.SetBlock(1, 2, 28, 1);
+		world.SetBlock(1, 2, 29, 1);
+		world.SetBlock(1, 2, 30, 1);
+		world.SetBlock(2, 2, 1, 1);
+		world.SetBlock(2, 2, 2, 1);
+		world.SetBlock(2, 2, 3, 1);
+		world.SetBlock(2, 2, 4, 1);
+		world.SetBlock(2, 2, 5, 1);
+		world.SetBlock(2, 2, 6, 1);
+		world.SetBlock(2, 2, 7, 1);
+		world.SetBlock(2, 2, 21, 1);
+		world.SetBlock(2, 2, 22, 1);
+		world.SetBlock(2, 2, 23, 1);
+		world.SetBlock(2, 2, 24, 1);
+		world.SetBlock(2, 2, 25, 1);
+		world.SetBlock(2, 2, 26, 1);
+		world.SetBlock(2, 2, 27, 1);
+		world.SetBlock(2, 2, 28, 1);
+		world.SetBlock(2, 2, 29, 1);
+		world.SetBlock(2, 2, 30, 1);
+		world.SetBlock(3, 2, 1, 1);
+		world.SetBlock(3, 2, 2, 1);
+		world.SetBlock(3, 2, 3, 1);
+		world.SetBlock(3, 2, 23, 2);
+		world.SetBlock(3, 2, 24, 2);
+		world.SetBlock(3, 2, 25, 1);
+		world.SetBlock(3, 2, 26, 1);
+		world.SetBlock(3, 2, 27, 1);
+		world.SetBlock(3, 2, 28, 1);
+		world.SetBlock(3, 2, 29, 1);
+		world.SetBlock(3, 2, 30, 1);
+		world.SetBlock(4, 2, 1, 1);
+		world.SetBlock(4, 2, 2, 1);
+		world.SetBlock(4, 2, 3, 1);
+		world.SetBlock(4, 2, 24, 2);
+		world.SetBlock(4, 2, 25, 1);
+		world.SetBlock(4, 2, 26, 1);
+		world.SetBlock(4, 2, 27, 1);
+		world.SetBlock(4, 2, 28, 1);
+		world.SetBlock(4, 2, 29, 1);
+		world.SetBlock(4, 2, 30, 1);
+		world.SetBlock(5, 2, 1, 1);
+		world.SetBlock(5, 2, 2, 1);
+		world.SetBlock(5, 2, 24, 2);
+		world.SetBlock(5, 2, 25, 2);
+		world.SetBlock(5, 2, 26, 1);
+		world.SetBlock(5, 2, 27, 1);
+		world.SetBlock(5, 2, 28, 1);
+		world.SetBlock(5, 2, 29, 1);
+		world.SetBlock(5, 2, 30, 1);
+		world.SetBlock(6, 2, 1, 1);
+		world.SetBlock(6, 2, 25, 2);
+		world.SetBlock(6, 2, 26, 1);
+		world.SetBlock(6, 2, 27, 1);
+		world.SetBlock(6, 2, 28, 1);
+		world.SetBlock(6, 2, 29, 1);
+		world.SetBlock(6, 2, 30, 1);
+		world.SetBlock(7, 2, 1, 1);
+		world.SetBlock(7, 2, 25, 2);
+		world.SetBlock(7, 2, 26, 2);
+		world.SetBlock(7, 2, 27, 1);
+		world.SetBlock(7, 2, 28, 1);
+		world.SetBlock(7, 2, 29, 1);
+		world.SetBlock(7, 2, 30, 1);
+		world.SetBlock(8, 2, 1, 1);
+		world.SetBlock(8, 2, 26, 2);
+		world.SetBlock(8, 2, 27, 1);
+		world.SetBlock(8, 2, 28, 1);
+		world.SetBlock(8, 2, 29, 1);
+		world.SetBlock(8, 2, 30, 1);
+		world.SetBlock(9, 2, 1, 1);
+		world.SetBlock(9, 2, 18, 1);
+		world.SetBlock(9, 2, 19, 1);
+		world.SetBlock(9, 2, 26, 2);
+		world.SetBlock(9, 2, 27, 2);
+		world.SetBlock(9, 2, 28, 1);
+		world.SetBlock(9, 2, 29, 1);
+		world.SetBlock(9, 2, 30, 1);
+		world.SetBlock(10, 2, 15, 1);
+		world.SetBlock(10, 2, 16, 1);
+		world.SetBlock(10, 2, 17, 1);
+		world.SetBlock(10, 2, 18, 1);
+		world.SetBlock(10, 2, 19, 1);
+		world.SetBlock(10, 2, 27, 2);
+		world.SetBlock(10, 2, 28, 1);
+		world.SetBlock(10, 2, 29, 1);
+		world.SetBlock(10, 2, 30, 1);
+		world.SetBlock(11, 2, 11, 3);
+		world.SetBlock(11, 2, 12, 3);
+		world.SetBlock(11, 2, 13, 3);
+		world.SetBlock(11, 2, 14, 3);
+		world.SetBlock(11, 2, 15, 1);
+		world.SetBlock(11, 2, 16, 1);
+		world.SetBlock(11, 2, 17, 1);
+		world.SetBlock(11, 2, 18, 1);
+		world.SetBlock(11, 2, 19, 1);
+		world.SetBlock(11, 2, 27, 1);
+		world.SetBlock(11, 2, 28, 1);
+		world.SetBlock(11, 2, 29, 1);
+		world.SetBlock(11, 2, 30, 1);
+		world.SetBlock(12, 2, 9, 1);
+		world.SetBlock(12, 2, 10, 1);
+		world.SetBlock(12, 2, 11, 1);
+		world.SetBlock(12, 2, 12, 1);
+		world.SetBlock(12, 2, 13, 1);
+		world.SetBlock(12, 2, 14, 1);
+		world.SetBlock(12, 2, 15, 1);
+		world.SetBlock(12, 2, 16, 1);
+		world.SetBlock(12, 2, 17, 1);
+		world.SetBlock(12, 2, 18, 1);
+		world.SetBlock(12, 2, 19, 1);
+		world.SetBlock(12, 2, 20, 1);
+		world.SetBlock(12, 2, 28, 1);
+		world.SetBlock(12, 2, 29, 1);
+		world.SetBlock(12, 2, 30, 1);
+		world.SetBlock(13, 2, 9, 1);
+		world.SetBlock(13, 2, 19, 1);
+		world.SetBlock(13, 2, 20, 1);
+		world.SetBlock(13, 2, 28, 1);
+		world.SetBlock(13, 2, 29, 1);
+		world.SetBlock(13, 2, 30, 1);
+		world.SetBlock(14, 2, 8, 1);
+		world.SetBlock(14, 2, 9, 1);
+		world.SetBlock(14, 2, 10, 1);
+		world.SetBlock(14, 2, 20, 1);
+		world.SetBlock(14, 2, 21, 1);
+		world.SetBlock(14, 2, 29, 1);
+		world.SetBlock(14, 2, 30, 1);
+		world.SetBlock(15, 2, 8, 1);
+		world.SetBlock(15, 2, 9, 1);
+		world.SetBlock(15, 2, 10, 1);
+		world.SetBlock(15, 2, 20, 1);
+		world.SetBlock(15, 2, 21, 1);
+		world.SetBlock(15, 2, 29, 1);
+		world.SetBlock(15, 2, 30, 1);
+		world.SetBlock(16, 2, 8, 1);
+		world.SetBlock(16, 2, 9, 1);
+		world.SetBlock(16, 2, 10, 1);
+		world.SetBlock(16, 2, 21, 1);
+		world.SetBlock(16, 2, 22, 1);
+		world.SetBlock(16, 2, 30, 1);
+		world.SetBlock(17, 2, 8, 1);
+		world.SetBlock(17, 2, 9, 1);
+		world.SetBlock(17, 2, 10, 1);
+		world.SetBlock(17, 2, 21, 1);
+		world.SetBlock(17, 2, 22, 3);
+		world.SetBlock(17, 2, 30, 1);
+		world.SetBlock(18, 2, 9, 1);
+		world.SetBlock(18, 2, 10, 1);
+		world.SetBlock(18, 2, 11, 1);
+		world.SetBlock(18, 2, 12, 1);
+		world.SetBlock(18, 2, 22, 3);
+		world.SetBlock(18, 2, 30, 1);
+		world.SetBlock(19, 2, 10, 1);
+		world.SetBlock(19, 2, 11, 1);
+		world.SetBlock(19, 2, 12, 1);
+		world.SetBlock(19, 2, 13, 1);
+		world.SetBlock(19, 2, 14, 1);
+		world.SetBlock(19, 2, 15, 1);
+		world.SetBlock(19, 2, 16, 1);
+		world.SetBlock(19, 2, 22, 1);
+		world.SetBlock(20, 2, 12, 1);
+		world.SetBlock(20, 2, 13, 1);
+		world.SetBlock(20, 2, 14, 1);
+		world.SetBlock(20, 2, 15, 1);
+		world.SetBlock(20, 2, 16, 1);
+		world.SetBlock(20, 2, 17, 1);
+		world.SetBlock(20, 2, 18, 1);
+		world.SetBlock(20, 2, 19, 1);
+		world.SetBlock(20, 2, 20, 1);
+		world.SetBlock(20, 2, 21, 1);
+		world.SetBlock(20, 2, 22, 1);
+		world.SetBlock(20, 2, 23, 1);
+		world.SetBlock(21, 2, 18, 1);
+		world.SetBlock(21, 2, 19, 1);
+		world.SetBlock(21, 2, 20, 1);
+		world.SetBlock(22, 2, 1, 1);
+		world.SetBlock(23, 2, 1, 1);
+		world.SetBlock(23, 2, 30, 1);
+		world.SetBlock(24, 2, 1, 1);
+		world.SetBlock(24, 2, 30, 1);
+		world.SetBlock(25, 2, 1, 1);
+		world.SetBlock(25, 2, 2, 1);
+		world.SetBlock(25, 2, 3, 1);
+		world.SetBlock(25, 2, 30, 1);
+		world.SetBlock(26, 2, 1, 1);
+		world.SetBlock(26, 2, 2, 1);
+		world.SetBlock(26, 2, 3, 1);
+		world.SetBlock(26, 2, 4, 1);
+		world.SetBlock(26, 2, 5, 1);
+		world.SetBlock(26, 2, 29, 1);
+		world.SetBlock(26, 2, 30, 1);
+		world.SetBlock(27, 2, 1, 1);
+		world.SetBlock(27, 2, 2, 1);
+		world.SetBlock(27, 2, 3, 1);
+		world.SetBlock(27, 2, 4, 1);
+		world.SetBlock(27, 2, 5, 1);
+		world.SetBlock(27, 2, 6, 4);
+		world.SetBlock(27, 2, 7, 4);
+		world.SetBlock(27, 2, 8, 4);
+		world.SetBlock(27, 2, 29, 1);
+		world.SetBlock(27, 2, 30, 1);
+		world.SetBlock(28, 2, 1, 1);
+		world.SetBlock(28, 2, 2, 1);
+		world.SetBlock(28, 2, 3, 1);
+		world.SetBlock(28, 2, 4, 1);
+		world.SetBlock(28, 2, 5, 1);
+		world.SetBlock(28, 2, 6, 1);
+		world.SetBlock(28, 2, 7, 1);
+		world.SetBlock(28, 2, 8, 1);
+		world.SetBlock(28, 2, 9, 1);
+		world.SetBlock(28, 2, 10, 1);
+		world.SetBlock(28, 2, 29, 1);
+		world.SetBlock(28, 2, 30, 1);
+		world.SetBlock(29, 2, 1, 1);
+		world.SetBlock(29, 2, 10, 1);
+		world.SetBlock(29, 2, 11, 1);
+		world.SetBlock(29, 2, 12, 1);
+		world.SetBlock(29, 2, 13, 1);
+		world.SetBlock(29, 2, 14, 1);
+		world.SetBlock(29, 2, 15, 1);
+		world.SetBlock(29, 2, 16, 1);
+		world.SetBlock(29, 2, 17, 1);
+		world.SetBlock(29, 2, 28, 1);
+		world.SetBlock(29, 2, 29, 1);
+		world.SetBlock(29, 2, 30, 1);
+		world.SetBlock(30, 2, 1, 1);
+		world.SetBlock(30, 2, 13, 1);
+		world.SetBlock(30, 2, 14, 1);
+		world.SetBlock(30, 2, 18, 1);
+		world.SetBlock(30, 2, 19, 1);
+		world.SetBlock(30, 2, 24, 1);
+		world.SetBlock(30, 2, 25, 1);
+		world.SetBlock(30, 2, 26, 1);
+		world.SetBlock(30, 2, 27, 1);
+		world.SetBlock(30, 2, 28, 1);
+		world.SetBlock(30, 2, 29, 1);
+		world.SetBlock(30, 2, 30, 1);
+
+
+		world.SetBlock(1, 3, 1, 1);
+		world.SetBlock(1, 3, 2, 1);
+		world.SetBlock(1, 3, 3, 1);
+		world.SetBlock(1, 3, 4, 1);
+		world.SetBlock(1, 3, 5, 1);
+		world.SetBlock(1, 3, 6, 1);
+		world.SetBlock(1, 3, 7, 1);
+		world.SetBlock(1, 3, 8, 1);
+		world.SetBlock(1, 3, 9, 1);
+		world.SetBlock(1, 3, 19, 1);
+		world.SetBlock(1, 3, 20, 1);
+		world.SetBlock(1, 3, 21, 1);
+		world.SetBlock(1, 3, 22, 1);
+		world.SetBlock(1, 3, 23, 1);
+		world.SetBlock(1, 3, 24, 1);
+		world.SetBlock(1, 3, 25, 1);
+		world.SetBlock(1, 3, 26, 1);
+		world.SetBlock(1, 3, 27, 1);
+		world.SetBlock(1, 3, 28, 1);
+		world.SetBlock(1, 3, 29, 1);
+		world.SetBlock(1, 3, 30, 1);
+		world.SetBlock(2, 3, 1, 1);
+		world.SetBlock(2, 3, 2, 1);
+		world.SetBlock(2, 3, 3, 1);
+		world.SetBlock(2, 3, 4, 1);
+		world.SetBlock(2, 3, 5, 1);
+		world.SetBlock(2, 3, 6, 1);
+		world.SetBlock(2, 3, 7, 1);
+		world.SetBlock(2, 3, 23, 1);
+		world.SetBlock(2, 3, 24, 1);
+		world.SetBlock(2, 3, 25, 1);
+		world.SetBlock(2, 3, 26, 1);
+		world.SetBlock(2, 3, 27, 1);
+		world.SetBlock(2, 3, 28, 1);
+		world.SetBlock(2, 3, 29, 1);
+		world.SetBlock(2, 3, 30, 1);
+		world.SetBlock(3, 3, 1, 1);
+		world.SetBlock(3, 3, 2, 1);
+		world.SetBlock(3, 3, 3, 1);
+		world.SetBlock(3, 3, 4, 1);
+		world.SetBlock(3, 3, 5, 1);
+		world.SetBlock(3, 3, 24, 2);
+		world.SetBlock(3, 3, 25, 1);
+		world.SetBlock(3, 3, 26, 1);
+		world.SetBlock(3, 3, 27, 1);
+		world.SetBlock(3, 3, 28, 1);
+		world.SetBlock(3, 3, 29, 1);
+		world.SetBlock(3, 3, 30, 1);
+		world.SetBlock(4, 3, 1, 1);
+		world.SetBlock(4, 3, 2, 1);
+		world.SetBlock(4, 3, 3, 1);
+		world.SetBlock(4, 3, 4, 1);
+		world.SetBlock(4, 3, 5, 1);
+		world.SetBlock(4, 3, 25, 2);
+		world.SetBlock(4, 3, 26, 1);
+		world.SetBlock(4, 3, 27, 1);
+		world.SetBlock(4, 3, 28, 1);
+		world.SetBlock(4, 3, 29, 1);
+		world.SetBlock(4, 3, 30, 1);
+		world.SetBlock(5, 3, 1, 1);
+		world.SetBlock(5, 3, 2, 1);
+		world.SetBlock(5, 3, 3, 1);
+		world.SetBlock(5, 3, 4, 1);
+		world.SetBlock(5, 3, 5, 1);
+		world.SetBlock(5, 3, 25, 2);
+		world.SetBlock(5, 3, 26, 1);
+		world.SetBlock(5, 3, 27, 1);
+		world.SetBlock(5, 3, 28, 1);
+		world.SetBlock(5, 3, 29, 1);
+		world.SetBlock(5, 3, 30, 1);
+		world.SetBlock(6, 3, 1, 1);
+		world.SetBlock(6, 3, 2, 1);
+		world.SetBlock(6, 3, 3, 1);
+		world.SetBlock(6, 3, 4, 1);
+		world.SetBlock(6, 3, 26, 2);
+		world.SetBlock(6, 3, 27, 1);
+		world.SetBlock(6, 3, 28, 1);
+		world.SetBlock(6, 3, 29, 1);
+		world.SetBlock(6, 3, 30, 1);
+		world.SetBlock(7, 3, 1, 1);
+		world.SetBlock(7, 3, 2, 1);
+		world.SetBlock(7, 3, 3, 1);
+		world.SetBlock(7, 3, 4, 1);
+		world.SetBlock(7, 3, 26, 2);
+		world.SetBlock(7, 3, 27, 1);
+		world.SetBlock(7, 3, 28, 1);
+		world.SetBlock(7, 3, 29, 1);
+		world.SetBlock(7, 3, 30, 1);
+		world.SetBlock(8, 3, 1, 1);
+		world.SetBlock(8, 3, 2, 1);
+		world.SetBlock(8, 3, 3, 1);
+		world.SetBlock(8, 3, 27, 2);
+		world.SetBlock(8, 3, 28, 1);
+		world.SetBlock(8, 3, 29, 1);
+		world.SetBlock(8, 3, 30, 1);
+		world.SetBlock(9, 3, 1, 1);
+		world.SetBlock(9, 3, 2, 1);
+		world.SetBlock(9, 3, 18, 1);
+		world.SetBlock(9, 3, 19, 1);
+		world.SetBlock(9, 3, 27, 2);
+		world.SetBlock(9, 3, 28, 1);
+		world.SetBlock(9, 3, 29, 1);
+		world.SetBlock(9, 3, 30, 1);
+		world.SetBlock(10, 3, 1, 1);
+		world.SetBlock(10, 3, 2, 4);
+		world.SetBlock(10, 3, 15, 1);
+		world.SetBlock(10, 3, 16, 1);
+		world.SetBlock(10, 3, 17, 1);
+		world.SetBlock(10, 3, 18, 1);
+		world.SetBlock(10, 3, 19, 1);
+		world.SetBlock(10, 3, 28, 2);
+		world.SetBlock(10, 3, 29, 1);
+		world.SetBlock(10, 3, 30, 1);
+		world.SetBlock(11, 3, 1, 1);
+		world.SetBlock(11, 3, 2, 4);
+		world.SetBlock(11, 3, 11, 3);
+		world.SetBlock(11, 3, 12, 3);
+		world.SetBlock(11, 3, 13, 1);
+		world.SetBlock(11, 3, 14, 1);
+		world.SetBlock(11, 3, 15, 1);
+		world.SetBlock(11, 3, 16, 1);
+		world.SetBlock(11, 3, 17, 1);
+		world.SetBlock(11, 3, 18, 1);
+		world.SetBlock(11, 3, 19, 1);
+		world.SetBlock(11, 3, 28, 1);
+		world.SetBlock(11, 3, 29, 1);
+		world.SetBlock(11, 3, 30, 1);
+		world.SetBlock(12, 3, 1, 1);
+		world.SetBlock(12, 3, 2, 4);
+		world.SetBlock(12, 3, 9, 1);
+		world.SetBlock(12, 3, 10, 1);
+		world.SetBlock(12, 3, 11, 1);
+		world.SetBlock(12, 3, 12, 1);
+		world.SetBlock(12, 3, 13, 1);
+		world.SetBlock(12, 3, 14, 1);
+		world.SetBlock(12, 3, 15, 1);
+		world.SetBlock(12, 3, 16, 1);
+		world.SetBlock(12, 3, 17, 1);
+		world.SetBlock(12, 3, 18, 1);
+		world.SetBlock(12, 3, 19, 1);
+		world.SetBlock(12, 3, 20, 1);
+		world.SetBlock(12, 3, 29, 1);
+		world.SetBlock(12, 3, 30, 1);
+		world.SetBlock(13, 3, 1, 1);
+		world.SetBlock(13, 3, 2, 4);
+		world.SetBlock(13, 3, 9, 1);
+		world.SetBlock(13, 3, 19, 1);
+		world.SetBlock(13, 3, 20, 1);
+		world.SetBlock(13, 3, 29, 1);
+		world.SetBlock(13, 3, 30, 1);
+		world.SetBlock(14, 3, 1, 1);
+		world.SetBlock(14, 3, 8, 1);
+		world.SetBlock(14, 3, 9, 1);
+		world.SetBlock(14, 3, 10, 1);
+		world.SetBlock(14, 3, 20, 1);
+		world.SetBlock(14, 3, 21, 1);
+		world.SetBlock(14, 3, 30, 1);
+		world.SetBlock(15, 3, 1, 1);
+		world.SetBlock(15, 3, 8, 1);
+		world.SetBlock(15, 3, 9, 1);
+		world.SetBlock(15, 3, 10, 1);
+		world.SetBlock(15, 3, 20, 1);
+		world.SetBlock(15, 3, 21, 1);
+		world.SetBlock(15, 3, 30, 1);
+		world.SetBlock(16, 3, 8, 1);
+		world.SetBlock(16, 3, 9, 1);
+		world.SetBlock(16, 3, 10, 1);
+		world.SetBlock(16, 3, 21, 1);
+		world.SetBlock(16, 3, 22, 1);
+		world.SetBlock(16, 3, 30, 1);
+		world.SetBlock(17, 3, 9, 1);
+		world.SetBlock(17, 3, 10, 1);
+		world.SetBlock(17, 3, 21, 1);
+		world.SetBlock(17, 3, 22, 1);
+		world.SetBlock(17, 3, 30, 1);
+		world.SetBlock(18, 3, 11, 1);
+		world.SetBlock(18, 3, 12, 1);
+		world.SetBlock(18, 3, 22, 3);
+		world.SetBlock(18, 3, 30, 1);
+		world.SetBlock(19, 3, 1, 1);
+		world.SetBlock(19, 3, 12, 1);
+		world.SetBlock(19, 3, 13, 1);
+		world.SetBlock(19, 3, 14, 1);
+		world.SetBlock(19, 3, 15, 1);
+		world.SetBlock(19, 3, 16, 1);
+		world.SetBlock(19, 3, 22, 1);
+		world.SetBlock(20, 3, 1, 1);
+		world.SetBlock(20, 3, 12, 1);
+		world.SetBlock(20, 3, 13, 1);
+		world.SetBlock(20, 3, 14, 1);
+		world.SetBlock(20, 3, 15, 1);
+		world.SetBlock(20, 3, 16, 1);
+		world.SetBlock(20, 3, 17, 1);
+		world.SetBlock(20, 3, 18, 1);
+		world.SetBlock(20, 3, 19, 1);
+		world.SetBlock(20, 3, 20, 1);
+		world.SetBlock(20, 3, 21, 1);
+		world.SetBlock(20, 3, 22, 1);
+		world.SetBlock(20, 3, 23, 1);
+		world.SetBlock(21, 3, 1, 1);
+		world.SetBlock(21, 3, 18, 1);
+		world.SetBlock(21, 3, 19, 1);
+		world.SetBlock(21, 3, 20, 1);
+		world.SetBlock(22, 3, 1, 1);
+		world.SetBlock(22, 3, 2, 1);
+		world.SetBlock(23, 3, 1, 1);
+		world.SetBlock(23, 3, 2, 1);
+		world.SetBlock(23, 3, 30, 1);
+		world.SetBlock(24, 3, 1, 1);
+		world.SetBlock(24, 3, 2, 1);
+		world.SetBlock(24, 3, 30, 1);
+		world.SetBlock(25, 3, 1, 1);
+		world.SetBlock(25, 3, 2, 1);
+		world.SetBlock(25, 3, 3, 1);
+		world.SetBlock(25, 3, 30, 1);
+		world.SetBlock(26, 3, 1, 1);
+		world.SetBlock(26, 3, 2, 1);
+		world.SetBlock(26, 3, 3, 1);
+		world.SetBlock(26, 3, 4, 1);
+		world.SetBlock(26, 3, 5, 1);
+		world.SetBlock(26, 3, 29, 5);
+		world.SetBlock(26, 3, 30, 1);
+		world.SetBlock(27, 3, 1, 1);
+		world.SetBlock(27, 3, 2, 1);
+		world.SetBlock(27, 3, 3, 1);
+		world.SetBlock(27, 3, 4, 1);
+		world.SetBlock(27, 3, 5, 1);
+		world.SetBlock(27, 3, 6, 4);
+		world.SetBlock(27, 3, 7, 4);
+		world.SetBlock(27, 3, 8, 4);
+		world.SetBlock(27, 3, 29, 5);
+		world.SetBlock(27, 3, 30, 1);
+		world.SetBlock(28, 3, 1, 1);
+		world.SetBlock(28, 3, 2, 1);
+		world.SetBlock(28, 3, 3, 1);
+		world.SetBlock(28, 3, 4, 1);
+		world.SetBlock(28, 3, 5, 1);
+		world.SetBlock(28, 3, 6, 1);
+		world.SetBlock(28, 3, 7, 1);
+		world.SetBlock(28, 3, 8, 1);
+		world.SetBlock(28, 3, 9, 1);
+		world.SetBlock(28, 3, 10, 1);
+		world.SetBlock(28, 3, 29, 1);
+		world.SetBlock(28, 3, 30, 1);
+		world.SetBlock(29, 3, 1, 1);
+		world.SetBlock(29, 3, 10, 1);
+		world.SetBlock(29, 3, 11, 1);
+		world.SetBlock(29, 3, 12, 1);
+		world.SetBlock(29, 3, 13, 1);
+		world.SetBlock(29, 3, 14, 1);
+		world.SetBlock(29, 3, 15, 1);
+		world.SetBlock(29, 3, 16, 1);
+		world.SetBlock(29, 3, 17, 1);
+		world.SetBlock(29, 3, 28, 1);
+		world.SetBlock(29, 3, 29, 1);
+		world.SetBlock(29, 3, 30, 1);
+		world.SetBlock(30, 3, 1, 1);
+		world.SetBlock(30, 3, 13, 1);
+		world.SetBlock(30, 3, 14, 1);
+		world.SetBlock(30, 3, 18, 1);
+		world.SetBlock(30, 3, 19, 1);
+		world.SetBlock(30, 3, 24, 1);
+		world.SetBlock(30, 3, 25, 1);
+		world.SetBlock(30, 3, 26, 1);
+		world.SetBlock(30, 3, 27, 1);
+		world.SetBlock(30, 3, 28, 1);
+		world.SetBlock(30, 3, 29, 1);
+		world.SetBlock(30, 3, 30, 1);
+
+		world.SetBlock(1, 4, 8, 1);
+		world.SetBlock(1, 4, 9, 1);
+		world.SetBlock(1, 4, 10, 1);
+		world.SetBlock(1, 4, 11, 1);
+		world.SetBlock(1, 4, 12, 1);
+		world.SetBlock(1, 4, 13, 1);
+		world.SetBlock(1, 4, 14, 1);
+		world.SetBlock(1, 4, 15, 1);
+		world.SetBlock(1, 4, 19, 1);
+		world.SetBlock(1, 4, 20, 1);
+		world.SetBlock(1, 4, 21, 1);
+		world.SetBlock(1, 4, 22, 1);
+		world.SetBlock(1, 4, 23, 1);
+		world.SetBlock(1, 4, 24, 1);
+		world.SetBlock(1, 4, 25, 1);
+		world.SetBlock(1, 4, 26, 1);
+		world.SetBlock(1, 4, 27, 1);
+		world.SetBlock(1, 4, 28, 1);
+		world.SetBlock(2, 4, 8, 1);
+		world.SetBlock(2, 4, 9, 1);
+		world.SetBlock(2, 4, 10, 1);
+		world.SetBlock(2, 4, 11, 1);
+		world.SetBlock(2, 4, 12, 1);
+		world.SetBlock(2, 4, 13, 1);
+		world.SetBlock(2, 4, 14, 1);
+		world.SetBlock(2, 4, 21, 1);
+		world.SetBlock(2, 4, 22, 1);
+		world.SetBlock(2, 4, 23, 1);
+		world.SetBlock(2, 4, 24, 1);
+		world.SetBlock(2, 4, 25, 1);
+		world.SetBlock(2, 4, 26, 1);
+		world.SetBlock(2, 4, 27, 1);
+		world.SetBlock(2, 4, 28, 1);
+		world.SetBlock(2, 4, 29, 1);
+		world.SetBlock(3, 4, 5, 1);
+		world.SetBlock(3, 4, 6, 1);
+		world.SetBlock(3, 4, 7, 1);
+		world.SetBlock(3, 4, 8, 1);
+		world.SetBlock(3, 4, 9, 1);
+		world.SetBlock(3, 4, 10, 1);
+		world.SetBlock(3, 4, 11, 1);
+		world.SetBlock(3, 4, 12, 1);
+		world.SetBlock(3, 4, 13, 1);
+		world.SetBlock(3, 4, 22, 1);
+		world.SetBlock(3, 4, 23, 1);
+		world.SetBlock(3, 4, 24, 1);
+		world.SetBlock(3, 4, 25, 1);
+		world.SetBlock(3, 4, 26, 1);
+		world.SetBlock(3, 4, 27, 1);
+		world.SetBlock(3, 4, 28, 1);
+		world.SetBlock(3, 4, 29, 1);
+		world.SetBlock(4, 4, 4, 1);
+		world.SetBlock(4, 4, 5, 1);
+		world.SetBlock(4, 4, 6, 1);
+		world.SetBlock(4, 4, 7, 1);
+		world.SetBlock(4, 4, 8, 1);
+		world.SetBlock(4, 4, 9, 1);
+		world.SetBlock(4, 4, 10, 1);
+		world.SetBlock(4, 4, 23, 1);
+		world.SetBlock(4, 4, 24, 1);
+		world.SetBlock(4, 4, 25, 1);
+		world.SetBlock(4, 4, 26, 1);
+		world.SetBlock(4, 4, 27, 1);
+		world.SetBlock(4, 4, 28, 1);
+		world.SetBlock(4, 4, 29, 1);
+		world.SetBlock(4, 4, 30, 1);
+		world.SetBlock(5, 4, 3, 1);
+		world.SetBlock(5, 4, 4, 1);
+		world.SetBlock(5, 4, 5, 1);
+		world.SetBlock(5, 4, 6, 1);
+		world.SetBlock(5, 4, 7, 1);
+		world.SetBlock(5, 4, 8, 1);
+		world.SetBlock(5, 4, 9, 1);
+		world.SetBlock(5, 4, 25, 1);
+		world.SetBlock(5, 4, 26, 1);
+		world.SetBlock(5, 4, 27, 1);
+		world.SetBlock(5, 4, 28, 1);
+		world.SetBlock(5, 4, 29, 1);
+		world.SetBlock(5, 4, 30, 1);
+		world.SetBlock(6, 4, 3, 1);
+		world.SetBlock(6, 4, 4, 1);
+		world.SetBlock(6, 4, 5, 1);
+		world.SetBlock(6, 4, 6, 1);
+		world.SetBlock(6, 4, 7, 1);
+		world.SetBlock(6, 4, 8, 1);
+		world.SetBlock(6, 4, 25, 1);
+		world.SetBlock(6, 4, 26, 1);
+		world.SetBlock(6, 4, 27, 1);
+		world.SetBlock(6, 4, 28, 1);
+		world.SetBlock(6, 4, 29, 1);
+		world.SetBlock(6, 4, 30, 1);
+		world.SetBlock(7, 4, 3, 1);
+		world.SetBlock(7, 4, 4, 1);
+		world.SetBlock(7, 4, 5, 1);
+		world.SetBlock(7, 4, 6, 1);
+		world.SetBlock(7, 4, 7, 1);
+		world.SetBlock(7, 4, 13, 2);
+		world.SetBlock(7, 4, 14, 2);
+		world.SetBlock(7, 4, 15, 1);
+		world.SetBlock(7, 4, 26, 1);
+		world.SetBlock(7, 4, 27, 1);
+		world.SetBlock(7, 4, 28, 1);
+		world.SetBlock(7, 4, 29, 1);
+		world.SetBlock(7, 4, 30, 1);
+		world.SetBlock(8, 4, 2, 1);
+		world.SetBlock(8, 4, 3, 1);
+		world.SetBlock(8, 4, 4, 1);
+		world.SetBlock(8, 4, 5, 1);
+		world.SetBlock(8, 4, 6, 1);
+		world.SetBlock(8, 4, 7, 1);
+		world.SetBlock(8, 4, 12, 2);
+		world.SetBlock(8, 4, 13, 2);
+		world.SetBlock(8, 4, 14, 1);
+		world.SetBlock(8, 4, 15, 1);
+		world.SetBlock(8, 4, 16, 1);
+		world.SetBlock(8, 4, 27, 1);
+		world.SetBlock(8, 4, 28, 1);
+		world.SetBlock(8, 4, 29, 1);
+		world.SetBlock(8, 4, 30, 1);
+		world.SetBlock(9, 4, 2, 1);
+		world.SetBlock(9, 4, 3, 1);
+		world.SetBlock(9, 4, 4, 1);
+		world.SetBlock(9, 4, 5, 1);
+		world.SetBlock(9, 4, 6, 1);
+		world.SetBlock(9, 4, 10, 2);
+		world.SetBlock(9, 4, 11, 2);
+		world.SetBlock(9, 4, 12, 2);
+		world.SetBlock(9, 4, 13, 1);
+		world.SetBlock(9, 4, 14, 1);
+		world.SetBlock(9, 4, 15, 1);
+		world.SetBlock(9, 4, 16, 1);
+		world.SetBlock(9, 4, 17, 1);
+		world.SetBlock(9, 4, 18, 1);
+		world.SetBlock(9, 4, 19, 1);
+		world.SetBlock(9, 4, 27, 1);
+		world.SetBlock(9, 4, 28, 1);
+		world.SetBlock(9, 4, 29, 1);
+		world.SetBlock(9, 4, 30, 1);
+		world.SetBlock(10, 4, 1, 1);
+		world.SetBlock(10, 4, 2, 1);
+		world.SetBlock(10, 4, 3, 1);
+		world.SetBlock(10, 4, 4, 1);
+		world.SetBlock(10, 4, 5, 1);
+		world.SetBlock(10, 4, 10, 2);
+		world.SetBlock(10, 4, 11, 1);
+		world.SetBlock(10, 4, 12, 1);
+		world.SetBlock(10, 4, 13, 1);
+		world.SetBlock(10, 4, 14, 1);
+		world.SetBlock(10, 4, 15, 1);
+		world.SetBlock(10, 4, 16, 1);
+		world.SetBlock(10, 4, 17, 1);
+		world.SetBlock(10, 4, 18, 1);
+		world.SetBlock(10, 4, 19, 1);
+		world.SetBlock(10, 4, 27, 1);
+		world.SetBlock(10, 4, 28, 1);
+		world.SetBlock(10, 4, 29, 1);
+		world.SetBlock(10, 4, 30, 1);
+		world.SetBlock(11, 4, 1, 1);
+		world.SetBlock(11, 4, 2, 1);
+		world.SetBlock(11, 4, 3, 1);
+		world.SetBlock(11, 4, 4, 1);
+		world.SetBlock(11, 4, 10, 1);
+		world.SetBlock(11, 4, 11, 1);
+		world.SetBlock(11, 4, 12, 1);
+		world.SetBlock(11, 4, 13, 1);
+		world.SetBlock(11, 4, 14, 1);
+		world.SetBlock(11, 4, 15, 1);
+		world.SetBlock(11, 4, 16, 1);
+		world.SetBlock(11, 4, 17, 1);
+		world.SetBlock(11, 4, 18, 1);
+		world.SetBlock(11, 4, 19, 1);
+		world.SetBlock(11, 4, 20, 1);
+		world.SetBlock(11, 4, 27, 1);
+		world.SetBlock(11, 4, 28, 1);
+		world.SetBlock(11, 4, 29, 1);
+		world.SetBlock(11, 4, 30, 1);
+		world.SetBlock(12, 4, 1, 1);
+		world.SetBlock(12, 4, 2, 1);
+		world.SetBlock(12, 4, 3, 1);
+		world.SetBlock(12, 4, 9, 1);
+		world.SetBlock(12, 4, 10, 1);
+		world.SetBlock(12, 4, 11, 1);
+		world.SetBlock(12, 4, 12, 1);
+		world.SetBlock(12, 4, 13, 1);
+		world.SetBlock(12, 4, 14, 1);
+		world.SetBlock(12, 4, 15, 1);
+		world.SetBlock(12, 4, 16, 1);
+		world.SetBlock(12, 4, 17, 1);
+		world.SetBlock(12, 4, 18, 1);
+		world.SetBlock(12, 4, 19, 1);
+		world.SetBlock(12, 4, 20, 1);
+		world.SetBlock(12, 4, 28, 1);
+		world.SetBlock(12, 4, 29, 1);
+		world.SetBlock(12, 4, 30, 1);
+		world.SetBlock(13, 4, 1, 1);
+		world.SetBlock(13, 4, 2, 1);
+		world.SetBlock(13, 4, 3, 1);
+		world.SetBlock(13, 4, 9, 1);
+		world.SetBlock(13, 4, 10, 1);
+		world.SetBlock(13, 4, 11, 1);
+		world.SetBlock(13, 4, 12, 1);
+		world.SetBlock(13, 4, 13, 1);
+		world.SetBlock(13, 4, 14, 1);
+		world.SetBlock(13, 4, 15, 1);
+		world.SetBlock(13, 4, 16, 1);
+		world.SetBlock(13, 4, 19, 1);
+		world.SetBlock(13, 4, 20, 1);
+		world.SetBlock(13, 4, 21, 1);
+		world.SetBlock(13, 4, 28, 1);
+		world.SetBlock(13, 4, 29, 1);
+		world.SetBlock(13, 4, 30, 1);
+		world.SetBlock(14, 4, 1, 1);
+		world.SetBlock(14, 4, 2, 1);
+		world.SetBlock(14, 4, 3, 1);
+		world.SetBlock(14, 4, 8, 1);
+		world.SetBlock(14, 4, 9, 1);
+		world.SetBlock(14, 4, 10, 1);
+		world.SetBlock(14, 4, 11, 1);
+		world.SetBlock(14, 4, 12, 1);
+		world.SetBlock(14, 4, 13, 1);
+		world.SetBlock(14, 4, 14, 1);
+		world.SetBlock(14, 4, 20, 1);
+		world.SetBlock(14, 4, 21, 1);
+		world.SetBlock(14, 4, 28, 1);
+		world.SetBlock(14, 4, 29, 1);
+		world.SetBlock(14, 4, 30, 1);
+		world.SetBlock(15, 4, 1, 1);
+		world.SetBlock(15, 4, 2, 1);
+		world.SetBlock(15, 4, 8, 1);
+		world.SetBlock(15, 4, 9, 1);
+		world.SetBlock(15, 4, 10, 1);
+		world.SetBlock(15, 4, 11, 1);
+		world.SetBlock(15, 4, 12, 1);
+		world.SetBlock(15, 4, 13, 1);
+		world.SetBlock(15, 4, 20, 1);
+		world.SetBlock(15, 4, 21, 1);
+		world.SetBlock(15, 4, 22, 1);
+		world.SetBlock(15, 4, 29, 1);
+		world.SetBlock(15, 4, 30, 1);
+		world.SetBlock(16, 4, 1, 1);
+		world.SetBlock(16, 4, 2, 1);
+		world.SetBlock(16, 4, 8, 1);
+		world.SetBlock(16, 4, 9, 1);
+		world.SetBlock(16, 4, 10, 1);
+		world.SetBlock(16, 4, 11, 1);
+		world.SetBlock(16, 4, 12, 1);
+		world.SetBlock(16, 4, 21, 1);
+		world.SetBlock(16, 4, 22, 1);
+		world.SetBlock(16, 4, 29, 1);
+		world.SetBlock(16, 4, 30, 1);
+		world.SetBlock(17, 4, 1, 1);
+		world.SetBlock(17, 4, 9, 1);
+		world.SetBlock(17, 4, 10, 1);
+		world.SetBlock(17, 4, 21, 1);
+		world.SetBlock(17, 4, 22, 1);
+		world.SetBlock(17, 4, 30, 1);
+		world.SetBlock(18, 4, 1, 1);
+		world.SetBlock(18, 4, 10, 1);
+		world.SetBlock(18, 4, 11, 1);
+		world.SetBlock(18, 4, 12, 1);
+		world.SetBlock(18, 4, 22, 1);
+		world.SetBlock(18, 4, 23, 1);
+		world.SetBlock(18, 4, 30, 1);
+		world.SetBlock(19, 4, 1, 1);
+		world.SetBlock(19, 4, 10, 1);
+		world.SetBlock(19, 4, 11, 1);
+		world.SetBlock(19, 4, 12, 1);
+		world.SetBlock(19, 4, 13, 1);
+		world.SetBlock(19, 4, 14, 1);
+		world.SetBlock(19, 4, 15, 1);
+		world.SetBlock(19, 4, 16, 1);
+		world.SetBlock(19, 4, 22, 1);
+		world.SetBlock(19, 4, 23, 1);
+		world.SetBlock(19, 4, 30, 1);
+		world.SetBlock(20, 4, 1, 1);
+		world.SetBlock(20, 4, 11, 1);
+		world.SetBlock(20, 4, 12, 1);
+		world.SetBlock(20, 4, 13, 1);
+		world.SetBlock(20, 4, 14, 1);
+		world.SetBlock(20, 4, 15, 1);
+		world.SetBlock(20, 4, 16, 1);
+		world.SetBlock(20, 4, 17, 1);
+		world.SetBlock(20, 4, 18, 1);
+		world.SetBlock(20, 4, 19, 1);
+		world.SetBlock(20, 4, 20, 1);
+		world.SetBlock(20, 4, 21, 1);
+		world.SetBlock(20, 4, 22, 1);
+		world.SetBlock(20, 4, 23, 1);
+		world.SetBlock(20, 4, 30, 3);
+		world.SetBlock(21, 4, 1, 1);
+		world.SetBlock(21, 4, 2, 1);
+		world.SetBlock(21, 4, 13, 1);
+		world.SetBlock(21, 4, 14, 1);
+		world.SetBlock(21, 4, 15, 1);
+		world.SetBlock(21, 4, 16, 1);
+		world.SetBlock(21, 4, 17, 1);
+		world.SetBlock(21, 4, 18, 1);
+		world.SetBlock(21, 4, 19, 1);
+		world.SetBlock(21, 4, 20, 1);
+		world.SetBlock(21, 4, 21, 1);
+		world.SetBlock(21, 4, 22, 1);
+		world.SetBlock(21, 4, 30, 3);
+		world.SetBlock(22, 4, 1, 1);
+		world.SetBlock(22, 4, 2, 1);
+		world.SetBlock(22, 4, 15, 1);
+		world.SetBlock(22, 4, 16, 1);
+		world.SetBlock(22, 4, 17, 1);
+		world.SetBlock(22, 4, 18, 1);
+		world.SetBlock(22, 4, 19, 1);
+		world.SetBlock(22, 4, 30, 1);
+		world.SetBlock(23, 4, 1, 1);
+		world.SetBlock(23, 4, 2, 1);
+		world.SetBlock(23, 4, 3, 1);
+		world.SetBlock(23, 4, 30, 1);
+		world.SetBlock(24, 4, 1, 1);
+		world.SetBlock(24, 4, 2, 1);
+		world.SetBlock(24, 4, 3, 1);
+		world.SetBlock(24, 4, 30, 1);
+		world.SetBlock(25, 4, 1, 1);
+		world.SetBlock(25, 4, 2, 1);
+		world.SetBlock(25, 4, 3, 1);
+		world.SetBlock(25, 4, 4, 1);
+		world.SetBlock(25, 4, 29, 1);
+		world.SetBlock(25, 4, 30, 1);
+		world.SetBlock(26, 4, 1, 1);
+		world.SetBlock(26, 4, 2, 1);
+		world.SetBlock(26, 4, 3, 1);
+		world.SetBlock(26, 4, 4, 1);
+		world.SetBlock(26, 4, 5, 1);
+		world.SetBlock(26, 4, 29, 1);
+		world.SetBlock(26, 4, 30, 1);
+		world.SetBlock(27, 4, 1, 1);
+		world.SetBlock(27, 4, 2, 1);
+		world.SetBlock(27, 4, 3, 1);
+		world.SetBlock(27, 4, 4, 1);
+		world.SetBlock(27, 4, 5, 1);
+		world.SetBlock(27, 4, 6, 4);
+		world.SetBlock(27, 4, 7, 4);
+		world.SetBlock(27, 4, 8, 4);
+		world.SetBlock(27, 4, 29, 1);
+		world.SetBlock(27, 4, 30, 1);
+		world.SetBlock(28, 4, 1, 1);
+		world.SetBlock(28, 4, 2, 1);
+		world.SetBlock(28, 4, 3, 1);
+		world.SetBlock(28, 4, 4, 1);
+		world.SetBlock(28, 4, 5, 1);
+		world.SetBlock(28, 4, 6, 1);
+		world.SetBlock(28, 4, 7, 1);
+		world.SetBlock(28, 4, 8, 1);
+		world.SetBlock(28, 4, 9, 1);
+		world.SetBlock(28, 4, 10, 1);
+		world.SetBlock(28, 4, 28, 1);
+		world.SetBlock(28, 4, 29, 1);
+		world.SetBlock(28, 4, 30, 1);
+		world.SetBlock(29, 4, 1, 1);
+		world.SetBlock(29, 4, 10, 1);
+		world.SetBlock(29, 4, 11, 1);
+		world.SetBlock(29, 4, 12, 1);
+		world.SetBlock(29, 4, 13, 1);
+		world.SetBlock(29, 4, 14, 1);
+		world.SetBlock(29, 4, 15, 1);
+		world.SetBlock(29, 4, 16, 1);
+		world.SetBlock(29, 4, 17, 1);
+		world.SetBlock(29, 4, 24, 1);
+		world.SetBlock(29, 4, 25, 1);
+		world.SetBlock(29, 4, 26, 1);
+		world.SetBlock(29, 4, 27, 1);
+		world.SetBlock(29, 4, 28, 1);
+		world.SetBlock(29, 4, 29, 1);
+		world.SetBlock(29, 4, 30, 1);
+		world.SetBlock(30, 4, 1, 1);
+		world.SetBlock(30, 4, 13, 1);
+		world.SetBlock(30, 4, 14, 1);
+		world.SetBlock(30, 4, 18, 1);
+		world.SetBlock(30, 4, 19, 1);
+		world.SetBlock(30, 4, 20, 1);
+		world.SetBlock(30, 4, 21, 1);
+		world.SetBlock(30, 4, 22, 1);
+		world.SetBlock(30, 4, 23, 1);
+		world.SetBlock(30, 4, 24, 1);
+		world.SetBlock(30, 4, 25, 1);
+		world.SetBlock(30, 4, 26, 1);
+		world.SetBlock(30, 4, 27, 1);
+		world.SetBlock(30, 4, 28, 1);
+		world.SetBlock(30, 4, 29, 1);
+		world.SetBlock(30, 4, 30, 1);
+
+		world.SetBlock(1, 4, 8, 1);
+		world.SetBlock(1, 4, 9, 1);
+		world.SetBlock(1, 4, 10, 1);
+		world.SetBlock(1, 4, 11, 1);
+		world.SetBlock(1, 4, 12, 1);
+		world.SetBlock(1, 4, 13, 1);
+		world.SetBlock(1, 4, 14, 1);
+		world.SetBlock(1, 4, 15, 1);
+		world.SetBlock(1, 4, 19, 1);
+		world.SetBlock(1, 4, 20, 1);
+		world.SetBlock(1, 4, 21, 1);
+		world.SetBlock(1, 4, 22, 1);
+		world.SetBlock(1, 4, 23, 1);
+		world.SetBlock(1, 4, 24, 1);
+		world.SetBlock(1, 4, 25, 1);
+		world.SetBlock(1, 4, 26, 1);
+		world.SetBlock(1, 4, 27, 1);
+		world.SetBlock(1, 4, 28, 1);
+		world.SetBlock(2, 4, 8, 1);
+		world.SetBlock(2, 4, 9, 1);
+		world.SetBlock(2, 4, 10, 1);
+		world.SetBlock(2, 4, 11, 1);
+		world.SetBlock(2, 4, 12, 1);
+		world.SetBlock(2, 4, 13, 1);
+		world.SetBlock(2, 4, 14, 1);
+		world.SetBlock(2, 4, 21, 1);
+		world.SetBlock(2, 4, 22, 1);
+		world.SetBlock(2, 4, 23, 1);
+		world.SetBlock(2, 4, 24, 1);
+		world.SetBlock(2, 4, 25, 1);
+		world.SetBlock(2, 4, 26, 1);
+		world.SetBlock(2, 4, 27, 1);
+		world.SetBlock(2, 4, 28, 1);
+		world.SetBlock(2, 4, 29, 1);
+		world.SetBlock(3, 4, 5, 1);
+		world.SetBlock(3, 4, 6, 1);
+		world.SetBlock(3, 4, 7, 1);
+		world.SetBlock(3, 4, 8, 1);
+		world.SetBlock(3, 4, 9, 1);
+		world.SetBlock(3, 4, 10, 1);
+		world.SetBlock(3, 4, 11, 1);
+		world.SetBlock(3, 4, 12, 1);
+		world.SetBlock(3, 4, 13, 1);
+		world.SetBlock(3, 4, 22, 1);
+		world.SetBlock(3, 4, 23, 1);
+		world.SetBlock(3, 4, 24, 1);
+		world.SetBlock(3, 4, 25, 1);
+		world.SetBlock(3, 4, 26, 1);
+		world.SetBlock(3, 4, 27, 1);
+		world.SetBlock(3, 4, 28, 1);
+		world.SetBlock(3, 4, 29, 1);
+		world.SetBlock(4, 4, 4, 1);
+		world.SetBlock(4, 4, 5, 1);
+		world.SetBlock(4, 4, 6, 1);
+		world.SetBlock(4, 4, 7, 1);
+		world.SetBlock(4, 4, 8, 1);
+		world.SetBlock(4, 4, 9, 1);
+		world.SetBlock(4, 4, 10, 1);
+		world.SetBlock(4, 4, 23, 1);
+		world.SetBlock(4, 4, 24, 1);
+		world.SetBlock(4, 4, 25, 1);
+		world.SetBlock(4, 4, 26, 1);
+		world.SetBlock(4, 4, 27, 1);
+		world.SetBlock(4, 4, 28, 1);
+		world.SetBlock(4, 4, 29, 1);
+		world.SetBlock(4, 4, 30, 1);
+		world.SetBlock(5, 4, 3, 1);
+		world.SetBlock(5, 4, 4, 1);
+		world.SetBlock(5, 4, 5, 1);
+		world.SetBlock(5, 4, 6, 1);
+		world.SetBlock(5, 4, 7, 1);
+		world.SetBlock(5, 4, 8, 1);
+		world.SetBlock(5, 4, 9, 1);
+		world.SetBlock(5, 4, 25, 1);
+		world.SetBlock(5, 4, 26, 1);
+		world.SetBlock(5, 4, 27, 1);
+		world.SetBlock(5, 4, 28, 1);
+		world.SetBlock(5, 4, 29, 1);
+		world.SetBlock(5, 4, 30, 1);
+		world.SetBlock(6, 4, 3, 1);
+		world.SetBlock(6, 4, 4, 1);
+		world.SetBlock(6, 4, 5, 1);
+		world.SetBlock(6, 4, 6, 1);
+		world.SetBlock(6, 4, 7, 1);
+		world.SetBlock(6, 4, 8, 1);
+		world.SetBlock(6, 4, 25, 1);
+		world.SetBlock(6, 4, 26, 1);
+		world.SetBlock(6, 4, 27, 1);
+		world.SetBlock(6, 4, 28, 1);
+		world.SetBlock(6, 4, 29, 1);
+		world.SetBlock(6, 4, 30, 1);
+		world.SetBlock(7, 4, 3, 1);
+		world.SetBlock(7, 4, 4, 1);
+		world.SetBlock(7, 4, 5, 1);
+		world.SetBlock(7, 4, 6, 1);
+		world.SetBlock(7, 4, 7, 1);
+		world.SetBlock(7, 4, 13, 2);
+		world.SetBlock(7, 4, 14, 2);
+		world.SetBlock(7, 4, 15, 1);
+		world.SetBlock(7, 4, 26, 1);
+		world.SetBlock(7, 4, 27, 1);
+		world.SetBlock(7, 4, 28, 1);
+		world.SetBlock(7, 4, 29, 1);
+		world.SetBlock(7, 4, 30, 1);
+		world.SetBlock(8, 4, 2, 1);
+		world.SetBlock(8, 4, 3, 1);
+		world.SetBlock(8, 4, 4, 1);
+		world.SetBlock(8, 4, 5, 1);
+		world.SetBlock(8, 4, 6, 1);
+		world.SetBlock(8, 4, 7, 1);
+		world.SetBlock(8, 4, 12, 2);
+		world.SetBlock(8, 4, 13, 2);
+		world.SetBlock(8, 4, 14, 1);
+		world.SetBlock(8, 4, 15, 1);
+		world.SetBlock(8, 4, 16, 1);
+		world.SetBlock(8, 4, 27, 1);
+		world.SetBlock(8, 4, 28, 1);
+		world.SetBlock(8, 4, 29, 1);
+		world.SetBlock(8, 4, 30, 1);
+		world.SetBlock(9, 4, 2, 1);
+		world.SetBlock(9, 4, 3, 1);
+		world.SetBlock(9, 4, 4, 1);
+		world.SetBlock(9, 4, 5, 1);
+		world.SetBlock(9, 4, 6, 1);
+		world.SetBlock(9, 4, 10, 2);
+		world.SetBlock(9, 4, 11, 2);
+		world.SetBlock(9, 4, 12, 2);
+		world.SetBlock(9, 4, 13, 1);
+		world.SetBlock(9, 4, 14, 1);
+		world.SetBlock(9, 4, 15, 1);
+		world.SetBlock(9, 4, 16, 1);
+		world.SetBlock(9, 4, 17, 1);
+		world.SetBlock(9, 4, 18, 1);
+		world.SetBlock(9, 4, 19, 1);
+		world.SetBlock(9, 4, 27, 1);
+		world.SetBlock(9, 4, 28, 1);
+		world.SetBlock(9, 4, 29, 1);
+		world.SetBlock(9, 4, 30, 1);
+		world.SetBlock(10, 4, 1, 1);
+		world.SetBlock(10, 4, 2, 1);
+		world.SetBlock(10, 4, 3, 1);
+		world.SetBlock(10, 4, 4, 1);
+		world.SetBlock(10, 4, 5, 1);
+		world.SetBlock(10, 4, 10, 2);
+		world.SetBlock(10, 4, 11, 1);
+		world.SetBlock(10, 4, 12, 1);
+		world.SetBlock(10, 4, 13, 1);
+		world.SetBlock(10, 4, 14, 1);
+		world.SetBlock(10, 4, 15, 1);
+		world.SetBlock(10, 4, 16, 1);
+		world.SetBlock(10, 4, 17, 1);
+		world.SetBlock(10, 4, 18, 1);
+		world.SetBlock(10, 4, 19, 1);
+		world.SetBlock(10, 4, 27, 1);
+		world.SetBlock(10, 4, 28, 1);
+		world.SetBlock(10, 4, 29, 1);
+		world.SetBlock(10, 4, 30, 1);
+		world.SetBlock(11, 4, 1, 1);
+		world.SetBlock(11, 4, 2, 1);
+		world.SetBlock(11, 4, 3, 1);
+		world.SetBlock(11, 4, 4, 1);
+		world.SetBlock(11, 4, 10, 1);
+		world.SetBlock(11, 4, 11, 1);
+		world.SetBlock(11, 4, 12, 1);
+		world.SetBlock(11, 4, 13, 1);
+		world.SetBlock(11, 4, 14, 1);
+		world.SetBlock(11, 4, 15, 1);
+		world.SetBlock(11, 4, 16, 1);
+		world.SetBlock(11, 4, 17, 1);
+		world.SetBlock(11, 4, 18, 1);
+		world.SetBlock(11, 4, 19, 1);
+		world.SetBlock(11, 4, 20, 1);
+		world.SetBlock(11, 4, 27, 1);
+		world.SetBlock(11, 4, 28, 1);
+		world.SetBlock(11, 4, 29, 1);
+		world.SetBlock(11, 4, 30, 1);
+		world.SetBlock(12, 4, 1, 1);
+		world.SetBlock(12, 4, 2, 1);
+		world.SetBlock(12, 4, 3, 1);
+		world.SetBlock(12, 4, 9, 1);
+		world.SetBlock(12, 4, 10, 1);
+		world.SetBlock(12, 4, 11, 1);
+		world.SetBlock(12, 4, 12, 1);
+		world.SetBlock(12, 4, 13, 1);
+		world.SetBlock(12, 4, 14, 1);
+		world.SetBlock(12, 4, 15, 1);
+		world.SetBlock(12, 4, 16, 1);
+		world.SetBlock(12, 4, 17, 1);
+		world.SetBlock(12, 4, 18, 1);
+		world.SetBlock(12, 4, 19, 1);
+		world.SetBlock(12, 4, 20, 1);
+		world.SetBlock(12, 4, 28, 1);
+		world.SetBlock(12, 4, 29, 1);
+		world.SetBlock(12, 4, 30, 1);
+		world.SetBlock(13, 4, 1, 1);
+		world.SetBlock(13, 4, 2, 1);
+		world.SetBlock(13, 4, 3, 1);
+		world.SetBlock(13, 4, 9, 1);
+		world.SetBlock(13, 4, 10, 1);
+		world.SetBlock(13, 4, 11, 1);
+		world.SetBlock(13, 4, 12, 1);
+		world.SetBlock(13, 4, 13, 1);
+		world.SetBlock(13, 4, 14, 1);
+		world.SetBlock(13, 4, 15, 1);
+		world.SetBlock(13, 4, 16, 1);
+		world.SetBlock(13, 4, 19, 1);
+		world.SetBlock(13, 4, 20, 1);
+		world.SetBlock(13, 4, 21, 1);
+		world.SetBlock(13, 4, 28, 1);
+		world.SetBlock(13, 4, 29, 1);
+		world.SetBlock(13, 4, 30, 1);
+		world.SetBlock(14, 4, 1, 1);
+		world.SetBlock(14, 4, 2, 1);
+		world.SetBlock(14, 4, 3, 1);
+		world.SetBlock(14, 4, 8, 1);
+		world.SetBlock(14, 4, 9, 1);
+		world.SetBlock(14, 4, 10, 1);
+		world.SetBlock(14, 4, 11, 1);
+		world.SetBlock(14, 4, 12, 1);
+		world.SetBlock(14, 4, 13, 1);
+		world.SetBlock(14, 4, 14, 1);
+		world.SetBlock(14, 4, 20, 1);
+		world.SetBlock(14, 4, 21, 1);
+		world.SetBlock(14, 4, 28, 1);
+		world.SetBlock(14, 4, 29, 1);
+		world.SetBlock(14, 4, 30, 1);
+		world.SetBlock(15, 4, 1, 1);
+		world.SetBlock(15, 4, 2, 1);
+		world.SetBlock(15, 4, 8, 1);
+		world.SetBlock(15, 4, 9, 1);
+		world.SetBlock(15, 4, 10, 1);
+		world.SetBlock(15, 4, 11, 1);
+		world.SetBlock(15, 4, 12, 1);
+		world.SetBlock(15, 4, 13, 1);
+		world.SetBlock(15, 4, 20, 1);
+		world.SetBlock(15, 4, 21, 1);
+		world.SetBlock(15, 4, 22, 1);
+		world.SetBlock(15, 4, 29, 1);
+		world.SetBlock(15, 4, 30, 1);
+		world.SetBlock(16, 4, 1, 1);
+		world.SetBlock(16, 4, 2, 1);
+		world.SetBlock(16, 4, 8, 1);
+		world.SetBlock(16, 4, 9, 1);
+		world.SetBlock(16, 4, 10, 1);
+		world.SetBlock(16, 4, 11, 1);
+		world.SetBlock(16, 4, 12, 1);
+		world.SetBlock(16, 4, 21, 1);
+		world.SetBlock(16, 4, 22, 1);
+		world.SetBlock(16, 4, 29, 1);
+		world.SetBlock(16, 4, 30, 1);
+		world.SetBlock(17, 4, 1, 1);
+		world.SetBlock(17, 4, 9, 1);
+		world.SetBlock(17, 4, 10, 1);
+		world.SetBlock(17, 4, 21, 1);
+		world.SetBlock(17, 4, 22, 1);
+		world.SetBlock(17, 4, 30, 1);
+		world.SetBlock(18, 4, 1, 1);
+		world.SetBlock(18, 4, 10, 1);
+		world.SetBlock(18, 4, 11, 1);
+		world.SetBlock(18, 4, 12, 1);
+		world.SetBlock(18, 4, 22, 1);
+		world.SetBlock(18, 4, 23, 1);
+		world.SetBlock(18, 4, 30, 1);
+		world.SetBlock(19, 4, 1, 1);
+		world.SetBlock(19, 4, 10, 1);
+		world.SetBlock(19, 4, 11, 1);
+		world.SetBlock(19, 4, 12, 1);
+		world.SetBlock(19, 4, 13, 1);
+		world.SetBlock(19, 4, 14, 1);
+		world.SetBlock(19, 4, 15, 1);
+		world.SetBlock(19, 4, 16, 1);
+		world.SetBlock(19, 4, 22, 1);
+		world.SetBlock(19, 4, 23, 1);
+		world.SetBlock(19, 4, 30, 1);
+		world.SetBlock(20, 4, 1, 1);
+		world.SetBlock(20, 4, 11, 1);
+		world.SetBlock(20, 4, 12, 1);
+		world.SetBlock(20, 4, 13, 1);
+		world.SetBlock(20, 4, 14, 1);
+		world.SetBlock(20, 4, 15, 1);
+		world.SetBlock(20, 4, 16, 1);
+		world.SetBlock(20, 4, 17, 1);
+		world.SetBlock(20, 4, 18, 1);
+		world.SetBlock(20, 4, 19, 1);
+		world.SetBlock(20, 4, 20, 1);
+		world.SetBlock(20, 4, 21, 1);
+		world.SetBlock(20, 4, 22, 1);
+		world.SetBlock(20, 4, 23, 1);
+		world.SetBlock(20, 4, 30, 3);
+		world.SetBlock(21, 4, 1, 1);
+		world.SetBlock(21, 4, 2, 1);
+		world.SetBlock(21, 4, 13, 1);
+		world.SetBlock(21, 4, 14, 1);
+		world.SetBlock(21, 4, 15, 1);
+		world.SetBlock(21, 4, 16, 1);
+		world.SetBlock(21, 4, 17, 1);
+		world.SetBlock(21, 4, 18, 1);
+		world.SetBlock(21, 4, 19, 1);
+		world.SetBlock(21, 4, 20, 1);
+		world.SetBlock(21, 4, 21, 1);
+		world.SetBlock(21, 4, 22, 1);
+		world.SetBlock(21, 4, 30, 3);
+		world.SetBlock(22, 4, 1, 1);
+		world.SetBlock(22, 4, 2, 1);
+		world.SetBlock(22, 4, 15, 1);
+		world.SetBlock(22, 4, 16, 1);
+		world.SetBlock(22, 4, 17, 1);
+		world.SetBlock(22, 4, 18, 1);
+		world.SetBlock(22, 4, 19, 1);
+		world.SetBlock(22, 4, 30, 1);
+		world.SetBlock(23, 4, 1, 1);
+		world.SetBlock(23, 4, 2, 1);
+		world.SetBlock(23, 4, 3, 1);
+		world.SetBlock(23, 4, 30, 1);
+		world.SetBlock(24, 4, 1, 1);
+		world.SetBlock(24, 4, 2, 1);
+		world.SetBlock(24, 4, 3, 1);
+		world.SetBlock(24, 4, 30, 1);
+		world.SetBlock(25, 4, 1, 1);
+		world.SetBlock(25, 4, 2, 1);
+		world.SetBlock(25, 4, 3, 1);
+		world.SetBlock(25, 4, 4, 1);
+		world.SetBlock(25, 4, 29, 1);
+		world.SetBlock(25, 4, 30, 1);
+		world.SetBlock(26, 4, 1, 1);
+		world.SetBlock(26, 4, 2, 1);
+		world.SetBlock(26, 4, 3, 1);
+		world.SetBlock(26, 4, 4, 1);
+		world.SetBlock(26, 4, 5, 1);
+		world.SetBlock(26, 4, 29, 1);
+		world.SetBlock(26, 4, 30, 1);
+		world.SetBlock(27, 4, 1, 1);
+		world.SetBlock(27, 4, 2, 1);
+		world.SetBlock(27, 4, 3, 1);
+		world.SetBlock(27, 4, 4, 1);
+		world.SetBlock(27, 4, 5, 1);
+		world.SetBlock(27, 4, 6, 4);
+		world.SetBlock(27, 4, 7, 4);
+		world.SetBlock(27, 4, 8, 4);
+		world.SetBlock(27, 4, 29, 1);
+		world.SetBlock(27, 4, 30, 1);
+		world.SetBlock(28, 4, 1, 1);
+		world.SetBlock(28, 4, 2, 1);
+		world.SetBlock(28, 4, 3, 1);
+		world.SetBlock(28, 4, 4, 1);
+		world.SetBlock(28, 4, 5, 1);
+		world.SetBlock(28, 4, 6, 1);
+		world.SetBlock(28, 4, 7, 1);
+		world.SetBlock(28, 4, 8, 1);
+		world.SetBlock(28, 4, 9, 1);
+		world.SetBlock(28, 4, 10, 1);
+		world.SetBlock(28, 4, 28, 1);
+		world.SetBlock(28, 4, 29, 1);
+		world.SetBlock(28, 4, 30, 1);
+		world.SetBlock(29, 4, 1, 1);
+		world.SetBlock(29, 4, 10, 1);
+		world.SetBlock(29, 4, 11, 1);
+		world.SetBlock(29, 4, 12, 1);
+		world.SetBlock(29, 4, 13, 1);
+		world.SetBlock(29, 4, 14, 1);
+		world.SetBlock(29, 4, 15, 1);
+		world.SetBlock(29, 4, 16, 1);
+		world.SetBlock(29, 4, 17, 1);
+		world.SetBlock(29, 4, 24, 1);
+		world.SetBlock(29, 4, 25, 1);
+		world.SetBlock(29, 4, 26, 1);
+		world.SetBlock(29, 4, 27, 1);
+		world.SetBlock(29, 4, 28, 1);
+		world.SetBlock(29, 4, 29, 1);
+		world.SetBlock(29, 4, 30, 1);
+		world.SetBlock(30, 4, 1, 1);
+		world.SetBlock(30, 4, 13, 1);
+		world.SetBlock(30, 4, 14, 1);
+		world.SetBlock(30, 4, 18, 1);
+		world.SetBlock(30, 4, 19, 1);
+		world.SetBlock(30, 4, 20, 1);
+		world.SetBlock(30, 4, 21, 1);
+		world.SetBlock(30, 4, 22, 1);
+		world.SetBlock(30, 4, 23, 1);
+		world.SetBlock(30, 4, 24, 1);
+		world.SetBlock(30, 4, 25, 1);
+		world.SetBlock(30, 4, 26, 1);
+		world.SetBlock(30, 4, 27, 1);
+		world.SetBlock(30, 4, 28, 1);
+		world.SetBlock(30, 4, 29, 1);
+		world.SetBlock(30, 4, 30, 1);
+	}
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "World.hpp"
+
+namespace Voxels
+{
+	// The 32x6x32 level that used to be compiled into Application::LoadMap.
+	// Only the map exporter needs it; the game loads the exported world file.
+	class BuiltinMap
+	{
+		private:
+			static constexpr int SIZE_X = 32;
+			static constexpr int SIZE_Y = 32;
+			static constexpr int SIZE_Z = 6;
+		public:
+			static void Build(World& world);
+	};
+}
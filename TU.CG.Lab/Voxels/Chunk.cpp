@@ -0,0 +1,32 @@
+#include "Chunk.hpp"
+
+#include <algorithm>
+
+namespace Voxels
+{
+	Chunk::Chunk(const glm::ivec3& coord)
+		: coord(coord)
+	{
+	}
+
+	void Chunk::SetBlock(const int x, const int y, const int z, const BlockType type)
+	{
+		const auto previousType = blocks.Set(GetIndex(x, y, z), type);
+
+		if (previousType == type)
+			return;
+
+		if (previousType == Blocks::AIR)
+			++solidCount;
+		else if (type == Blocks::AIR)
+			--solidCount;
+	}
+
+	void Chunk::SetBlocks(const std::array<BlockType, CHUNK_VOLUME>& input)
+	{
+		blocks.Assign(input.data());
+
+		solidCount = static_cast<int>(
+			std::count_if(input.begin(), input.end(), [](const BlockType type) { return type != Blocks::AIR; }));
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <glm/glm.hpp>
+
+#include "BlockType.hpp"
+#include "PaletteStorage.hpp"
+
+namespace Voxels
+{
+	constexpr int CHUNK_SIZE = 16;
+	constexpr int CHUNK_VOLUME = CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE;
+
+	class Chunk
+	{
+		private:
+			glm::ivec3 coord;
+			PaletteStorage blocks{ CHUNK_VOLUME };
+			int solidCount = 0;
+		public:
+			explicit Chunk(const glm::ivec3& coord);
+
+			void SetBlock(int x, int y, int z, BlockType type);
+			// Replaces all blocks, given in GetIndex order.
+			void SetBlocks(const std::array<BlockType, CHUNK_VOLUME>& input);
+
+			[[nodiscard]] BlockType GetBlock(const int x, const int y, const int z) const
+			{
+				return blocks.Get(GetIndex(x, y, z));
+			}
+
+			// Decodes all blocks in GetIndex order; cheaper than GetBlock per block.
+			void CopyBlocks(std::array<BlockType, CHUNK_VOLUME>& output) const { blocks.CopyTo(output.data()); }
+			// Drops palette entries no longer in use, narrowing the stored indices.
+			void Compact() { blocks.Compact(); }
+
+			[[nodiscard]] const PaletteStorage& GetStorage() const { return blocks; }
+
+			[[nodiscard]] glm::ivec3 GetCoord() const { return coord; }
+			[[nodiscard]] glm::ivec3 GetOrigin() const { return coord * CHUNK_SIZE; }
+			[[nodiscard]] bool IsEmpty() const { return solidCount == 0; }
+			[[nodiscard]] int GetSolidCount() const { return solidCount; }
+
+			[[nodiscard]] static int GetIndex(const int x, const int y, const int z)
+			{
+				return x + CHUNK_SIZE * (z + CHUNK_SIZE * y);
+			}
+	};
+}
@@ -0,0 +1,267 @@
+#include "ChunkMesher.hpp"
+
+#include <algorithm>
+
+#include "BlockRegistry.hpp"
+
+namespace Voxels
+{
+	namespace
+	{
+		struct Quad
+		{
+			BlockType type;
+			int axis;
+			bool positive;
+			int slice;
+			int u;
+			int v;
+			int width;
+			int height;
+		};
+
+		void CopyChunkBorder(
+			ChunkNeighbourhood& neighbourhood, const Chunk* neighbour,
+			const int axis, const int direction)
+		{
+			if (neighbour == nullptr)
+				return;
+
+			// The neighbour's layer facing us, written just outside our bounds.
+			const auto sourceLayer = direction > 0 ? 0 : CHUNK_SIZE - 1;
+			const auto targetLayer = direction > 0 ? CHUNK_SIZE : -1;
+
+			for (int a = 0; a < CHUNK_SIZE; ++a)
+			{
+				for (int b = 0; b < CHUNK_SIZE; ++b)
+				{
+					glm::ivec3 source(0);
+					glm::ivec3 target(0);
+
+					source[axis] = sourceLayer;
+					target[axis] = targetLayer;
+					source[(axis + 1) % 3] = a;
+					target[(axis + 1) % 3] = a;
+					source[(axis + 2) % 3] = b;
+					target[(axis + 2) % 3] = b;
+
+					neighbourhood.SetBlock(
+						target.x, target.y, target.z,
+						neighbour->GetBlock(source.x, source.y, source.z));
+				}
+			}
+		}
+
+		void EmitQuad(ChunkMeshData& mesh, const Quad& quad)
+		{
+			const auto u = (quad.axis + 1) % 3;
+			const auto v = (quad.axis + 2) % 3;
+
+			// Blocks are centred on integer positions, so faces sit on half units.
+			glm::vec3 origin(0.0f);
+			origin[quad.axis] = static_cast<float>(quad.slice + (quad.positive ? 1 : 0)) - 0.5f;
+			origin[u] = static_cast<float>(quad.u) - 0.5f;
+			origin[v] = static_cast<float>(quad.v) - 0.5f;
+
+			glm::vec3 normal(0.0f);
+			normal[quad.axis] = quad.positive ? 1.0f : -1.0f;
+
+			constexpr int cornerU[] = { 0, 1, 1, 0 };
+			constexpr int cornerV[] = { 0, 0, 1, 1 };
+			constexpr int positiveOrder[] = { 0, 1, 2, 3 };
+			constexpr int negativeOrder[] = { 0, 3, 2, 1 };
+
+			const auto order = quad.positive ? positiveOrder : negativeOrder;
+			const auto firstVertex = static_cast<unsigned>(mesh.vertices.size());
+			const auto layer = BlockRegistry::GetMaterialLayer(quad.type);
+
+			for (int i = 0; i < 4; ++i)
+			{
+				const auto corner = order[i];
+
+				glm::vec3 offset(0.0f);
+				offset[u] = static_cast<float>(cornerU[corner] * quad.width);
+				offset[v] = static_cast<float>(cornerV[corner] * quad.height);
+
+				// Side faces keep the texture upright; GL_REPEAT tiles merged quads.
+				glm::vec2 texCoords;
+
+				if (quad.axis == 0)
+					texCoords = glm::vec2(offset.z, offset.y);
+				else if (quad.axis == 1)
+					texCoords = glm::vec2(offset.x, offset.z);
+				else
+					texCoords = glm::vec2(offset.x, offset.y);
+
+				mesh.vertices.push_back({ origin + offset, normal, texCoords, layer });
+			}
+
+			constexpr unsigned quadIndices[] = { 0, 1, 2, 2, 3, 0 };
+
+			for (const auto index : quadIndices)
+				mesh.indices.push_back(firstVertex + index);
+		}
+	}
+
+	ChunkNeighbourhood ChunkMesher::Gather(const World& world, const glm::ivec3& chunkCoord)
+	{
+		ChunkNeighbourhood neighbourhood;
+		neighbourhood.coord = chunkCoord;
+
+		if (const auto chunk = world.GetChunk(chunkCoord))
+		{
+			std::array<BlockType, CHUNK_VOLUME> blocks;
+			chunk->CopyBlocks(blocks);
+
+			// Both layouts run x fastest, so each row is one contiguous copy.
+			for (int y = 0; y < CHUNK_SIZE; ++y)
+				for (int z = 0; z < CHUNK_SIZE; ++z)
+				{
+					std::copy_n(
+						blocks.begin() + Chunk::GetIndex(0, y, z), CHUNK_SIZE,
+						neighbourhood.blocks.begin() + ChunkNeighbourhood::GetIndex(0, y, z));
+				}
+		}
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			for (const auto direction : { -1, 1 })
+			{
+				auto neighbourCoord = chunkCoord;
+				neighbourCoord[axis] += direction;
+
+				CopyChunkBorder(
+					neighbourhood, world.GetChunk(neighbourCoord), axis, direction);
+			}
+		}
+
+		return neighbourhood;
+	}
+
+	ChunkNeighbourhood ChunkMesher::Gather(const IBlockVolume& volume, const glm::ivec3& chunkCoord)
+	{
+		ChunkNeighbourhood neighbourhood;
+		neighbourhood.coord = chunkCoord;
+
+		const auto origin = chunkCoord * CHUNK_SIZE;
+
+		for (int y = -1; y <= CHUNK_SIZE; ++y)
+			for (int z = -1; z <= CHUNK_SIZE; ++z)
+				for (int x = -1; x <= CHUNK_SIZE; ++x)
+					neighbourhood.SetBlock(x, y, z, volume.GetBlock(origin.x + x, origin.y + y, origin.z + z));
+
+		return neighbourhood;
+	}
+
+	ChunkMeshData ChunkMesher::Build(const ChunkNeighbourhood& neighbourhood)
+	{
+		std::vector<Quad> quads;
+		std::array<BlockType, CHUNK_SIZE * CHUNK_SIZE> mask{};
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			const auto u = (axis + 1) % 3;
+			const auto v = (axis + 2) % 3;
+
+			for (const auto positive : { false, true })
+			{
+				for (int slice = 0; slice < CHUNK_SIZE; ++slice)
+				{
+					for (int j = 0; j < CHUNK_SIZE; ++j)
+					{
+						for (int i = 0; i < CHUNK_SIZE; ++i)
+						{
+							glm::ivec3 position;
+							position[axis] = slice;
+							position[u] = i;
+							position[v] = j;
+
+							auto next = position;
+							next[axis] += positive ? 1 : -1;
+
+							const auto block = neighbourhood.GetBlock(
+								position.x, position.y, position.z);
+
+							const auto isExposed = block != Blocks::AIR &&
+								neighbourhood.GetBlock(next.x, next.y, next.z) == Blocks::AIR;
+
+							mask[i + j * CHUNK_SIZE] = isExposed ? block : Blocks::AIR;
+						}
+					}
+
+					for (int j = 0; j < CHUNK_SIZE; ++j)
+					{
+						for (int i = 0; i < CHUNK_SIZE;)
+						{
+							const auto type = mask[i + j * CHUNK_SIZE];
+
+							if (type == Blocks::AIR)
+							{
+								++i;
+								continue;
+							}
+
+							auto width = 1;
+
+							while (i + width < CHUNK_SIZE && mask[i + width + j * CHUNK_SIZE] == type)
+								++width;
+
+							auto height = 1;
+
+							for (; j + height < CHUNK_SIZE; ++height)
+							{
+								const auto row = mask.begin() + i + (j + height) * CHUNK_SIZE;
+
+								if (std::any_of(row, row + width, [type](const BlockType other) { return other != type; }))
+									break;
+							}
+
+							for (int h = 0; h < height; ++h)
+								std::fill_n(mask.begin() + i + (j + h) * CHUNK_SIZE, width, Blocks::AIR);
+
+							quads.push_back({ type, axis, positive, slice, i, j, width, height });
+
+							i += width;
+						}
+					}
+				}
+			}
+		}
+
+		ChunkMeshData mesh;
+		mesh.coord = neighbourhood.coord;
+		mesh.vertices.reserve(quads.size() * 4);
+		mesh.indices.reserve(quads.size() * 6);
+
+		for (const auto& quad : quads)
+			EmitQuad(mesh, quad);
+
+		return mesh;
+	}
+
+	size_t ChunkMesher::CountVisibleFaces(const ChunkNeighbourhood& neighbourhood)
+	{
+		size_t faceCount = 0;
+
+		for (int y = 0; y < CHUNK_SIZE; ++y)
+		{
+			for (int z = 0; z < CHUNK_SIZE; ++z)
+			{
+				for (int x = 0; x < CHUNK_SIZE; ++x)
+				{
+					if (neighbourhood.GetBlock(x, y, z) == Blocks::AIR)
+						continue;
+
+					faceCount += neighbourhood.GetBlock(x - 1, y, z) == Blocks::AIR;
+					faceCount += neighbourhood.GetBlock(x + 1, y, z) == Blocks::AIR;
+					faceCount += neighbourhood.GetBlock(x, y - 1, z) == Blocks::AIR;
+					faceCount += neighbourhood.GetBlock(x, y + 1, z) == Blocks::AIR;
+					faceCount += neighbourhood.GetBlock(x, y, z - 1) == Blocks::AIR;
+					faceCount += neighbourhood.GetBlock(x, y, z + 1) == Blocks::AIR;
+				}
+			}
+		}
+
+		return faceCount;
+	}
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "BlockType.hpp"
+#include "Chunk.hpp"
+#include "IBlockVolume.hpp"
+#include "World.hpp"
+
+namespace Voxels
+{
+	constexpr int PADDED_CHUNK_SIZE = CHUNK_SIZE + 2;
+
+	struct ChunkVertex
+	{
+		glm::vec3 Position;
+		glm::vec3 Normal;
+		glm::vec2 TexCoords;
+		int Layer;
+	};
+
+	struct ChunkMeshData
+	{
+		glm::ivec3 coord = glm::ivec3(0);
+		std::vector<ChunkVertex> vertices;
+		std::vector<unsigned> indices;
+
+		[[nodiscard]] bool IsEmpty() const { return indices.empty(); }
+		[[nodiscard]] size_t GetTriangleCount() const { return indices.size() / 3; }
+	};
+
+	// The blocks of one chunk plus a one block border copied from its face
+	// neighbours, so meshing never has to touch the World.
+	struct ChunkNeighbourhood
+	{
+		glm::ivec3 coord = glm::ivec3(0);
+		std::array<BlockType, PADDED_CHUNK_SIZE * PADDED_CHUNK_SIZE * PADDED_CHUNK_SIZE> blocks{};
+
+		[[nodiscard]] BlockType GetBlock(const int x, const int y, const int z) const
+		{
+			return blocks[GetIndex(x, y, z)];
+		}
+
+		void SetBlock(const int x, const int y, const int z, const BlockType type)
+		{
+			blocks[GetIndex(x, y, z)] = type;
+		}
+
+		[[nodiscard]] static int GetIndex(const int x, const int y, const int z)
+		{
+			return (x + 1) + PADDED_CHUNK_SIZE * ((z + 1) + PADDED_CHUNK_SIZE * (y + 1));
+		}
+	};
+
+	class ChunkMesher
+	{
+		public:
+			[[nodiscard]] static ChunkNeighbourhood Gather(
+				const World& world, const glm::ivec3& chunkCoord);
+			// Any other backend, read block by block.
+			[[nodiscard]] static ChunkNeighbourhood Gather(
+				const IBlockVolume& volume, const glm::ivec3& chunkCoord);
+
+			[[nodiscard]] static ChunkMeshData Build(const ChunkNeighbourhood& neighbourhood);
+
+			[[nodiscard]] static ChunkMeshData Build(
+				const World& world, const glm::ivec3& chunkCoord)
+			{
+				return Build(Gather(world, chunkCoord));
+			}
+
+			[[nodiscard]] static size_t CountVisibleFaces(const ChunkNeighbourhood& neighbourhood);
+	};
+}
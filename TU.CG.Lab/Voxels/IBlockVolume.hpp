@@ -0,0 +1,27 @@
+#pragma once
+
+#include "BlockType.hpp"
+
+namespace Voxels
+{
+	// Read access to blocks in world coordinates, shared by the chunked World
+	// and the sparse voxel octree. Positions outside the volume read as air.
+	class IBlockVolume
+	{
+		protected:
+			IBlockVolume() = default;
+			IBlockVolume(const IBlockVolume& other) = default;
+			IBlockVolume& operator=(const IBlockVolume& other) = default;
+			IBlockVolume(IBlockVolume&& other) noexcept = default;
+			IBlockVolume& operator=(IBlockVolume&& other) noexcept = default;
+		public:
+			virtual ~IBlockVolume() = default;
+
+			[[nodiscard]] virtual BlockType GetBlock(int x, int y, int z) const = 0;
+
+			[[nodiscard]] bool IsSolid(const int x, const int y, const int z) const
+			{
+				return GetBlock(x, y, z) != Blocks::AIR;
+			}
+	};
+}
@@ -0,0 +1,182 @@
+#include "PaletteStorage.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace Voxels
+{
+	PaletteStorage::PaletteStorage(const size_t size, const BlockType initialType)
+		: palette{ initialType }, size(size)
+	{
+	}
+
+	BlockType PaletteStorage::Set(const size_t position, const BlockType type)
+	{
+		const auto previousType = Get(position);
+
+		if (previousType == type)
+			return previousType;
+
+		const auto index = static_cast<unsigned>(
+			std::find(palette.begin(), palette.end(), type) - palette.begin());
+
+		if (index == palette.size())
+		{
+			palette.push_back(type);
+
+			const auto neededBits = GetBitsForPaletteSize(palette.size());
+
+			if (neededBits > bitsPerIndex)
+			{
+				std::vector<unsigned> identity(palette.size());
+
+				for (unsigned i = 0; i < identity.size(); ++i)
+					identity[i] = i;
+
+				Repack(neededBits, identity);
+			}
+		}
+
+		SetIndex(position, index);
+
+		return previousType;
+	}
+
+	void PaletteStorage::Fill(const BlockType type)
+	{
+		palette.assign(1, type);
+		words.clear();
+		words.shrink_to_fit();
+		bitsPerIndex = 0;
+	}
+
+	void PaletteStorage::Assign(const BlockType* input)
+	{
+		std::array<int, 256> paletteIndex;
+		paletteIndex.fill(-1);
+
+		palette.clear();
+
+		for (size_t position = 0; position < size; ++position)
+		{
+			const auto type = input[position];
+
+			if (paletteIndex[type] < 0)
+			{
+				paletteIndex[type] = static_cast<int>(palette.size());
+				palette.push_back(type);
+			}
+		}
+
+		bitsPerIndex = GetBitsForPaletteSize(palette.size());
+		words.assign((size * bitsPerIndex + 63) / 64, 0);
+
+		if (bitsPerIndex == 0)
+			return;
+
+		for (size_t position = 0; position < size; ++position)
+		{
+			const auto bit = position * bitsPerIndex;
+			words[bit >> 6] |= static_cast<std::uint64_t>(paletteIndex[input[position]]) << (bit & 63);
+		}
+	}
+
+	void PaletteStorage::Compact()
+	{
+		std::vector<bool> used(palette.size(), false);
+
+		for (size_t position = 0; position < size; ++position)
+			used[GetIndex(position)] = true;
+
+		std::vector<BlockType> newPalette;
+		std::vector<unsigned> remap(palette.size(), 0);
+
+		for (size_t i = 0; i < palette.size(); ++i)
+		{
+			if (!used[i])
+				continue;
+
+			remap[i] = static_cast<unsigned>(newPalette.size());
+			newPalette.push_back(palette[i]);
+		}
+
+		if (newPalette.size() == palette.size())
+			return;
+
+		Repack(GetBitsForPaletteSize(newPalette.size()), remap);
+		palette = std::move(newPalette);
+	}
+
+	void PaletteStorage::CopyTo(BlockType* output) const
+	{
+		if (bitsPerIndex == 0)
+		{
+			std::fill_n(output, size, palette[0]);
+			return;
+		}
+
+		const auto indicesPerWord = 64 / bitsPerIndex;
+		const auto mask = (std::uint64_t(1) << bitsPerIndex) - 1;
+
+		size_t position = 0;
+
+		for (auto word : words)
+		{
+			const auto count = std::min<size_t>(indicesPerWord, size - position);
+
+			for (size_t i = 0; i < count; ++i, word >>= bitsPerIndex)
+				output[position + i] = palette[static_cast<size_t>(word & mask)];
+
+			position += count;
+		}
+	}
+
+	size_t PaletteStorage::GetMemoryUsage() const
+	{
+		return palette.capacity() * sizeof(BlockType) + words.capacity() * sizeof(std::uint64_t);
+	}
+
+	void PaletteStorage::SetIndex(const size_t position, const unsigned index)
+	{
+		if (bitsPerIndex == 0)
+			return;
+
+		const auto bit = position * bitsPerIndex;
+		const auto shift = bit & 63;
+		const auto mask = ((std::uint64_t(1) << bitsPerIndex) - 1) << shift;
+
+		auto& word = words[bit >> 6];
+		word = (word & ~mask) | (static_cast<std::uint64_t>(index) << shift);
+	}
+
+	void PaletteStorage::Repack(const unsigned newBitsPerIndex, const std::vector<unsigned>& remap)
+	{
+		std::vector<std::uint64_t> newWords((size * newBitsPerIndex + 63) / 64, 0);
+
+		if (newBitsPerIndex > 0)
+		{
+			for (size_t position = 0; position < size; ++position)
+			{
+				const auto bit = position * newBitsPerIndex;
+				newWords[bit >> 6] |= static_cast<std::uint64_t>(remap[GetIndex(position)]) << (bit & 63);
+			}
+		}
+
+		words = std::move(newWords);
+		bitsPerIndex = newBitsPerIndex;
+	}
+
+	unsigned PaletteStorage::GetBitsForPaletteSize(const size_t paletteSize)
+	{
+		if (paletteSize <= 1)
+			return 0;
+		if (paletteSize <= 2)
+			return 1;
+		if (paletteSize <= 4)
+			return 2;
+		if (paletteSize <= 16)
+			return 4;
+
+		return 8;
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "BlockType.hpp"
+
+namespace Voxels
+{
+	// Block types stored as indices into a small palette, bit-packed at 1, 2,
+	// 4 or 8 bits each; a single-entry palette needs no indices at all. New
+	// types widen the indices, Compact drops types that are no longer used.
+	class PaletteStorage
+	{
+		private:
+			std::vector<BlockType> palette;
+			std::vector<std::uint64_t> words;
+			size_t size;
+			unsigned bitsPerIndex = 0;
+
+			[[nodiscard]] unsigned GetIndex(const size_t position) const
+			{
+				if (bitsPerIndex == 0)
+					return 0;
+
+				// 64 is a multiple of every width, so an index never straddles two words.
+				const auto bit = position * bitsPerIndex;
+				const auto mask = (std::uint64_t(1) << bitsPerIndex) - 1;
+
+				return static_cast<unsigned>((words[bit >> 6] >> (bit & 63)) & mask);
+			}
+
+			void SetIndex(size_t position, unsigned index);
+			void Repack(unsigned newBitsPerIndex, const std::vector<unsigned>& remap);
+
+			[[nodiscard]] static unsigned GetBitsForPaletteSize(size_t paletteSize);
+		public:
+			explicit PaletteStorage(size_t size, BlockType initialType = Blocks::AIR);
+
+			[[nodiscard]] BlockType Get(const size_t position) const { return palette[GetIndex(position)]; }
+
+			// Returns the type that was stored before.
+			BlockType Set(size_t position, BlockType type);
+
+			void Fill(BlockType type);
+			// Replaces every position from input, which must hold GetSize() entries,
+			// building the smallest palette in one pass.
+			void Assign(const BlockType* input);
+			void Compact();
+
+			// Decodes every position in order into output, which must hold GetSize() entries.
+			void CopyTo(BlockType* output) const;
+
+			[[nodiscard]] size_t GetSize() const { return size; }
+			[[nodiscard]] size_t GetPaletteSize() const { return palette.size(); }
+			[[nodiscard]] unsigned GetBitsPerIndex() const { return bitsPerIndex; }
+			// Heap bytes held for the palette and the packed indices.
+			[[nodiscard]] size_t GetMemoryUsage() const;
+	};
+}
@@ -0,0 +1,403 @@
+#include "SparseVoxelOctree.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace Voxels
+{
+	namespace
+	{
+		int GetChildIndex(const glm::ivec3& local, const int half)
+		{
+			return ((local.x & half) ? 1 : 0) | ((local.y & half) ? 2 : 0) | ((local.z & half) ? 4 : 0);
+		}
+
+		glm::ivec3 GetChildOffset(const int child, const int half)
+		{
+			return glm::ivec3(child & 1, (child >> 1) & 1, (child >> 2) & 1) * half;
+		}
+
+		// Slab test; axis is the one whose plane the ray enters through, or -1.
+		bool IntersectBox(
+			const glm::vec3& point, const glm::vec3& direction, const glm::vec3& inverseDirection,
+			const glm::vec3& boxMin, const glm::vec3& boxMax, float& tNear, float& tFar, int& axis)
+		{
+			tNear = -std::numeric_limits<float>::infinity();
+			tFar = std::numeric_limits<float>::infinity();
+			axis = -1;
+
+			for (int a = 0; a < 3; ++a)
+			{
+				if (direction[a] == 0.0f)
+				{
+					if (point[a] < boxMin[a] || point[a] > boxMax[a])
+						return false;
+
+					continue;
+				}
+
+				auto t1 = (boxMin[a] - point[a]) * inverseDirection[a];
+				auto t2 = (boxMax[a] - point[a]) * inverseDirection[a];
+
+				if (t1 > t2)
+					std::swap(t1, t2);
+
+				if (t1 > tNear)
+				{
+					tNear = t1;
+					axis = a;
+				}
+
+				tFar = std::min(tFar, t2);
+			}
+
+			return tNear <= tFar;
+		}
+	}
+
+	SparseVoxelOctree::SparseVoxelOctree(const glm::ivec3& origin, const int depth)
+		: nodes{ MakeLeaf(Blocks::AIR) }, origin(origin), depth(depth), size(1 << depth)
+	{
+		if (depth < 0 || depth > 30)
+			throw std::exception("Octree depth must be between 0 and 30.");
+	}
+
+	SparseVoxelOctree SparseVoxelOctree::Covering(const glm::ivec3& minChunkCoord, const glm::ivec3& maxChunkCoord)
+	{
+		const auto extent = maxChunkCoord - minChunkCoord + 1;
+		const auto largestExtent = std::max({ extent.x, extent.y, extent.z });
+
+		int depth = 4;
+
+		while ((1 << (depth - 4)) < largestExtent)
+			++depth;
+
+		return SparseVoxelOctree(minChunkCoord * CHUNK_SIZE, depth);
+	}
+
+	SparseVoxelOctree SparseVoxelOctree::FromWorld(const World& world)
+	{
+		if (world.GetChunkCount() == 0)
+			return SparseVoxelOctree(glm::ivec3(0), 4);
+
+		auto minCoord = glm::ivec3(std::numeric_limits<int>::max());
+		auto maxCoord = glm::ivec3(std::numeric_limits<int>::lowest());
+
+		for (const auto& [chunkCoord, chunk] : world)
+		{
+			minCoord = glm::min(minCoord, chunkCoord);
+			maxCoord = glm::max(maxCoord, chunkCoord);
+		}
+
+		auto octree = Covering(minCoord, maxCoord);
+
+		for (const auto& [chunkCoord, chunk] : world)
+			octree.SetChunk(*chunk);
+
+		octree.nodes.shrink_to_fit();
+
+		return octree;
+	}
+
+	bool SparseVoxelOctree::Contains(const int x, const int y, const int z) const
+	{
+		const auto local = glm::ivec3(x, y, z) - origin;
+
+		return local.x >= 0 && local.y >= 0 && local.z >= 0 &&
+			local.x < size && local.y < size && local.z < size;
+	}
+
+	BlockType SparseVoxelOctree::GetBlock(const int x, const int y, const int z) const
+	{
+		if (!Contains(x, y, z))
+			return Blocks::AIR;
+
+		const auto local = glm::ivec3(x, y, z) - origin;
+
+		auto node = nodes[0];
+
+		for (auto half = size >> 1; !IsLeaf(node); half >>= 1)
+			node = nodes[node + GetChildIndex(local, half)];
+
+		return GetLeafType(node);
+	}
+
+	void SparseVoxelOctree::SetBlock(const int x, const int y, const int z, const BlockType type)
+	{
+		if (!Contains(x, y, z))
+			throw std::exception("Block lies outside the octree.");
+
+		if (GetBlock(x, y, z) == type)
+			return;
+
+		const auto local = glm::ivec3(x, y, z) - origin;
+
+		std::vector<size_t> path;
+		const auto slot = DescendForWrite(local, 1, path);
+
+		nodes[slot] = MakeLeaf(type);
+
+		CollapsePath(path);
+	}
+
+	void SparseVoxelOctree::SetChunk(const Chunk& chunk)
+	{
+		const auto local = chunk.GetOrigin() - origin;
+
+		if (size < CHUNK_SIZE ||
+			local.x % CHUNK_SIZE != 0 || local.y % CHUNK_SIZE != 0 || local.z % CHUNK_SIZE != 0 ||
+			local.x < 0 || local.y < 0 || local.z < 0 ||
+			local.x >= size || local.y >= size || local.z >= size)
+		{
+			throw std::exception("Chunk does not fit the octree's chunk grid.");
+		}
+
+		std::array<BlockType, CHUNK_VOLUME> blocks;
+		chunk.CopyBlocks(blocks);
+
+		std::vector<size_t> path;
+		const auto slot = DescendForWrite(local, CHUNK_SIZE, path);
+
+		FreeSubtree(nodes[slot]);
+
+		const auto subtree = BuildSubtree(blocks, glm::ivec3(0), CHUNK_SIZE);
+		nodes[slot] = subtree;
+
+		CollapsePath(path);
+	}
+
+	void SparseVoxelOctree::ForEachInRegion(
+		const glm::ivec3& regionMin, const glm::ivec3& regionMax,
+		const std::function<void(const glm::ivec3&, const glm::ivec3&, BlockType)>& visit) const
+	{
+		VisitRegion(nodes[0], origin, size, regionMin, regionMax, visit);
+	}
+
+	bool SparseVoxelOctree::Raycast(
+		const glm::vec3& rayOrigin, const glm::vec3& direction,
+		const float maxDistance, OctreeRayHit& hit) const
+	{
+		const auto length = glm::length(direction);
+
+		if (length == 0.0f)
+			return false;
+
+		// Shifted so block (x, y, z) spans [x, x + 1] instead of being centred on it.
+		const auto point = rayOrigin - glm::vec3(origin) + 0.5f;
+		const auto unitDirection = direction / length;
+		const auto inverseDirection = 1.0f / unitDirection;
+
+		const auto mask =
+			(unitDirection.x < 0.0f ? 1 : 0) |
+			(unitDirection.y < 0.0f ? 2 : 0) |
+			(unitDirection.z < 0.0f ? 4 : 0);
+
+		struct Entry
+		{
+			std::uint32_t node;
+			glm::ivec3 min;
+			int size;
+		};
+
+		// Each level leaves at most seven siblings waiting.
+		std::array<Entry, 7 * 30 + 8> stack;
+		size_t stackSize = 0;
+
+		stack[stackSize++] = { nodes[0], glm::ivec3(0), size };
+
+		while (stackSize > 0)
+		{
+			const auto entry = stack[--stackSize];
+
+			float tNear, tFar;
+			int axis;
+
+			if (!IntersectBox(
+				point, unitDirection, inverseDirection,
+				glm::vec3(entry.min), glm::vec3(entry.min + entry.size), tNear, tFar, axis))
+			{
+				continue;
+			}
+
+			if (tFar < 0.0f || tNear > maxDistance)
+				continue;
+
+			if (!IsLeaf(entry.node))
+			{
+				// Children in i ^ mask order are front to back for this ray's
+				// direction signs, so they are pushed in reverse.
+				const auto half = entry.size >> 1;
+
+				for (int i = 7; i >= 0; --i)
+				{
+					const auto child = i ^ mask;
+
+					stack[stackSize++] = {
+						nodes[entry.node + child], entry.min + GetChildOffset(child, half), half };
+				}
+
+				continue;
+			}
+
+			const auto type = GetLeafType(entry.node);
+
+			if (type == Blocks::AIR)
+				continue;
+
+			// A leaf may span many blocks; report the one the ray enters.
+			const auto distance = std::max(tNear, 0.0f);
+			const auto entryPoint = point + unitDirection * distance;
+
+			auto block = glm::clamp(
+				glm::ivec3(glm::floor(entryPoint)), entry.min, entry.min + entry.size - 1);
+
+			hit.normal = glm::ivec3(0);
+
+			if (axis >= 0 && tNear >= 0.0f)
+			{
+				block[axis] = unitDirection[axis] > 0.0f ? entry.min[axis] : entry.min[axis] + entry.size - 1;
+				hit.normal[axis] = unitDirection[axis] > 0.0f ? -1 : 1;
+			}
+
+			hit.block = block + origin;
+			hit.distance = distance;
+			hit.type = type;
+
+			return true;
+		}
+
+		return false;
+	}
+
+	size_t SparseVoxelOctree::GetMemoryUsage() const
+	{
+		return (nodes.capacity() + freeChildBlocks.capacity()) * sizeof(std::uint32_t);
+	}
+
+	std::uint32_t SparseVoxelOctree::AllocateChildren(const std::uint32_t fill)
+	{
+		if (!freeChildBlocks.empty())
+		{
+			const auto index = freeChildBlocks.back();
+			freeChildBlocks.pop_back();
+
+			std::fill_n(nodes.begin() + index, 8, fill);
+
+			return index;
+		}
+
+		const auto index = nodes.size();
+
+		if (index + 8 > LEAF_BIT)
+			throw std::exception("Octree node pool is full.");
+
+		nodes.resize(index + 8, fill);
+
+		return static_cast<std::uint32_t>(index);
+	}
+
+	void SparseVoxelOctree::FreeSubtree(const std::uint32_t node)
+	{
+		if (IsLeaf(node))
+			return;
+
+		for (int i = 0; i < 8; ++i)
+			FreeSubtree(nodes[node + i]);
+
+		freeChildBlocks.push_back(node);
+	}
+
+	void SparseVoxelOctree::Split(const size_t slot)
+	{
+		const auto children = AllocateChildren(nodes[slot]);
+		nodes[slot] = children;
+	}
+
+	void SparseVoxelOctree::CollapsePath(const std::vector<size_t>& path)
+	{
+		for (auto it = path.rbegin(); it != path.rend(); ++it)
+		{
+			const auto children = nodes[*it];
+			const auto first = nodes[children];
+
+			if (!IsLeaf(first) ||
+				!std::all_of(nodes.begin() + children + 1, nodes.begin() + children + 8,
+					[first](const std::uint32_t node) { return node == first; }))
+			{
+				return;
+			}
+
+			nodes[*it] = first;
+			freeChildBlocks.push_back(children);
+		}
+	}
+
+	std::uint32_t SparseVoxelOctree::BuildSubtree(
+		const std::array<BlockType, CHUNK_VOLUME>& blocks, const glm::ivec3& local, const int cellSize)
+	{
+		if (cellSize == 1)
+			return MakeLeaf(blocks[Chunk::GetIndex(local.x, local.y, local.z)]);
+
+		const auto half = cellSize >> 1;
+		std::array<std::uint32_t, 8> children;
+
+		for (int child = 0; child < 8; ++child)
+			children[child] = BuildSubtree(blocks, local + GetChildOffset(child, half), half);
+
+		if (IsLeaf(children[0]) &&
+			std::all_of(children.begin() + 1, children.end(),
+				[&children](const std::uint32_t node) { return node == children[0]; }))
+		{
+			return children[0];
+		}
+
+		const auto index = AllocateChildren(0);
+		std::copy(children.begin(), children.end(), nodes.begin() + index);
+
+		return index;
+	}
+
+	size_t SparseVoxelOctree::DescendForWrite(
+		const glm::ivec3& position, const int cellSize, std::vector<size_t>& path)
+	{
+		size_t slot = 0;
+
+		for (auto nodeSize = size; nodeSize > cellSize; nodeSize >>= 1)
+		{
+			if (IsLeaf(nodes[slot]))
+				Split(slot);
+
+			path.push_back(slot);
+			slot = nodes[slot] + GetChildIndex(position, nodeSize >> 1);
+		}
+
+		return slot;
+	}
+
+	void SparseVoxelOctree::VisitRegion(
+		const std::uint32_t node, const glm::ivec3& nodeMin, const int nodeSize,
+		const glm::ivec3& regionMin, const glm::ivec3& regionMax,
+		const std::function<void(const glm::ivec3&, const glm::ivec3&, BlockType)>& visit) const
+	{
+		const auto nodeMax = nodeMin + nodeSize - 1;
+
+		if (glm::any(glm::greaterThan(nodeMin, regionMax)) || glm::any(glm::lessThan(nodeMax, regionMin)))
+			return;
+
+		if (IsLeaf(node))
+		{
+			visit(glm::max(nodeMin, regionMin), glm::min(nodeMax, regionMax), GetLeafType(node));
+			return;
+		}
+
+		const auto half = nodeSize >> 1;
+
+		for (int child = 0; child < 8; ++child)
+		{
+			VisitRegion(
+				nodes[node + child], nodeMin + GetChildOffset(child, half), half,
+				regionMin, regionMax, visit);
+		}
+	}
+}
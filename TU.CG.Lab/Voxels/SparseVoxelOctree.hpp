@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "Chunk.hpp"
+#include "IBlockVolume.hpp"
+#include "World.hpp"
+
+namespace Voxels
+{
+	struct OctreeRayHit
+	{
+		glm::ivec3 block;
+		// Face the ray entered through; zero when the ray starts inside the block.
+		glm::ivec3 normal;
+		float distance;
+		BlockType type;
+	};
+
+	// A cube of 2^depth blocks per side in which every homogeneous region is a
+	// single leaf. Nodes are 32-bit slots: a leaf holds its block type, an
+	// inner node the index of its eight children, which are stored together.
+	class SparseVoxelOctree : public IBlockVolume
+	{
+		private:
+			static constexpr std::uint32_t LEAF_BIT = 0x80000000u;
+
+			std::vector<std::uint32_t> nodes;
+			std::vector<std::uint32_t> freeChildBlocks;
+			glm::ivec3 origin;
+			int depth;
+			int size;
+
+			[[nodiscard]] static bool IsLeaf(const std::uint32_t node) { return (node & LEAF_BIT) != 0; }
+			[[nodiscard]] static std::uint32_t MakeLeaf(const BlockType type) { return LEAF_BIT | type; }
+			[[nodiscard]] static BlockType GetLeafType(const std::uint32_t node) { return static_cast<BlockType>(node & 0xffu); }
+
+			[[nodiscard]] std::uint32_t AllocateChildren(std::uint32_t fill);
+			void FreeSubtree(std::uint32_t node);
+			void Split(size_t slot);
+			void CollapsePath(const std::vector<size_t>& path);
+			[[nodiscard]] std::uint32_t BuildSubtree(
+				const std::array<BlockType, CHUNK_VOLUME>& blocks, const glm::ivec3& local, int cellSize);
+			// Descends to the slot covering a cellSize cube at position, splitting leaves on the way.
+			size_t DescendForWrite(const glm::ivec3& position, int cellSize, std::vector<size_t>& path);
+
+			void VisitRegion(
+				std::uint32_t node, const glm::ivec3& nodeMin, int nodeSize,
+				const glm::ivec3& regionMin, const glm::ivec3& regionMax,
+				const std::function<void(const glm::ivec3&, const glm::ivec3&, BlockType)>& visit) const;
+		public:
+			// Covers origin .. origin + 2^depth - 1 on every axis, initially all air.
+			SparseVoxelOctree(const glm::ivec3& origin, int depth);
+
+			// Smallest chunk-aligned octree, all air, spanning chunks minChunkCoord .. maxChunkCoord.
+			[[nodiscard]] static SparseVoxelOctree Covering(const glm::ivec3& minChunkCoord, const glm::ivec3& maxChunkCoord);
+			// Smallest chunk-aligned octree holding every chunk of the world.
+			[[nodiscard]] static SparseVoxelOctree FromWorld(const World& world);
+
+			[[nodiscard]] bool Contains(int x, int y, int z) const;
+
+			[[nodiscard]] BlockType GetBlock(int x, int y, int z) const override;
+			// Throws for blocks outside the octree; it never grows.
+			void SetBlock(int x, int y, int z, BlockType type);
+			// Replaces the chunk's 16^3 cube; the octree origin must be chunk-aligned.
+			void SetChunk(const Chunk& chunk);
+
+			// Calls visit(min, max) for each homogeneous box, clipped to the
+			// inclusive region [regionMin, regionMax]. Air boxes are visited too.
+			void ForEachInRegion(
+				const glm::ivec3& regionMin, const glm::ivec3& regionMax,
+				const std::function<void(const glm::ivec3&, const glm::ivec3&, BlockType)>& visit) const;
+
+			// Nearest solid block along the ray within maxDistance, front to back
+			// through the octree so empty regions are skipped whole.
+			bool Raycast(
+				const glm::vec3& rayOrigin, const glm::vec3& direction,
+				float maxDistance, OctreeRayHit& hit) const;
+
+			[[nodiscard]] glm::ivec3 GetOrigin() const { return origin; }
+			[[nodiscard]] int GetSize() const { return size; }
+			[[nodiscard]] size_t GetNodeCount() const { return nodes.size() - freeChildBlocks.size() * 8; }
+			[[nodiscard]] size_t GetMemoryUsage() const;
+	};
+}
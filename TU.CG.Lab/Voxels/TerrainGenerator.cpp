@@ -0,0 +1,71 @@
+#include "TerrainGenerator.hpp"
+
+#include <cmath>
+
+namespace Voxels
+{
+	namespace
+	{
+		unsigned Hash(const int x, const int z, const unsigned seed)
+		{
+			auto hash = seed;
+			hash ^= static_cast<unsigned>(x) * 0x27d4eb2du;
+			hash ^= static_cast<unsigned>(z) * 0x165667b1u;
+			hash = (hash ^ (hash >> 15)) * 0x2c1b3c6du;
+			hash = (hash ^ (hash >> 12)) * 0x297a2d39u;
+
+			return hash ^ (hash >> 15);
+		}
+
+		float ValueNoise(const float x, const float z, const unsigned seed)
+		{
+			const auto x0 = static_cast<int>(std::floor(x));
+			const auto z0 = static_cast<int>(std::floor(z));
+			const auto tx = x - static_cast<float>(x0);
+			const auto tz = z - static_cast<float>(z0);
+
+			const auto corner = [seed](const int cx, const int cz)
+			{
+				return static_cast<float>(Hash(cx, cz, seed) & 0xffffu) / 65535.0f;
+			};
+
+			const auto sx = tx * tx * (3.0f - 2.0f * tx);
+			const auto sz = tz * tz * (3.0f - 2.0f * tz);
+
+			const auto top = glm::mix(corner(x0, z0), corner(x0 + 1, z0), sx);
+			const auto bottom = glm::mix(corner(x0, z0 + 1), corner(x0 + 1, z0 + 1), sx);
+
+			return glm::mix(top, bottom, sz);
+		}
+	}
+
+	void TerrainGenerator::GenerateHills(
+		World& world, const glm::ivec3& size, const unsigned seed, const bool withOres)
+	{
+		for (int x = 0; x < size.x; ++x)
+		{
+			for (int z = 0; z < size.z; ++z)
+			{
+				const auto noise =
+					ValueNoise(x / 32.0f, z / 32.0f, seed) * 0.75f +
+					ValueNoise(x / 8.0f, z / 8.0f, seed + 1) * 0.25f;
+
+				const auto height = glm::clamp(
+					static_cast<int>(noise * static_cast<float>(size.y)), 1, size.y);
+
+				for (int y = 0; y < height; ++y)
+				{
+					auto type = Blocks::STONE;
+					const auto roll = withOres ? Hash(x * 31 + y, z, seed + 2) % 100 : 100;
+
+					if (roll < 2)
+						type = Blocks::GOLD;
+					else if (roll < 6)
+						type = Blocks::REDSTONE;
+
+					world.SetBlock(x, y, z, type);
+				}
+			}
+		}
+	}
+}
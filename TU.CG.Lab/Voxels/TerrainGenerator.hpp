@@ -0,0 +1,15 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include "World.hpp"
+
+namespace Voxels
+{
+	class TerrainGenerator
+	{
+		public:
+			// Fills [0, size) with rolling stone hills, sprinkled with ore unless withOres is false.
+			static void GenerateHills(World& world, const glm::ivec3& size, unsigned seed, bool withOres = true);
+	};
+}
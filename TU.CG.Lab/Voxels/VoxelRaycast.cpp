@@ -0,0 +1,160 @@
+#include "VoxelRaycast.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace Voxels
+{
+	namespace
+	{
+		// Reads blocks through the World's chunks, remembering the last chunk.
+		class ChunkLookup
+		{
+			private:
+				const World& world;
+				const Chunk* chunk = nullptr;
+				glm::ivec3 chunkCoord = glm::ivec3(std::numeric_limits<int>::min());
+			public:
+				explicit ChunkLookup(const World& world) : world(world) {}
+
+				BlockType operator()(const glm::ivec3& block)
+				{
+					const auto coord = World::GetChunkCoord(block.x, block.y, block.z);
+
+					if (coord != chunkCoord)
+					{
+						chunkCoord = coord;
+						chunk = world.GetChunk(coord);
+					}
+
+					if (chunk == nullptr)
+						return Blocks::AIR;
+
+					const auto local = block - coord * CHUNK_SIZE;
+
+					return chunk->GetBlock(local.x, local.y, local.z);
+				}
+		};
+
+		class VolumeLookup
+		{
+			private:
+				const IBlockVolume& volume;
+			public:
+				explicit VolumeLookup(const IBlockVolume& volume) : volume(volume) {}
+
+				BlockType operator()(const glm::ivec3& block) const
+				{
+					return volume.GetBlock(block.x, block.y, block.z);
+				}
+		};
+
+		template <typename Lookup>
+		bool Traverse(Lookup& lookup, const Ray& ray, RaycastHit& hit)
+		{
+			hit = RaycastHit();
+
+			const auto length = glm::length(ray.direction);
+
+			// The walk only ends at a solid block or past maxDistance; an infinite or NaN
+			// input could keep it stepping forever through empty space.
+			if (length == 0.0f || !std::isfinite(length) || !std::isfinite(ray.maxDistance) ||
+				glm::any(glm::isinf(ray.origin)) || glm::any(glm::isnan(ray.origin)))
+			{
+				return false;
+			}
+
+			const auto direction = ray.direction / length;
+
+			// Blocks are centred on integer positions; shifted, block b spans [b, b + 1].
+			const auto point = ray.origin + 0.5f;
+
+			auto block = glm::ivec3(glm::floor(point));
+			glm::ivec3 step(0);
+			glm::vec3 tMax(std::numeric_limits<float>::infinity());
+			glm::vec3 tDelta(std::numeric_limits<float>::infinity());
+
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				if (direction[axis] > 0.0f)
+				{
+					step[axis] = 1;
+					tDelta[axis] = 1.0f / direction[axis];
+					tMax[axis] = (static_cast<float>(block[axis] + 1) - point[axis]) * tDelta[axis];
+				}
+				else if (direction[axis] < 0.0f)
+				{
+					step[axis] = -1;
+					tDelta[axis] = -1.0f / direction[axis];
+					tMax[axis] = (point[axis] - static_cast<float>(block[axis])) * tDelta[axis];
+				}
+			}
+
+			auto distance = 0.0f;
+			glm::ivec3 normal(0);
+
+			while (true)
+			{
+				const auto type = lookup(block);
+
+				if (type != Blocks::AIR)
+				{
+					hit.block = block;
+					hit.normal = normal;
+					hit.distance = distance;
+					hit.type = type;
+
+					return true;
+				}
+
+				int axis = 0;
+
+				if (tMax.y < tMax[axis])
+					axis = 1;
+				if (tMax.z < tMax[axis])
+					axis = 2;
+
+				distance = tMax[axis];
+
+				if (distance > ray.maxDistance)
+					return false;
+
+				block[axis] += step[axis];
+				tMax[axis] += tDelta[axis];
+
+				normal = glm::ivec3(0);
+				normal[axis] = -step[axis];
+			}
+		}
+	}
+
+	bool VoxelRaycast::Cast(const IBlockVolume& volume, const Ray& ray, RaycastHit& hit)
+	{
+		VolumeLookup lookup(volume);
+
+		return Traverse(lookup, ray, hit);
+	}
+
+	bool VoxelRaycast::Cast(const World& world, const Ray& ray, RaycastHit& hit)
+	{
+		ChunkLookup lookup(world);
+
+		return Traverse(lookup, ray, hit);
+	}
+
+	size_t VoxelRaycast::CastBatch(
+		const World& world, const std::span<const Ray> rays, const std::span<RaycastHit> hits)
+	{
+		if (hits.size() < rays.size())
+			throw std::exception("Raycast batch needs one hit slot per ray.");
+
+		// One lookup for the whole batch, so nearby rays share the cached chunk.
+		ChunkLookup lookup(world);
+		size_t hitCount = 0;
+
+		for (size_t i = 0; i < rays.size(); ++i)
+			hitCount += Traverse(lookup, rays[i], hits[i]);
+
+		return hitCount;
+	}
+}
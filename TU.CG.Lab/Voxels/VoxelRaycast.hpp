@@ -0,0 +1,46 @@
+#pragma once
+
+#include <span>
+#include <glm/glm.hpp>
+
+#include "BlockType.hpp"
+#include "IBlockVolume.hpp"
+#include "World.hpp"
+
+namespace Voxels
+{
+	struct Ray
+	{
+		glm::vec3 origin;
+		glm::vec3 direction;
+		// Must be finite; rays with non-finite values hit nothing.
+		float maxDistance;
+	};
+
+	struct RaycastHit
+	{
+		glm::ivec3 block = glm::ivec3(0);
+		// Face the ray entered through; zero when the ray starts inside the block.
+		glm::ivec3 normal = glm::ivec3(0);
+		float distance = 0.0f;
+		// AIR when the ray hit nothing.
+		BlockType type = Blocks::AIR;
+	};
+
+	// Amanatides-Woo grid traversal: steps block by block along the ray and
+	// stops at the first solid one. Nothing is allocated per ray.
+	class VoxelRaycast
+	{
+		public:
+			[[nodiscard]] static bool Cast(
+				const IBlockVolume& volume, const Ray& ray, RaycastHit& hit);
+
+			// Keeps the current chunk between steps instead of looking it up per block.
+			[[nodiscard]] static bool Cast(
+				const World& world, const Ray& ray, RaycastHit& hit);
+
+			// hits must be at least as long as rays. Returns the number of rays that hit.
+			static size_t CastBatch(
+				const World& world, std::span<const Ray> rays, std::span<RaycastHit> hits);
+	};
+}
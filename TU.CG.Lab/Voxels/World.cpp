@@ -0,0 +1,172 @@
+#include "World.hpp"
+
+#include <algorithm>
+
+namespace Voxels
+{
+	namespace
+	{
+		int FloorDiv(const int value, const int divisor)
+		{
+			return value >= 0 ? value / divisor : (value - divisor + 1) / divisor;
+		}
+
+		int FloorMod(const int value, const int divisor)
+		{
+			const auto result = value % divisor;
+
+			return result < 0 ? result + divisor : result;
+		}
+	}
+
+	size_t ChunkCoordHash::operator()(const glm::ivec3& coord) const
+	{
+		auto hash = static_cast<size_t>(static_cast<unsigned>(coord.x)) * 73856093u;
+		hash ^= static_cast<size_t>(static_cast<unsigned>(coord.y)) * 19349663u;
+		hash ^= static_cast<size_t>(static_cast<unsigned>(coord.z)) * 83492791u;
+
+		return hash;
+	}
+
+	void World::SetBlock(const int x, const int y, const int z, const BlockType type)
+	{
+		const auto chunkCoord = GetChunkCoord(x, y, z);
+		const auto local = GetLocalCoord(x, y, z);
+
+		auto umit = chunks.find(chunkCoord);
+
+		if (umit == chunks.end())
+		{
+			// Writing air into a missing chunk is a no-op, so air never allocates.
+			if (type == Blocks::AIR)
+				return;
+
+			umit = chunks.emplace(chunkCoord, std::make_unique<Chunk>(chunkCoord)).first;
+		}
+
+		const auto previousType = umit->second->GetBlock(local.x, local.y, local.z);
+
+		if (previousType == type)
+			return;
+
+		umit->second->SetBlock(local.x, local.y, local.z, type);
+
+		if (umit->second->IsEmpty())
+			chunks.erase(umit);
+
+		MarkDirty(chunkCoord);
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			if (local[axis] == 0)
+				MarkNeighbourDirty(chunkCoord, axis, -1);
+			else if (local[axis] == CHUNK_SIZE - 1)
+				MarkNeighbourDirty(chunkCoord, axis, 1);
+		}
+	}
+
+	void World::SetChunk(std::unique_ptr<Chunk> chunk)
+	{
+		const auto chunkCoord = chunk->GetCoord();
+
+		if (chunk->IsEmpty())
+			chunks.erase(chunkCoord);
+		else
+			chunks[chunkCoord] = std::move(chunk);
+
+		MarkDirty(chunkCoord);
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			MarkNeighbourDirty(chunkCoord, axis, -1);
+			MarkNeighbourDirty(chunkCoord, axis, 1);
+		}
+	}
+
+	void World::RemoveChunk(const glm::ivec3& chunkCoord)
+	{
+		chunks.erase(chunkCoord);
+		dirtyChunks.erase(chunkCoord);
+	}
+
+	void World::Clear()
+	{
+		for (const auto& [chunkCoord, chunk] : chunks)
+			MarkDirty(chunkCoord);
+
+		chunks.clear();
+	}
+
+	std::vector<glm::ivec3> World::TakeDirtyChunks(const size_t maxCount, const glm::ivec3& focus)
+	{
+		std::vector<glm::ivec3> result(dirtyChunks.begin(), dirtyChunks.end());
+
+		const auto count = std::min(maxCount, result.size());
+
+		const auto distance = [&focus](const glm::ivec3& chunkCoord)
+		{
+			const auto offset = chunkCoord - focus;
+
+			return offset.x * offset.x + offset.y * offset.y + offset.z * offset.z;
+		};
+
+		std::partial_sort(
+			result.begin(), result.begin() + count, result.end(),
+			[&distance](const glm::ivec3& left, const glm::ivec3& right)
+			{
+				return distance(left) < distance(right);
+			});
+
+		result.resize(count);
+
+		for (const auto& chunkCoord : result)
+			dirtyChunks.erase(chunkCoord);
+
+		return result;
+	}
+
+	BlockType World::GetBlock(const int x, const int y, const int z) const
+	{
+		const auto chunk = GetChunk(GetChunkCoord(x, y, z));
+
+		if (chunk == nullptr)
+			return Blocks::AIR;
+
+		const auto local = GetLocalCoord(x, y, z);
+
+		return chunk->GetBlock(local.x, local.y, local.z);
+	}
+
+	void World::MarkNeighbourDirty(
+		const glm::ivec3& chunkCoord, const int axis, const int direction)
+	{
+		auto neighbourCoord = chunkCoord;
+		neighbourCoord[axis] += direction;
+
+		// A missing neighbour has no mesh that could reference this face.
+		if (chunks.find(neighbourCoord) != chunks.end())
+			MarkDirty(neighbourCoord);
+	}
+
+	const Chunk* World::GetChunk(const glm::ivec3& chunkCoord) const
+	{
+		const auto umit = chunks.find(chunkCoord);
+
+		if (umit == chunks.end())
+			return nullptr;
+
+		return umit->second.get();
+	}
+
+	glm::ivec3 World::GetChunkCoord(const int x, const int y, const int z)
+	{
+		return glm::ivec3(
+			FloorDiv(x, CHUNK_SIZE), FloorDiv(y, CHUNK_SIZE), FloorDiv(z, CHUNK_SIZE));
+	}
+
+	glm::ivec3 World::GetLocalCoord(const int x, const int y, const int z)
+	{
+		return glm::ivec3(
+			FloorMod(x, CHUNK_SIZE), FloorMod(y, CHUNK_SIZE), FloorMod(z, CHUNK_SIZE));
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "BlockType.hpp"
+#include "Chunk.hpp"
+#include "IBlockVolume.hpp"
+
+namespace Voxels
+{
+	struct ChunkCoordHash
+	{
+		size_t operator()(const glm::ivec3& coord) const;
+	};
+
+	class World : public IBlockVolume
+	{
+		private:
+			using ChunkMap = std::unordered_map<glm::ivec3, std::unique_ptr<Chunk>, ChunkCoordHash>;
+
+			ChunkMap chunks;
+			std::unordered_set<glm::ivec3, ChunkCoordHash> dirtyChunks;
+
+			void MarkNeighbourDirty(const glm::ivec3& chunkCoord, int axis, int direction);
+		public:
+			using const_iterator = ChunkMap::const_iterator;
+
+			World() = default;
+			World(const World& other) = delete;
+			World& operator=(const World& other) = delete;
+			World(World&& other) noexcept = default;
+			World& operator=(World&& other) noexcept = default;
+			~World() override = default;
+
+			// Edits mark the owning chunk dirty, plus the neighbour sharing the
+			// face when the block lies on a chunk border.
+			void SetBlock(int x, int y, int z, BlockType type);
+			void ClearBlock(const int x, const int y, const int z) { SetBlock(x, y, z, Blocks::AIR); }
+			// Replaces a whole chunk at once, marking it and its neighbours dirty.
+			void SetChunk(std::unique_ptr<Chunk> chunk);
+			// Drops a chunk that has gone out of sight. Its neighbours are not marked dirty;
+			// their faces towards it show again only once it is loaded back.
+			void RemoveChunk(const glm::ivec3& chunkCoord);
+			void Clear();
+
+			void MarkDirty(const glm::ivec3& chunkCoord) { dirtyChunks.insert(chunkCoord); }
+			void ClearDirtyChunks() { dirtyChunks.clear(); }
+
+			// Removes and returns up to maxCount dirty chunks, nearest to focus first.
+			[[nodiscard]] std::vector<glm::ivec3> TakeDirtyChunks(
+				size_t maxCount, const glm::ivec3& focus);
+
+			[[nodiscard]] size_t GetDirtyChunkCount() const { return dirtyChunks.size(); }
+
+			[[nodiscard]] BlockType GetBlock(int x, int y, int z) const override;
+
+			[[nodiscard]] const Chunk* GetChunk(const glm::ivec3& chunkCoord) const;
+			[[nodiscard]] size_t GetChunkCount() const { return chunks.size(); }
+
+			[[nodiscard]] const_iterator begin() const { return chunks.begin(); }
+			[[nodiscard]] const_iterator end() const { return chunks.end(); }
+
+			[[nodiscard]] static glm::ivec3 GetChunkCoord(int x, int y, int z);
+			[[nodiscard]] static glm::ivec3 GetLocalCoord(int x, int y, int z);
+	};
+}
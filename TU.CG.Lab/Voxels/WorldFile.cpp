@@ -0,0 +1,350 @@
+#include "WorldFile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <tuple>
+
+#include "Utils/BinaryData.hpp"
+
+namespace Voxels
+{
+	namespace
+	{
+		// Orders coordinates by x, then y, then z, so one (x, y) column is a contiguous run.
+		bool IsCoordBefore(const glm::ivec3& left, const glm::ivec3& right)
+		{
+			return std::tie(left.x, left.y, left.z) < std::tie(right.x, right.y, right.z);
+		}
+
+		std::vector<std::byte> MakeHeader(const std::uint32_t chunkCount, const std::uint64_t tableOffset)
+		{
+			std::vector<std::byte> header;
+			header.reserve(WorldFileFormat::HEADER_SIZE);
+
+			Utils::PutBytes(header, WorldFileFormat::MAGIC, sizeof WorldFileFormat::MAGIC);
+			Utils::PutUint(header, WorldFileFormat::VERSION, 4);
+			Utils::PutUint(header, CHUNK_SIZE, 4);
+			Utils::PutUint(header, chunkCount, 4);
+			Utils::PutUint(header, tableOffset, 8);
+			Utils::PutUint(header, 0, 8);
+
+			return header;
+		}
+	}
+
+	WorldFileWriter::WorldFileWriter(const std::string& filePath)
+		: stream(filePath, std::ios::binary | std::ios::trunc), filePath(filePath)
+	{
+		if (!stream)
+		{
+			const auto errorMessage = "Failed to open world file for writing: " + filePath;
+			throw std::exception(errorMessage.c_str());
+		}
+
+		// Placeholder until Finish knows the chunk count and table offset.
+		const auto header = MakeHeader(0, 0);
+		stream.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+	}
+
+	void WorldFileWriter::WriteChunk(const Chunk& chunk)
+	{
+		if (finished)
+			throw std::exception("Cannot write chunks to a finished world file.");
+
+		std::array<BlockType, CHUNK_VOLUME> blocks;
+		chunk.CopyBlocks(blocks);
+
+		std::vector<BlockType> palette;
+		std::uint8_t paletteIndex[256];
+
+		buffer.clear();
+		buffer.resize(2);
+
+		for (int i = 0; i < CHUNK_VOLUME; ++i)
+		{
+			const auto type = blocks[i];
+
+			if (std::find(palette.begin(), palette.end(), type) == palette.end())
+			{
+				paletteIndex[type] = static_cast<std::uint8_t>(palette.size());
+				palette.push_back(type);
+				buffer.push_back(static_cast<std::byte>(type));
+			}
+		}
+
+		buffer[0] = static_cast<std::byte>(palette.size());
+		buffer[1] = static_cast<std::byte>(palette.size() >> 8);
+
+		const auto runCountOffset = buffer.size();
+		Utils::PutUint(buffer, 0, 4);
+
+		std::uint32_t runCount = 0;
+		int i = 0;
+
+		while (i < CHUNK_VOLUME)
+		{
+			const auto type = blocks[i];
+			int length = 1;
+
+			while (i + length < CHUNK_VOLUME && blocks[i + length] == type)
+				++length;
+
+			Utils::PutUint(buffer, length, 2);
+			buffer.push_back(static_cast<std::byte>(paletteIndex[type]));
+
+			++runCount;
+			i += length;
+		}
+
+		for (int byte = 0; byte < 4; ++byte)
+			buffer[runCountOffset + byte] = static_cast<std::byte>(runCount >> (8 * byte));
+
+		const auto offset = static_cast<std::uint64_t>(stream.tellp());
+
+		stream.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+		table.push_back({ chunk.GetCoord(), static_cast<std::uint32_t>(buffer.size()), offset });
+	}
+
+	void WorldFileWriter::Finish()
+	{
+		if (finished)
+			return;
+
+		const auto tableOffset = static_cast<std::uint64_t>(stream.tellp());
+
+		buffer.clear();
+
+		for (const auto& entry : table)
+		{
+			Utils::PutUint(buffer, static_cast<std::uint32_t>(entry.coord.x), 4);
+			Utils::PutUint(buffer, static_cast<std::uint32_t>(entry.coord.y), 4);
+			Utils::PutUint(buffer, static_cast<std::uint32_t>(entry.coord.z), 4);
+			Utils::PutUint(buffer, entry.size, 4);
+			Utils::PutUint(buffer, entry.offset, 8);
+		}
+
+		stream.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+		const auto header = MakeHeader(static_cast<std::uint32_t>(table.size()), tableOffset);
+
+		stream.seekp(0);
+		stream.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+		stream.close();
+
+		finished = true;
+
+		if (stream.fail())
+		{
+			const auto errorMessage = "Failed to write world file: " + filePath;
+			throw std::exception(errorMessage.c_str());
+		}
+	}
+
+	void WorldFileWriter::Save(const World& world, const std::string& filePath)
+	{
+		WorldFileWriter writer(filePath);
+
+		for (const auto& [chunkCoord, chunk] : world)
+			writer.WriteChunk(*chunk);
+
+		writer.Finish();
+	}
+
+	WorldFileReader::WorldFileReader(const std::string& filePath)
+		: file(filePath), filePath(filePath)
+	{
+		const auto data = file.GetData();
+		const auto size = file.GetSize();
+
+		if (size < WorldFileFormat::HEADER_SIZE ||
+			std::memcmp(data, WorldFileFormat::MAGIC, sizeof WorldFileFormat::MAGIC) != 0)
+		{
+			ThrowCorrupt("not a world file");
+		}
+
+		const auto version = Utils::GetUint(data + 4, 4);
+
+		if (version != WorldFileFormat::VERSION)
+			ThrowCorrupt("unsupported version " + std::to_string(version));
+
+		if (Utils::GetUint(data + 8, 4) != CHUNK_SIZE)
+			ThrowCorrupt("chunk size does not match this build");
+
+		const auto chunkCount = Utils::GetUint(data + 12, 4);
+		const auto tableOffset = Utils::GetUint(data + 16, 8);
+
+		if (tableOffset > size || (size - tableOffset) / WorldFileFormat::TABLE_ENTRY_SIZE < chunkCount)
+			ThrowCorrupt("chunk table is truncated");
+
+		table.reserve(chunkCount);
+
+		for (std::uint64_t i = 0; i < chunkCount; ++i)
+		{
+			const auto entry = data + tableOffset + i * WorldFileFormat::TABLE_ENTRY_SIZE;
+
+			TableEntry tableEntry;
+			tableEntry.coord = glm::ivec3(
+				static_cast<std::int32_t>(Utils::GetUint(entry, 4)),
+				static_cast<std::int32_t>(Utils::GetUint(entry + 4, 4)),
+				static_cast<std::int32_t>(Utils::GetUint(entry + 8, 4)));
+			tableEntry.size = static_cast<std::uint32_t>(Utils::GetUint(entry + 12, 4));
+			tableEntry.offset = Utils::GetUint(entry + 16, 8);
+
+			if (tableEntry.offset > size || size - tableEntry.offset < tableEntry.size)
+				ThrowCorrupt("chunk data lies outside the file");
+
+			table.push_back(tableEntry);
+		}
+
+		std::sort(table.begin(), table.end(), [](const TableEntry& left, const TableEntry& right)
+		{
+			return IsCoordBefore(left.coord, right.coord);
+		});
+
+		const auto duplicate = std::adjacent_find(table.begin(), table.end(), [](const TableEntry& left, const TableEntry& right)
+		{
+			return left.coord == right.coord;
+		});
+
+		if (duplicate != table.end())
+			ThrowCorrupt("chunk is listed twice");
+	}
+
+	std::unique_ptr<Chunk> WorldFileReader::ReadChunk(const size_t index) const
+	{
+		const auto& entry = table[index];
+		const auto data = file.GetData() + entry.offset;
+		const auto end = data + entry.size;
+
+		auto chunk = std::make_unique<Chunk>(entry.coord);
+
+		if (entry.size < 2)
+			ThrowCorrupt("chunk data is truncated");
+
+		const auto paletteSize = static_cast<size_t>(Utils::GetUint(data, 2));
+
+		if (entry.size < 2 + paletteSize + 4)
+			ThrowCorrupt("chunk data is truncated");
+
+		const auto palette = data + 2;
+		auto cursor = palette + paletteSize;
+
+		const auto runCount = Utils::GetUint(cursor, 4);
+		cursor += 4;
+
+		if (static_cast<std::uint64_t>(end - cursor) < runCount * 3)
+			ThrowCorrupt("chunk runs are truncated");
+
+		std::array<BlockType, CHUNK_VOLUME> blocks;
+		int i = 0;
+
+		for (std::uint64_t run = 0; run < runCount; ++run, cursor += 3)
+		{
+			const auto length = static_cast<int>(Utils::GetUint(cursor, 2));
+			const auto paletteIndex = static_cast<size_t>(cursor[2]);
+
+			if (paletteIndex >= paletteSize || length > CHUNK_VOLUME - i)
+				ThrowCorrupt("chunk run is out of range");
+
+			std::fill_n(blocks.begin() + i, length, static_cast<BlockType>(palette[paletteIndex]));
+
+			i += length;
+		}
+
+		if (i != CHUNK_VOLUME)
+			ThrowCorrupt("chunk runs do not cover the chunk");
+
+		chunk->SetBlocks(blocks);
+
+		return chunk;
+	}
+
+	void WorldFileReader::LoadInto(World& world) const
+	{
+		for (size_t i = 0; i < table.size(); ++i)
+			world.SetChunk(ReadChunk(i));
+	}
+
+	SparseVoxelOctree WorldFileReader::ReadOctree() const
+	{
+		if (table.empty())
+			return SparseVoxelOctree(glm::ivec3(0), 4);
+
+		auto minCoord = table.front().coord;
+		auto maxCoord = table.front().coord;
+
+		for (const auto& entry : table)
+		{
+			minCoord = glm::min(minCoord, entry.coord);
+			maxCoord = glm::max(maxCoord, entry.coord);
+		}
+
+		auto octree = SparseVoxelOctree::Covering(minCoord, maxCoord);
+
+		for (size_t i = 0; i < table.size(); ++i)
+			octree.SetChunk(*ReadChunk(i));
+
+		return octree;
+	}
+
+	size_t WorldFileReader::LoadChunksNear(World& world, const glm::ivec3& centre, const int radius)
+	{
+		size_t loadedCount = 0;
+
+		for (auto x = centre.x - radius; x <= centre.x + radius; ++x)
+			for (auto y = centre.y - radius; y <= centre.y + radius; ++y)
+			{
+				auto entry = std::lower_bound(table.begin(), table.end(), glm::ivec3(x, y, centre.z - radius),
+					[](const TableEntry& tableEntry, const glm::ivec3& coord) { return IsCoordBefore(tableEntry.coord, coord); });
+
+				for (; entry != table.end() && entry->coord.x == x && entry->coord.y == y &&
+					entry->coord.z <= centre.z + radius; ++entry)
+				{
+					if (loadedChunks.contains(entry->coord) || keptChunks.contains(entry->coord))
+						continue;
+
+					world.SetChunk(ReadChunk(entry - table.begin()));
+					loadedChunks.insert(entry->coord);
+					++loadedCount;
+				}
+			}
+
+		return loadedCount;
+	}
+
+	std::vector<glm::ivec3> WorldFileReader::UnloadChunksOutside(World& world, const glm::ivec3& centre, const int radius)
+	{
+		std::vector<glm::ivec3> unloadedChunks;
+
+		for (auto usit = loadedChunks.begin(); usit != loadedChunks.end();)
+		{
+			const auto offset = glm::abs(*usit - centre);
+
+			if (offset.x <= radius && offset.y <= radius && offset.z <= radius)
+			{
+				++usit;
+				continue;
+			}
+
+			world.RemoveChunk(*usit);
+			unloadedChunks.push_back(*usit);
+			usit = loadedChunks.erase(usit);
+		}
+
+		return unloadedChunks;
+	}
+
+	void WorldFileReader::KeepChunk(const glm::ivec3& chunkCoord)
+	{
+		loadedChunks.erase(chunkCoord);
+		keptChunks.insert(chunkCoord);
+	}
+
+	void WorldFileReader::ThrowCorrupt(const std::string& reason) const
+	{
+		const auto errorMessage = "Invalid world file " + filePath + ": " + reason;
+		throw std::exception(errorMessage.c_str());
+	}
+}
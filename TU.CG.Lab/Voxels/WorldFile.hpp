@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "Chunk.hpp"
+#include "SparseVoxelOctree.hpp"
+#include "World.hpp"
+#include "Utils/MappedFile.hpp"
+
+namespace Voxels
+{
+	// Layout of a .world file, all integers little-endian:
+	//
+	//   header       magic "TUCW", u32 version, u32 chunk size, u32 chunk count,
+	//                u64 chunk table offset, u64 reserved
+	//   chunk data   per chunk: u16 palette size, u8 palette[palette size],
+	//                u32 run count, runs of (u16 length, u8 palette index)
+	//   chunk table  per chunk: i32 x, i32 y, i32 z, u32 data size, u64 data offset
+	//
+	// Runs walk a chunk in Chunk::GetIndex order. The table comes last so the
+	// writer can stream chunks without knowing their count up front.
+	namespace WorldFileFormat
+	{
+		constexpr char MAGIC[4] = { 'T', 'U', 'C', 'W' };
+		constexpr std::uint32_t VERSION = 1;
+		constexpr size_t HEADER_SIZE = 32;
+		constexpr size_t TABLE_ENTRY_SIZE = 24;
+	}
+
+	class WorldFileWriter
+	{
+		private:
+			struct TableEntry
+			{
+				glm::ivec3 coord;
+				std::uint32_t size;
+				std::uint64_t offset;
+			};
+
+			std::ofstream stream;
+			std::string filePath;
+			std::vector<TableEntry> table;
+			std::vector<std::byte> buffer;
+			bool finished = false;
+		public:
+			explicit WorldFileWriter(const std::string& filePath);
+			WorldFileWriter(const WorldFileWriter& other) = delete;
+			WorldFileWriter& operator=(const WorldFileWriter& other) = delete;
+			WorldFileWriter(WorldFileWriter&& other) noexcept = default;
+			WorldFileWriter& operator=(WorldFileWriter&& other) noexcept = default;
+			~WorldFileWriter() = default;
+
+			void WriteChunk(const Chunk& chunk);
+			// Writes the chunk table and the final header. Without it the file is unreadable.
+			void Finish();
+
+			[[nodiscard]] size_t GetChunkCount() const { return table.size(); }
+
+			static void Save(const World& world, const std::string& filePath);
+	};
+
+	// Reads chunks straight out of a memory-mapped .world file; only the chunk
+	// table is parsed up front, so loading cost follows the chunks requested.
+	class WorldFileReader
+	{
+		private:
+			struct TableEntry
+			{
+				glm::ivec3 coord;
+				std::uint32_t size;
+				std::uint64_t offset;
+			};
+
+			Utils::MappedFile file;
+			std::string filePath;
+			// Sorted by coordinate at open time, so the chunks of one (x, y) column sit together.
+			std::vector<TableEntry> table;
+			// Chunks LoadChunksNear has put into the World and UnloadChunksOutside may take out.
+			std::unordered_set<glm::ivec3, ChunkCoordHash> loadedChunks;
+			// Chunks edited since they were read; they stay in the World and are never read again.
+			std::unordered_set<glm::ivec3, ChunkCoordHash> keptChunks;
+
+			[[noreturn]] void ThrowCorrupt(const std::string& reason) const;
+		public:
+			explicit WorldFileReader(const std::string& filePath);
+
+			[[nodiscard]] size_t GetChunkCount() const { return table.size(); }
+			[[nodiscard]] glm::ivec3 GetChunkCoord(const size_t index) const { return table[index].coord; }
+
+			[[nodiscard]] std::unique_ptr<Chunk> ReadChunk(size_t index) const;
+
+			void LoadInto(World& world) const;
+			// Reads every chunk into the smallest octree that holds them all.
+			[[nodiscard]] SparseVoxelOctree ReadOctree() const;
+			// Loads the chunks whose coordinates lie within radius chunks of centre on every
+			// axis and are not loaded yet. Only table entries in that range are visited;
+			// returns the number of chunks read.
+			size_t LoadChunksNear(World& world, const glm::ivec3& centre, int radius);
+			// Removes the chunks LoadChunksNear loaded that lie more than radius chunks from
+			// centre on any axis, and returns their coordinates.
+			std::vector<glm::ivec3> UnloadChunksOutside(World& world, const glm::ivec3& centre, int radius);
+			// Marks a chunk as edited, so it is neither unloaded nor overwritten by a later load.
+			void KeepChunk(const glm::ivec3& chunkCoord);
+	};
+}
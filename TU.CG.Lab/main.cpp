@@ -1,12 +1,136 @@
 #include <iostream>
+#include <string>
 
 #include "Applications/Application.hpp"
+#include "Benchmarks/Benchmarks.hpp"
+#include "Graphics/TextureCache.hpp"
+#include "Utils/Profiler.hpp"
+#include "Voxels/BuiltinMap.hpp"
+#include "Voxels/WorldFile.hpp"
+
+namespace
+{
+	// Options shared by normal and benchmark runs, from argv[first] on.
+	void ApplyOptions(Applications::Application& app, const int argc, const char** argv, const int first)
+	{
+		for (int i = first; i < argc; ++i)
+		{
+			const std::string option = argv[i];
+
+			if (option == "--vsync" && i + 1 < argc)
+			{
+				const std::string mode = argv[++i];
+
+				if (mode == "off")
+					app.SetVSyncMode(Utils::VSyncMode::OFF);
+				else if (mode == "adaptive")
+					app.SetVSyncMode(Utils::VSyncMode::ADAPTIVE);
+				else
+					app.SetVSyncMode(Utils::VSyncMode::ON);
+			}
+			else if (option == "--fps-cap" && i + 1 < argc)
+			{
+				app.SetFrameCap(std::stod(argv[++i]));
+			}
+			else if (option == "--profile" && i + 2 < argc)
+			{
+				// --profile <first frame> <frame count> [trace file]; frame 0 covers loading.
+				const auto firstFrame = std::stoull(argv[++i]);
+				const auto frameCount = std::stoull(argv[++i]);
+				const std::string filePath = i + 1 < argc && argv[i + 1][0] != '-' ? argv[++i] : "profile.json";
+
+				Utils::Profiler::CaptureFrames(firstFrame, frameCount, filePath);
+			}
+			else if (option == "--path" && i + 1 < argc)
+			{
+				app.SetCameraPath(argv[++i]);
+			}
+			else if (option == "--record-path" && i + 1 < argc)
+			{
+				app.SetRecordPath(argv[++i]);
+			}
+			else if (option == "--octree")
+			{
+				app.SetOctreeBackend(true);
+			}
+		}
+	}
+
+	bool HasOption(const int argc, const char** argv, const std::string& option)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			if (argv[i] == option)
+				return true;
+		}
+
+		return false;
+	}
+}
 
 int main(const int argc, const char** argv)
 {
 	try
 	{
+		if (argc > 1 && std::string(argv[1]) == "--bench")
+		{
+			const auto benchmark = argc > 2 ? Benchmarks::FindBenchmark(argv[2]) : nullptr;
+
+			if (benchmark == nullptr)
+			{
+				Benchmarks::PrintBenchmarks();
+
+				return -1;
+			}
+
+			benchmark();
+
+			return 0;
+		}
+
+		if (argc > 1 && std::string(argv[1]) == "--export-map")
+		{
+			const std::string filePath = argc > 2 ? argv[2] : "Content/Maps/default.world";
+
+			Voxels::World world;
+			Voxels::BuiltinMap::Build(world);
+			Voxels::WorldFileWriter::Save(world, filePath);
+
+			std::cout << "Exported " << world.GetChunkCount() << " chunks to " << filePath << std::endl;
+
+			return 0;
+		}
+
+		if (argc > 1 && std::string(argv[1]) == "--bake-textures")
+		{
+			const std::string contentDirectory = argc > 2 ? argv[2] : "Content";
+			const std::string bakeDirectory = argc > 3 ? argv[3] : "Cache/Textures";
+
+			const auto bakedCount = Graphics::TextureCache::BakeAll(contentDirectory, bakeDirectory);
+
+			std::cout << "Baked " << bakedCount << " textures into " << bakeDirectory << std::endl;
+
+			return 0;
+		}
+
+		if (argc > 1 && std::string(argv[1]) == "--benchmark")
+		{
+			// --benchmark [frames] [report.json] [--visible] [--path file]; headless unless asked otherwise.
+			const auto hasFrameCount = argc > 2 && argv[2][0] != '-';
+			const auto hasFilePath = hasFrameCount && argc > 3 && argv[3][0] != '-';
+
+			const auto frameCount = hasFrameCount ? std::stoi(argv[2]) : 600;
+			const std::string filePath = hasFilePath ? argv[3] : "benchmark.json";
+
+			Applications::Application app(!HasOption(argc, argv, "--visible"));
+			ApplyOptions(app, argc, argv, 2);
+			app.RunBenchmark(frameCount, filePath);
+
+			return 0;
+		}
+
 		Applications::Application app;
+		ApplyOptions(app, argc, argv, 1);
 
 		app.Run();
 